@@ -0,0 +1,327 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Real-time jitter harness
+ *
+ * Simulates an audio callback running at a fixed period on a dedicated thread while background threads stress
+ * containers, queues and allocators, then reports the tail of the callback durations and the deadline misses
+ * Google Benchmark only reports mean throughput, this harness is the gate for any change to a real-time hot path
+ *
+ * Usage: MLCoreJitter [--block=64] [--rate=48000] [--seconds=10] [--stress=N] [--realtime] [--max-misses=N] [--json]
+ * The process exits with 1 when more than '--max-misses' deadlines were missed
+ */
+
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdio>
+#include <string_view>
+#include <thread>
+
+#include <MLCore/Metrics.hpp>
+#include <MLCore/Memory.hpp>
+#include <MLCore/MPSCQueue.hpp>
+#include <MLCore/NodePool.hpp>
+#include <MLCore/PoolAllocator.hpp>
+#include <MLCore/SPSCQueue.hpp>
+#include <MLCore/Thread.hpp>
+#include <MLCore/UniqueAlloc.hpp>
+#include <MLCore/Vector.hpp>
+
+using namespace Core;
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /** @brief Command line options */
+    struct Options
+    {
+        std::size_t blockSize { 64 };
+        std::size_t sampleRate { 48000 };
+        std::size_t seconds { 10 };
+        std::size_t stressThreads { std::max(std::thread::hardware_concurrency(), 2u) - 1 };
+        std::int64_t maxMisses { -1 };
+        bool realtime { false };
+        bool json { false };
+    };
+
+    /** @brief Parameter change sent by stress threads to the audio thread */
+    struct Command : MPSCQueueNode
+    {
+        std::uint32_t parameter {};
+        float value {};
+    };
+
+    /** @brief Block summary sent by the audio thread to the meter thread */
+    struct Meter
+    {
+        std::uint64_t block {};
+        float peak {};
+    };
+
+    /** @brief Oscillator allocated by the audio thread */
+    struct Voice
+    {
+        float phase {};
+        float increment {};
+        float gain {};
+    };
+
+    constexpr std::size_t ParameterCount = 256;
+    constexpr std::size_t MaxVoices = 32;
+    constexpr std::size_t CommandPoolSize = 4096;
+
+    /** @brief State shared by every thread of the harness */
+    struct Engine
+    {
+        MPSCQueue<Command> commands {};
+        NodePool<Command> commandPool { CommandPoolSize };
+        SPSCQueue<Meter> meters { 1024 };
+        std::atomic<bool> running { true };
+
+        // Audio thread only
+        Vector<float> parameters {};
+        Vector<float> output {};
+        Vector<UniqueAlloc<Voice>> voices {};
+        std::uint64_t block {};
+    };
+
+    Histogram CallbackHistogram("jitter.callback_ns");
+    Histogram WakeupHistogram("jitter.wakeup_ns");
+    Histogram CycleHistogram("jitter.cycle_ns");
+    ShardedCounter DeadlineMisses("jitter.deadline_misses");
+    ShardedCounter AppliedCommands("jitter.commands");
+
+    /** @brief Parse a '--name=value' number, returns false if the argument does not match */
+    template<typename Type>
+    bool ParseOption(const std::string_view argument, const std::string_view name, Type &value) noexcept
+    {
+        if (!argument.starts_with(name) || argument.size() <= name.size() || argument[name.size()] != '=')
+            return false;
+        const auto text = argument.substr(name.size() + 1);
+        return std::from_chars(text.data(), text.data() + text.size(), value).ec == std::errc();
+    }
+
+    /** @brief Parse the command line, returns false on unknown argument */
+    bool ParseOptions(const int argc, const char * const * const argv, Options &options) noexcept
+    {
+        for (auto i = 1; i < argc; ++i) {
+            const std::string_view argument(argv[i]);
+            if (argument == "--realtime")
+                options.realtime = true;
+            else if (argument == "--json")
+                options.json = true;
+            else if (!ParseOption(argument, "--block", options.blockSize)
+                    && !ParseOption(argument, "--rate", options.sampleRate)
+                    && !ParseOption(argument, "--seconds", options.seconds)
+                    && !ParseOption(argument, "--stress", options.stressThreads)
+                    && !ParseOption(argument, "--max-misses", options.maxMisses)) {
+                std::fprintf(stderr, "MLCoreJitter: Unknown argument '%s'\n", argv[i]);
+                return false;
+            }
+        }
+        return options.blockSize && options.sampleRate && options.seconds;
+    }
+
+    /** @brief Simulated audio callback : apply commands, allocate voices, render and send a meter */
+    void AudioCallback(Engine &engine) noexcept
+    {
+        // Apply pending parameter changes
+        while (const auto command = engine.commands.pop()) {
+            engine.parameters[command->parameter % ParameterCount] = command->value;
+            engine.commandPool.release(command);
+            AppliedCommands.increment();
+        }
+
+        // Start a voice every block, stealing the oldest one when full (ordered erase keeps voices sorted by age)
+        if (engine.voices.size() == MaxVoices)
+            engine.voices.erase(engine.voices.begin());
+        const auto parameter = engine.parameters[engine.block % ParameterCount];
+        engine.voices.pushUnsafe(Voice { 0.0f, 0.001f + parameter * 0.01f, 1.0f / MaxVoices });
+
+        // Render
+        for (auto &sample : engine.output)
+            sample = 0.0f;
+        for (auto &voice : engine.voices) {
+            for (auto &sample : engine.output) {
+                voice->phase += voice->increment;
+                if (voice->phase >= 1.0f)
+                    voice->phase -= 1.0f;
+                sample += (2.0f * voice->phase - 1.0f) * voice->gain;
+            }
+        }
+
+        // Meter
+        auto peak = 0.0f;
+        for (const auto sample : engine.output)
+            peak = std::max(peak, sample < 0.0f ? -sample : sample);
+        (void)engine.meters.push(Meter { engine.block, peak });
+        ++engine.block;
+    }
+
+    /** @brief Audio thread, runs the callback at a fixed period until 'blockCount' blocks were rendered */
+    void AudioThread(Engine &engine, const Options &options, const std::size_t blockCount) noexcept
+    {
+        const auto period = std::chrono::nanoseconds(options.blockSize * 1'000'000'000ull / options.sampleRate);
+        auto deadline = Clock::now() + period;
+        for (auto i = 0ul; i < blockCount; ++i) {
+            std::this_thread::sleep_until(deadline);
+            const auto wakeup = Clock::now();
+            AudioCallback(engine);
+            const auto end = Clock::now();
+            CallbackHistogram.record(static_cast<std::uint64_t>((end - wakeup).count()));
+            WakeupHistogram.record(static_cast<std::uint64_t>(std::max(wakeup - deadline, Clock::duration::zero()).count()));
+            CycleHistogram.record(static_cast<std::uint64_t>(std::max(end - deadline, Clock::duration::zero()).count()));
+            // The block must be ready before the next period starts
+            deadline += period;
+            if (end > deadline) {
+                DeadlineMisses.increment();
+                // Skip the periods already elapsed, like a driver reporting an xrun
+                while (deadline < end)
+                    deadline += period;
+            }
+        }
+        engine.running.store(false, std::memory_order_release);
+    }
+
+    /** @brief Stress thread, churns growing vectors, the pool allocator and the command queue */
+    void StressThread(Engine &engine, const std::uint32_t seed) noexcept
+    {
+        Vector<std::uint64_t> scratch;
+        void *blocks[64] {};
+        std::size_t sizes[64] {};
+        auto random = seed * 2654435761u + 1;
+
+        while (engine.running.load(std::memory_order_acquire)) {
+            for (auto i = 0u; i < 4096; ++i)
+                scratch.push(i);
+            scratch.release();
+            for (auto i = 0u; i < 64; ++i) {
+                random = random * 1664525u + 1013904223u;
+                sizes[i] = 16 + (random >> 20) % 2048;
+                blocks[i] = PoolAllocator::Allocate(sizes[i]);
+            }
+            for (auto i = 0u; i < 64; ++i)
+                PoolAllocator::Deallocate(blocks[i], sizes[i]);
+            for (auto i = 0u; i < 16; ++i) {
+                const auto command = engine.commandPool.acquire();
+                if (!command)
+                    break;
+                random = random * 1664525u + 1013904223u;
+                command->parameter = random >> 8;
+                command->value = static_cast<float>(random & 0xFF) / 255.0f;
+                engine.commands.push(command);
+            }
+        }
+    }
+
+    /** @brief Meter thread, consumes the block summaries */
+    void MeterThread(Engine &engine) noexcept
+    {
+        Meter meter;
+        auto peak = 0.0f;
+
+        while (engine.running.load(std::memory_order_acquire) || !engine.meters.empty()) {
+            if (engine.meters.pop(meter))
+                peak = std::max(peak, meter.peak);
+            else
+                std::this_thread::yield();
+        }
+        (void)peak;
+    }
+
+    /** @brief Print a line of percentiles in microseconds */
+    void PrintPercentiles(const char * const name, const Histogram::Snapshot &snapshot) noexcept
+    {
+        constexpr auto Us = [](const std::uint64_t ns) { return static_cast<double>(ns) / 1000.0; };
+
+        std::printf("%-10s %10.1f %10.1f %10.1f %10.1f %10.1f\n", name,
+            Us(snapshot.percentile(50.0)), Us(snapshot.percentile(99.0)), Us(snapshot.percentile(99.9)),
+            Us(snapshot.max), snapshot.mean() / 1000.0);
+    }
+
+    /** @brief Print the non-empty buckets of a histogram as bars */
+    void PrintDistribution(const Histogram::Snapshot &snapshot) noexcept
+    {
+        constexpr std::size_t BarWidth = 50;
+        std::uint64_t highest = 0;
+
+        for (const auto count : snapshot.buckets)
+            highest = std::max(highest, count);
+        if (!highest)
+            return;
+        for (auto i = 0ul; i < Histogram::BucketCount; ++i) {
+            const auto count = snapshot.buckets[i];
+            if (!count)
+                continue;
+            const auto width = std::max<std::size_t>(1, static_cast<std::size_t>(count * BarWidth / highest));
+            std::printf("%9.1f - %9.1f us %10lu |", static_cast<double>(Histogram::BucketLowerBound(i)) / 1000.0,
+                static_cast<double>(Histogram::BucketUpperBound(i)) / 1000.0, static_cast<unsigned long>(count));
+            for (auto j = 0ul; j < width; ++j)
+                std::putchar('#');
+            std::putchar('\n');
+        }
+    }
+}
+
+int main(const int argc, const char * const * const argv)
+{
+    Options options;
+
+    if (!ParseOptions(argc, argv, options)) {
+        std::fprintf(stderr, "Usage: %s [--block=64] [--rate=48000] [--seconds=10] [--stress=N] [--realtime] [--max-misses=N] [--json]\n", argv[0]);
+        return 2;
+    }
+
+    Engine engine;
+    const auto blockCount = options.seconds * options.sampleRate / options.blockSize;
+    engine.parameters.resize(ParameterCount, 0.5f);
+    engine.output.resize(options.blockSize, 0.0f);
+    engine.voices.reserve(MaxVoices);
+
+    Vector<std::thread> threads;
+    threads.reserve(options.stressThreads + 1);
+    for (auto i = 0u; i < options.stressThreads; ++i)
+        threads.push([&engine, i] { Thread::SetCurrentName("Jitter stress"); StressThread(engine, i); });
+    threads.push([&engine] { Thread::SetCurrentName("Jitter meter"); MeterThread(engine); });
+    // Real-time mode locks memory and requests SCHED_FIFO, both fall back silently when not allowed
+    const auto locked = options.realtime && Memory::LockAll();
+    Thread audio(Thread::Options {
+        .name = "Jitter audio",
+        .policy = options.realtime ? SchedulingPolicy::Fifo : SchedulingPolicy::Default
+    }, [&] { AudioThread(engine, options, blockCount); });
+    const auto policy = audio.status().policy == SchedulingPolicy::Fifo ? "SCHED_FIFO"
+        : options.realtime ? "default (SCHED_FIFO denied)" : "default";
+    audio.join();
+    if (locked)
+        Memory::UnlockAll();
+    for (auto &thread : threads)
+        thread.join();
+    // Return the commands still in flight
+    while (const auto command = engine.commands.pop())
+        engine.commandPool.release(command);
+
+    if (options.json) {
+        std::printf("%s\n", MetricsRegistry::Get().dumpJson().c_str());
+    } else {
+        const auto callback = CallbackHistogram.snapshot();
+        const auto misses = DeadlineMisses.load();
+        std::printf("Period %.1f us (%zu samples @ %zu Hz), %zu callbacks, %zu stress threads, scheduling %s, memory %s\n",
+            static_cast<double>(options.blockSize) * 1e6 / static_cast<double>(options.sampleRate),
+            options.blockSize, options.sampleRate, blockCount, options.stressThreads, policy, locked ? "locked" : "not locked");
+        std::printf("%-10s %10s %10s %10s %10s %10s (us)\n", "", "p50", "p99", "p99.9", "max", "mean");
+        PrintPercentiles("callback", callback);
+        PrintPercentiles("wakeup", WakeupHistogram.snapshot());
+        PrintPercentiles("cycle", CycleHistogram.snapshot());
+        std::printf("Deadline misses: %ld (%.3f%%), commands applied: %ld\n\nCallback distribution:\n",
+            static_cast<long>(misses), static_cast<double>(misses) * 100.0 / static_cast<double>(blockCount),
+            static_cast<long>(AppliedCommands.load()));
+        PrintDistribution(callback);
+    }
+    if (options.maxMisses >= 0 && DeadlineMisses.load() > options.maxMisses) {
+        std::fprintf(stderr, "MLCoreJitter: %ld deadline misses, %ld allowed\n",
+            static_cast<long>(DeadlineMisses.load()), static_cast<long>(options.maxMisses));
+        return 1;
+    }
+    return 0;
+}
@@ -5,6 +5,22 @@ set(MLCoreBenchmarksDir ${MLCoreDir}/Benchmarks)
 set(MLCoreBenchmarksSources
     ${MLCoreBenchmarksDir}/Main.cpp
     ${MLCoreBenchmarksDir}/bench_SafeQueue.cpp
+    ${MLCoreBenchmarksDir}/bench_HugePageAllocator.cpp
+    ${MLCoreBenchmarksDir}/bench_PoolAllocator.cpp
+    ${MLCoreBenchmarksDir}/bench_Vector.cpp
+    ${MLCoreBenchmarksDir}/bench_CompressedVector.cpp
+    ${MLCoreBenchmarksDir}/bench_InplaceFunction.cpp
+    ${MLCoreBenchmarksDir}/bench_Mutex.cpp
+    ${MLCoreBenchmarksDir}/bench_Parallel.cpp
+    ${MLCoreBenchmarksDir}/bench_RadixSort.cpp
+    ${MLCoreBenchmarksDir}/bench_BitVector.cpp
+    ${MLCoreBenchmarksDir}/bench_SlotMap.cpp
+    ${MLCoreBenchmarksDir}/bench_CircularBuffer.cpp
+    ${MLCoreBenchmarksDir}/bench_Streamer.cpp
+    ${MLCoreBenchmarksDir}/bench_EventBuffer.cpp
+    ${MLCoreBenchmarksDir}/bench_MPSCQueue.cpp
+    ${MLCoreBenchmarksDir}/bench_Task.cpp
+    ${MLCoreBenchmarksDir}/bench_Snapshot.cpp
 )
 
 add_executable(${CMAKE_PROJECT_NAME} ${MLCoreBenchmarksSources})
@@ -13,4 +29,12 @@ target_link_libraries(${CMAKE_PROJECT_NAME}
 PUBLIC
     MLCoreLib
     benchmark::benchmark
-)
\ No newline at end of file
+)
+
+# Real-time jitter harness, reports callback latency percentiles instead of throughput
+add_executable(MLCoreJitter ${MLCoreBenchmarksDir}/Jitter.cpp)
+
+target_link_libraries(MLCoreJitter
+PUBLIC
+    MLCoreLib
+)
@@ -0,0 +1,106 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of the bit vector against std::vector<bool>
+ */
+
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/BitVector.hpp>
+
+using namespace Core;
+
+static constexpr std::size_t VoiceCount = 1024;
+
+/** @brief Generate active voice indexes, state.range(0) is the number of active voices */
+static std::vector<std::size_t> MakeActiveVoices(const std::size_t count)
+{
+    std::vector<std::size_t> voices(VoiceCount);
+    std::mt19937 engine(42);
+
+    for (auto i = 0ul; i < VoiceCount; ++i)
+        voices[i] = i;
+    std::shuffle(voices.begin(), voices.end(), engine);
+    voices.resize(count);
+    return voices;
+}
+
+static void VectorBool_IterateActive(benchmark::State &state)
+{
+    std::vector<bool> active(VoiceCount);
+
+    for (const auto voice : MakeActiveVoices(static_cast<std::size_t>(state.range(0))))
+        active[voice] = true;
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        for (auto i = 0ul; i < VoiceCount; ++i) {
+            if (active[i])
+                sum += i;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(VectorBool_IterateActive)->Arg(8)->Arg(64)->Arg(512);
+
+static void BitVector_IterateActive(benchmark::State &state)
+{
+    BitVector active(VoiceCount);
+
+    for (const auto voice : MakeActiveVoices(static_cast<std::size_t>(state.range(0))))
+        active.set(voice);
+    for (auto _ : state) {
+        std::size_t sum = 0;
+        active.forEach([&sum](const std::size_t index) { sum += index; });
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BitVector_IterateActive)->Arg(8)->Arg(64)->Arg(512);
+
+static void VectorBool_Count(benchmark::State &state)
+{
+    std::vector<bool> active(VoiceCount);
+
+    for (const auto voice : MakeActiveVoices(64))
+        active[voice] = true;
+    for (auto _ : state)
+        benchmark::DoNotOptimize(std::count(active.begin(), active.end(), true));
+}
+BENCHMARK(VectorBool_Count);
+
+static void BitVector_Count(benchmark::State &state)
+{
+    BitVector active(VoiceCount);
+
+    for (const auto voice : MakeActiveVoices(64))
+        active.set(voice);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(active.count());
+}
+BENCHMARK(BitVector_Count);
+
+static void VectorBool_And(benchmark::State &state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    std::vector<bool> lhs(size, true), rhs(size, false);
+
+    for (auto _ : state) {
+        for (auto i = 0ul; i < size; ++i)
+            lhs[i] = lhs[i] && rhs[i];
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(VectorBool_And)->Arg(1024)->Arg(1 << 20);
+
+static void BitVector_And(benchmark::State &state)
+{
+    const auto size = static_cast<std::size_t>(state.range(0));
+    BitVector lhs(size, true), rhs(size, false);
+
+    for (auto _ : state) {
+        lhs &= rhs;
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BitVector_And)->Arg(1024)->Arg(1 << 20);
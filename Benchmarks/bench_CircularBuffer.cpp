@@ -0,0 +1,78 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of a delay line built on the circular buffer against modulo indexing
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/CircularBuffer.hpp>
+#include <MLCore/Vector.hpp>
+
+using namespace Core;
+
+static constexpr std::size_t BlockSize = 256;
+static constexpr std::size_t Delay = 12345;
+
+static void DelayLine_Modulo(benchmark::State &state)
+{
+    Vector<float> line(Delay + BlockSize + 1, 0.0f);
+    Vector<float> block(BlockSize, 1.0f);
+    std::size_t head = 0;
+
+    for (auto _ : state) {
+        for (auto &sample : block) {
+            line[head] = sample;
+            sample = line[(head + line.size() - Delay) % line.size()];
+            head = (head + 1) % line.size();
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * BlockSize));
+}
+BENCHMARK(DelayLine_Modulo);
+
+static void DelayLine_Spans(benchmark::State &state)
+{
+    CircularBuffer<float> line(Delay + BlockSize);
+    Vector<float> block(BlockSize, 1.0f);
+
+    for (auto _ : state) {
+        line.write(std::span<const float>(block.data(), BlockSize));
+        line.read(Delay + BlockSize, std::span<float>(block.data(), BlockSize));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * BlockSize));
+}
+BENCHMARK(DelayLine_Spans);
+
+static void DelayLine_MirroredWindow(benchmark::State &state)
+{
+    CircularBuffer<float> line(Delay + BlockSize, CircularBuffer<float>::Mode::Mirrored);
+    Vector<float> block(BlockSize, 1.0f);
+
+    for (auto _ : state) {
+        line.write(std::span<const float>(block.data(), BlockSize));
+        const auto window = line.isMirrored() ? line.window(Delay + BlockSize) : line.data();
+        for (auto i = 0ul; i < BlockSize; ++i)
+            block[i] = window[i] * 0.5f;
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * BlockSize));
+}
+BENCHMARK(DelayLine_MirroredWindow);
+
+static void DelayLine_FractionalCubic(benchmark::State &state)
+{
+    CircularBuffer<float> line(4096);
+    float delay = 100.0f;
+
+    for (auto _ : state) {
+        for (auto i = 0ul; i < BlockSize; ++i) {
+            line.push(1.0f);
+            benchmark::DoNotOptimize(line.readCubic(delay));
+            delay = delay > 3000.0f ? 100.0f : delay + 0.37f;
+        }
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * BlockSize));
+}
+BENCHMARK(DelayLine_FractionalCubic);
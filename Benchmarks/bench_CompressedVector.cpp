@@ -0,0 +1,100 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of the block-compressed vector against raw copies
+ */
+
+#include <cmath>
+#include <cstring>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/CompressedVector.hpp>
+
+using namespace Core;
+
+/** @brief Number of samples, large enough to live out of cache (16 MiB of raw int16) */
+static constexpr std::size_t SampleCount = 8 * 1024 * 1024;
+
+/** @brief Mix of two sines and noise, quantized to 16 bits */
+static const Vector<std::int16_t> &Samples(void)
+{
+    static const auto Samples = [] {
+        Vector<std::int16_t> samples;
+        std::mt19937 random(42);
+        std::normal_distribution<double> noise(0.0, 30.0);
+        samples.reserve(SampleCount);
+        for (auto i = 0ul; i < SampleCount; ++i) {
+            const auto t = static_cast<double>(i);
+            samples.push(static_cast<std::int16_t>(std::sin(t * 0.013) * 12000.0 + std::sin(t * 0.0007) * 6000.0 + noise(random)));
+        }
+        return samples;
+    }();
+    return Samples;
+}
+
+/** @brief Baseline : copy the raw samples, the memory bandwidth bound */
+static void CompressedVector_RawCopy(benchmark::State &state)
+{
+    const auto &samples = Samples();
+    Vector<std::int16_t> out;
+    out.resizeUninitialized(4096);
+
+    for (auto _ : state) {
+        for (auto offset = 0ul; offset < samples.size(); offset += 4096)
+            std::memcpy(out.data(), samples.data() + offset, 4096 * sizeof(std::int16_t));
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * samples.size() * sizeof(std::int16_t)));
+}
+BENCHMARK(CompressedVector_RawCopy)->Unit(benchmark::kMillisecond);
+
+/** @brief Stream the whole vector through the decoder, bytes are counted on the decoded side */
+template<std::size_t BlockSize>
+static void CompressedVector_Decode(benchmark::State &state)
+{
+    const auto &samples = Samples();
+    const CompressedVector<std::int16_t, BlockSize> vector(std::span<const std::int16_t>(samples.begin(), samples.end()));
+    Vector<std::int16_t> out;
+    out.resizeUninitialized(BlockSize);
+
+    for (auto _ : state) {
+        for (auto block = 0ul; block < vector.blockCount(); ++block)
+            vector.decodeBlock(block, out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * samples.size() * sizeof(std::int16_t)));
+    state.counters["ratio"] = static_cast<double>(vector.uncompressedBytes()) / static_cast<double>(vector.compressedBytes());
+}
+BENCHMARK_TEMPLATE(CompressedVector_Decode, 256)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(CompressedVector_Decode, 512)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(CompressedVector_Decode, 1024)->Unit(benchmark::kMillisecond);
+
+static void CompressedVector_Encode(benchmark::State &state)
+{
+    const auto &samples = Samples();
+
+    for (auto _ : state) {
+        CompressedVector<std::int16_t> vector(std::span<const std::int16_t>(samples.begin(), samples.end()));
+        benchmark::DoNotOptimize(vector);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * samples.size() * sizeof(std::int16_t)));
+}
+BENCHMARK(CompressedVector_Encode)->Unit(benchmark::kMillisecond);
+
+/** @brief Read 64 samples windows at random positions through a cached reader */
+static void CompressedVector_ReaderRandom(benchmark::State &state)
+{
+    const auto &samples = Samples();
+    const CompressedVector<std::int16_t> vector(std::span<const std::int16_t>(samples.begin(), samples.end()));
+    CompressedVector<std::int16_t>::Reader reader(vector, 4);
+    std::mt19937_64 random(1);
+    std::int16_t window[64];
+
+    for (auto _ : state) {
+        reader.read(random() % (samples.size() - 64), window);
+        benchmark::DoNotOptimize(window);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(CompressedVector_ReaderRandom);
@@ -0,0 +1,73 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of the event buffer k-way merge against concatenation + std::sort
+ */
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/EventBuffer.hpp>
+
+using namespace Core;
+
+namespace
+{
+    struct Event
+    {
+        std::uint32_t timestamp;
+        std::uint8_t status;
+        std::uint8_t data1;
+        std::uint8_t data2;
+        std::uint8_t port;
+    };
+
+    /** @brief Sorted runs of 'state.range(1)' events from 'state.range(0)' producers over a 512 samples block */
+    Vector<Vector<Event>> MakeRuns(const benchmark::State &state)
+    {
+        std::mt19937 engine(42);
+        Vector<Vector<Event>> runs;
+
+        for (auto producer = 0; producer < state.range(0); ++producer) {
+            auto &run = runs.push();
+            for (auto i = 0; i < state.range(1); ++i)
+                run.push(Event { static_cast<std::uint32_t>(engine() % 512), 0x90, 60, 100, static_cast<std::uint8_t>(producer) });
+            std::sort(run.begin(), run.end(), [](const Event &lhs, const Event &rhs) { return lhs.timestamp < rhs.timestamp; });
+        }
+        return runs;
+    }
+}
+
+static void Events_ConcatSort(benchmark::State &state)
+{
+    const auto runs = MakeRuns(state);
+    Vector<Event> events;
+
+    events.reserve(static_cast<std::size_t>(state.range(0) * state.range(1)));
+    for (auto _ : state) {
+        events.clear();
+        for (const auto &run : runs)
+            events.append(run.begin(), run.end());
+        std::stable_sort(events.begin(), events.end(), [](const Event &lhs, const Event &rhs) { return lhs.timestamp < rhs.timestamp; });
+        benchmark::DoNotOptimize(events.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * state.range(0) * state.range(1)));
+}
+BENCHMARK(Events_ConcatSort)->ArgNames({ "producers", "events" })->Args({ 4, 32 })->Args({ 16, 64 })->Args({ 64, 16 });
+
+static void Events_EventBufferMerge(benchmark::State &state)
+{
+    const auto runs = MakeRuns(state);
+    EventBuffer<Event> events;
+
+    events.reserve(static_cast<std::size_t>(state.range(0) * state.range(1)));
+    for (auto _ : state) {
+        events.clear();
+        for (const auto &run : runs)
+            events.appendRun(std::span<const Event>(run.data(), run.size()));
+        events.merge();
+        benchmark::DoNotOptimize(events.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * state.range(0) * state.range(1)));
+}
+BENCHMARK(Events_EventBufferMerge)->ArgNames({ "producers", "events" })->Args({ 4, 32 })->Args({ 16, 64 })->Args({ 64, 16 });
@@ -0,0 +1,76 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of the huge page allocator against std::malloc
+ */
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/Vector.hpp>
+#include <MLCore/HugePageAllocator.hpp>
+
+using namespace Core;
+
+using MallocBuffer = Vector<float>;
+using HugeBuffer = Vector<float, std::size_t, GrowthPolicy::Default, HugePageAllocator<>>;
+
+template<typename Buffer>
+static Buffer MakeBuffer(const std::size_t count)
+{
+    Buffer buffer;
+
+    buffer.resizeUninitialized(count);
+    for (auto i = 0ul; i < count; ++i)
+        buffer[i] = static_cast<float>(i);
+    return buffer;
+}
+
+template<typename Buffer>
+static void Streaming(benchmark::State &state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0)) * 1024ul * 1024ul / sizeof(float);
+    const auto buffer = MakeBuffer<Buffer>(count);
+
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto value : buffer)
+            sum += value;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * count * sizeof(float)));
+}
+
+template<typename Buffer>
+static void RandomAccess(benchmark::State &state)
+{
+    constexpr auto accessCount = 1024ul * 1024ul;
+    const auto count = static_cast<std::size_t>(state.range(0)) * 1024ul * 1024ul / sizeof(float);
+    const auto buffer = MakeBuffer<Buffer>(count);
+    Vector<std::uint32_t> indexes;
+    std::mt19937 engine(42);
+    std::uniform_int_distribution<std::uint32_t> distribution(0, static_cast<std::uint32_t>(count - 1));
+
+    indexes.resizeUninitialized(accessCount);
+    for (auto &index : indexes)
+        index = distribution(engine);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto index : indexes)
+            sum += buffer[index];
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * accessCount));
+}
+
+static void Malloc_Streaming(benchmark::State &state) { Streaming<MallocBuffer>(state); }
+BENCHMARK(Malloc_Streaming)->Arg(64)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+static void HugePage_Streaming(benchmark::State &state) { Streaming<HugeBuffer>(state); }
+BENCHMARK(HugePage_Streaming)->Arg(64)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+static void Malloc_RandomAccess(benchmark::State &state) { RandomAccess<MallocBuffer>(state); }
+BENCHMARK(Malloc_RandomAccess)->Arg(64)->Arg(1024)->Unit(benchmark::kMillisecond);
+
+static void HugePage_RandomAccess(benchmark::State &state) { RandomAccess<HugeBuffer>(state); }
+BENCHMARK(HugePage_RandomAccess)->Arg(64)->Arg(1024)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,80 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of the inline function wrappers against std::function
+ */
+
+#include <array>
+#include <functional>
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/InplaceFunction.hpp>
+
+using namespace Core;
+
+namespace
+{
+    /** @brief Capture of 4 pointers, too large for the small buffer of std::function */
+    struct Capture
+    {
+        float *output;
+        const float *input;
+        const float *gain;
+        std::size_t *frame;
+
+        void operator()(const std::size_t index) const noexcept { output[index & 15] += input[index & 15] * *gain; ++*frame; }
+    };
+}
+
+template<typename Function>
+static void Function_Construct(benchmark::State &state)
+{
+    float output[16] {}, input[16] {}, gain = 1.0f;
+    std::size_t frame = 0;
+
+    for (auto _ : state) {
+        Function function(Capture { output, input, &gain, &frame });
+        benchmark::DoNotOptimize(function);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(Function_Construct, std::function<void(std::size_t)>);
+BENCHMARK_TEMPLATE(Function_Construct, InplaceFunction<void(std::size_t)>);
+BENCHMARK_TEMPLATE(Function_Construct, TrivialFunction<void(std::size_t)>);
+
+template<typename Function>
+static void Function_Invoke(benchmark::State &state)
+{
+    float output[16] {}, input[16] {}, gain = 1.0f;
+    std::size_t frame = 0;
+    Function function(Capture { output, input, &gain, &frame });
+    benchmark::DoNotOptimize(function);
+    std::size_t index = 0;
+
+    for (auto _ : state)
+        function(index++);
+    benchmark::DoNotOptimize(output);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(Function_Invoke, std::function<void(std::size_t)>);
+BENCHMARK_TEMPLATE(Function_Invoke, InplaceFunction<void(std::size_t)>);
+BENCHMARK_TEMPLATE(Function_Invoke, TrivialFunction<void(std::size_t)>);
+
+template<typename Function>
+static void Function_Move(benchmark::State &state)
+{
+    float output[16] {}, input[16] {}, gain = 1.0f;
+    std::size_t frame = 0;
+    std::array<Function, 2> functions { Function(Capture { output, input, &gain, &frame }), Function() };
+    std::size_t index = 0;
+
+    for (auto _ : state) {
+        functions[~index & 1] = std::move(functions[index & 1]);
+        benchmark::DoNotOptimize(functions);
+        ++index;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(Function_Move, std::function<void(std::size_t)>);
+BENCHMARK_TEMPLATE(Function_Move, InplaceFunction<void(std::size_t)>);
+BENCHMARK_TEMPLATE(Function_Move, TrivialFunction<void(std::size_t)>);
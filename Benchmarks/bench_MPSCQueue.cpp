@@ -0,0 +1,107 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of the intrusive MPSC queue against a mutex protected vector
+ */
+
+#include <mutex>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/MPSCQueue.hpp>
+#include <MLCore/NodePool.hpp>
+#include <MLCore/Vector.hpp>
+
+using namespace Core;
+
+static constexpr std::uint32_t CommandCount = 100000;
+
+namespace
+{
+    struct Command : MPSCQueueNode
+    {
+        std::uint32_t value {};
+    };
+}
+
+/** @brief Producers push pooled nodes, the consumer pops and recycles them */
+static void MPSCQueue_NodePool(benchmark::State &state)
+{
+    const auto producerCount = static_cast<std::uint32_t>(state.range(0));
+    MPSCQueue<Command> queue;
+    NodePool<Command> pool(1024);
+
+    for (auto _ : state) {
+        Vector<std::thread> producers;
+        producers.reserve(producerCount);
+        for (auto p = 0u; p < producerCount; ++p) {
+            producers.push([&queue, &pool] {
+                for (auto i = 0u; i < CommandCount; ++i) {
+                    Command *command;
+                    while (!(command = pool.acquire()))
+                        std::this_thread::yield();
+                    command->value = i;
+                    queue.push(command);
+                }
+            });
+        }
+        std::uint64_t sum = 0;
+        for (auto received = 0u; received < producerCount * CommandCount;) {
+            if (const auto command = queue.pop(); command) {
+                sum += command->value;
+                pool.release(command);
+                ++received;
+            } else
+                std::this_thread::yield();
+        }
+        for (auto &producer : producers)
+            producer.join();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * producerCount * CommandCount));
+}
+BENCHMARK(MPSCQueue_NodePool)->Arg(1)->Arg(2)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+/** @brief Producers push under a mutex, the consumer swaps the whole vector out under the same mutex */
+static void MPSCQueue_Mutex(benchmark::State &state)
+{
+    const auto producerCount = static_cast<std::uint32_t>(state.range(0));
+    std::mutex mutex;
+    Vector<std::uint32_t> pending;
+    Vector<std::uint32_t> consumed;
+
+    pending.reserve(1024);
+    consumed.reserve(1024);
+    for (auto _ : state) {
+        Vector<std::thread> producers;
+        producers.reserve(producerCount);
+        for (auto p = 0u; p < producerCount; ++p) {
+            producers.push([&mutex, &pending] {
+                for (auto i = 0u; i < CommandCount; ++i) {
+                    std::lock_guard lock(mutex);
+                    pending.push(i);
+                }
+            });
+        }
+        std::uint64_t sum = 0;
+        for (auto received = 0u; received < producerCount * CommandCount;) {
+            {
+                std::lock_guard lock(mutex);
+                pending.swap(consumed);
+            }
+            if (consumed.empty()) {
+                std::this_thread::yield();
+                continue;
+            }
+            for (const auto value : consumed)
+                sum += value;
+            received += static_cast<std::uint32_t>(consumed.size());
+            consumed.clear();
+        }
+        for (auto &producer : producers)
+            producer.join();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * producerCount * CommandCount));
+}
+BENCHMARK(MPSCQueue_Mutex)->Arg(1)->Arg(2)->Arg(4)->UseRealTime()->Unit(benchmark::kMillisecond);
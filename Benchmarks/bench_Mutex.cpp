@@ -0,0 +1,104 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of the spin / adaptive mutexes and wake-up latency against std::mutex and std::condition_variable
+ */
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/Mutex.hpp>
+
+using namespace Core;
+
+/** @brief Lock / unlock on a single thread */
+template<typename Mutex>
+static void Mutex_Uncontended(benchmark::State &state)
+{
+    Mutex mutex;
+
+    for (auto _ : state) {
+        mutex.lock();
+        benchmark::ClobberMemory();
+        mutex.unlock();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(Mutex_Uncontended, std::mutex);
+BENCHMARK_TEMPLATE(Mutex_Uncontended, SpinMutex);
+BENCHMARK_TEMPLATE(Mutex_Uncontended, AdaptiveMutex);
+
+/** @brief Every thread increments a shared counter under the lock */
+template<typename Mutex>
+static void Mutex_Contended(benchmark::State &state)
+{
+    static Mutex SharedMutex;
+    static std::size_t Counter = 0;
+
+    for (auto _ : state) {
+        std::lock_guard lock(SharedMutex);
+        benchmark::DoNotOptimize(++Counter);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(Mutex_Contended, std::mutex)->ThreadRange(2, 4)->UseRealTime();
+BENCHMARK_TEMPLATE(Mutex_Contended, SpinMutex)->ThreadRange(2, 4)->UseRealTime();
+BENCHMARK_TEMPLATE(Mutex_Contended, AdaptiveMutex)->ThreadRange(2, 4)->UseRealTime();
+
+namespace
+{
+    /** @brief Binary signal built on std::mutex + std::condition_variable */
+    class ConditionSignal
+    {
+    public:
+        void release(void) noexcept
+        {
+            {
+                std::lock_guard lock(_mutex);
+                _signaled = true;
+            }
+            _condition.notify_one();
+        }
+
+        void acquire(void) noexcept
+        {
+            std::unique_lock lock(_mutex);
+            _condition.wait(lock, [this] { return _signaled; });
+            _signaled = false;
+        }
+
+    private:
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        bool _signaled { false };
+    };
+}
+
+/** @brief Round trip wake-up latency: the benchmark thread wakes a worker that wakes it back */
+template<typename Signal>
+static void Mutex_WakeRoundTrip(benchmark::State &state)
+{
+    Signal ping, pong;
+    std::atomic<bool> stop { false };
+    std::thread worker([&] {
+        while (true) {
+            ping.acquire();
+            if (stop.load(std::memory_order_relaxed))
+                break;
+            pong.release();
+        }
+    });
+
+    for (auto _ : state) {
+        ping.release();
+        pong.acquire();
+    }
+    stop.store(true, std::memory_order_relaxed);
+    ping.release();
+    worker.join();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(Mutex_WakeRoundTrip, ConditionSignal)->UseRealTime();
+BENCHMARK_TEMPLATE(Mutex_WakeRoundTrip, Semaphore)->UseRealTime();
@@ -0,0 +1,94 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Scaling benchmark of the parallel algorithms (1 to N threads)
+ */
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/Parallel.hpp>
+
+using namespace Core;
+
+static Vector<float> MakeInput(const std::size_t count)
+{
+    Vector<float> input;
+    std::mt19937 engine(42);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+    input.resizeUninitialized(count);
+    for (auto &value : input)
+        value = distribution(engine);
+    return input;
+}
+
+static void ThreadCounts(benchmark::internal::Benchmark *benchmark)
+{
+    const auto maxThreads = std::max(std::thread::hardware_concurrency(), 1u);
+
+    for (auto threads = 1u; threads < maxThreads; threads *= 2)
+        benchmark->Arg(threads);
+    benchmark->Arg(maxThreads);
+    benchmark->Unit(benchmark::kMillisecond)->UseRealTime();
+}
+
+static constexpr std::size_t ElementCount = 16ul * 1024ul * 1024ul;
+
+static void Parallel_Transform(benchmark::State &state)
+{
+    ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+    const auto input = MakeInput(ElementCount);
+    Vector<float> output;
+
+    output.resizeUninitialized(ElementCount);
+    for (auto _ : state) {
+        Parallel::Transform(input.begin(), input.end(), output.begin(), [](const float value) { return value * 0.5f + 1.0f; }, pool);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * ElementCount * sizeof(float) * 2));
+}
+BENCHMARK(Parallel_Transform)->Apply(ThreadCounts);
+
+static void Parallel_Reduce(benchmark::State &state)
+{
+    ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+    const auto input = MakeInput(ElementCount);
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Parallel::Reduce(input.begin(), input.end(), 0.0, std::plus<>(), pool));
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * ElementCount * sizeof(float)));
+}
+BENCHMARK(Parallel_Reduce)->Apply(ThreadCounts);
+
+static void Parallel_InclusiveScan(benchmark::State &state)
+{
+    ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+    const auto input = MakeInput(ElementCount);
+    Vector<float> output;
+
+    output.resizeUninitialized(ElementCount);
+    for (auto _ : state) {
+        Parallel::InclusiveScan(input.begin(), input.end(), output.begin(), std::plus<>(), pool);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * ElementCount * sizeof(float) * 2));
+}
+BENCHMARK(Parallel_InclusiveScan)->Apply(ThreadCounts);
+
+static void Parallel_Sort(benchmark::State &state)
+{
+    ThreadPool pool(static_cast<std::size_t>(state.range(0)));
+    const auto input = MakeInput(ElementCount / 4);
+    Vector<float> values;
+
+    values.resizeUninitialized(input.size());
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::copy(input.begin(), input.end(), values.begin());
+        state.ResumeTiming();
+        Parallel::Sort(values.begin(), values.end(), std::less<>(), pool);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+}
+BENCHMARK(Parallel_Sort)->Apply(ThreadCounts);
@@ -0,0 +1,112 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of the thread-caching pool allocator against malloc and std::pmr::synchronized_pool_resource
+ */
+
+#include <array>
+#include <memory_resource>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/PoolAllocator.hpp>
+#include <MLCore/SPSCQueue.hpp>
+
+using namespace Core;
+
+namespace
+{
+    struct SynchronizedPoolAllocator
+    {
+        [[nodiscard]] static std::pmr::synchronized_pool_resource &Resource(void) noexcept
+        {
+            static std::pmr::synchronized_pool_resource Pool;
+            return Pool;
+        }
+
+        [[nodiscard]] static void *Allocate(const std::size_t bytes) noexcept { return Resource().allocate(bytes); }
+        static void Deallocate(void * const data, const std::size_t bytes) noexcept { Resource().deallocate(data, bytes); }
+    };
+
+    /** @brief Block passed from the producer to the consumer */
+    struct Block
+    {
+        void *data {};
+        std::size_t size {};
+    };
+
+    /** @brief Pseudo-random block sizes in [16, 1024] */
+    [[nodiscard]] const std::array<std::uint16_t, 4096> &Sizes(void) noexcept
+    {
+        static const auto Table = [] {
+            std::array<std::uint16_t, 4096> sizes {};
+            std::uint32_t state = 0x12345678u;
+            for (auto &size : sizes) {
+                state = state * 1664525u + 1013904223u;
+                size = static_cast<std::uint16_t>(16 + (state >> 16) % 1009);
+            }
+            return sizes;
+        }();
+        return Table;
+    }
+}
+
+/** @brief Each thread keeps a window of live blocks and replaces one per iteration */
+template<typename Allocator>
+static void Allocator_Churn(benchmark::State &state)
+{
+    constexpr std::size_t Window = 256;
+    const auto &sizes = Sizes();
+    std::array<void *, Window> live {};
+    std::array<std::size_t, Window> liveSizes {};
+    std::size_t index = static_cast<std::size_t>(state.thread_index()) * 97;
+
+    for (auto i = 0ul; i < Window; ++i) {
+        liveSizes[i] = sizes[index++ % sizes.size()];
+        live[i] = Allocator::Allocate(liveSizes[i]);
+    }
+    for (auto _ : state) {
+        const auto slot = index % Window;
+        Allocator::Deallocate(live[slot], liveSizes[slot]);
+        liveSizes[slot] = sizes[index++ % sizes.size()];
+        live[slot] = Allocator::Allocate(liveSizes[slot]);
+        benchmark::DoNotOptimize(live[slot]);
+    }
+    for (auto i = 0ul; i < Window; ++i)
+        Allocator::Deallocate(live[i], liveSizes[i]);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(Allocator_Churn, MallocAllocator)->ThreadRange(1, 4)->UseRealTime();
+BENCHMARK_TEMPLATE(Allocator_Churn, PoolAllocator)->ThreadRange(1, 4)->UseRealTime();
+BENCHMARK_TEMPLATE(Allocator_Churn, SynchronizedPoolAllocator)->ThreadRange(1, 4)->UseRealTime();
+
+/** @brief A producer thread allocates blocks that the benchmark thread frees */
+template<typename Allocator>
+static void Allocator_ProducerConsumer(benchmark::State &state)
+{
+    constexpr std::size_t Count = 100000;
+    const auto &sizes = Sizes();
+
+    for (auto _ : state) {
+        SPSCQueue<Block> queue(1024);
+        std::thread producer([&queue, &sizes] {
+            for (auto i = 0ul; i < Count; ++i) {
+                const std::size_t size = sizes[i % sizes.size()];
+                const auto block = Allocator::Allocate(size);
+                while (!queue.push(Block { block, size }))
+                    std::this_thread::yield();
+            }
+        });
+        for (auto i = 0ul; i < Count; ++i) {
+            Block block;
+            while (!queue.pop(block))
+                std::this_thread::yield();
+            Allocator::Deallocate(block.data, block.size);
+        }
+        producer.join();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * Count));
+}
+BENCHMARK_TEMPLATE(Allocator_ProducerConsumer, MallocAllocator)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(Allocator_ProducerConsumer, PoolAllocator)->UseRealTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(Allocator_ProducerConsumer, SynchronizedPoolAllocator)->UseRealTime()->Unit(benchmark::kMillisecond);
@@ -0,0 +1,104 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of the radix sort against std::sort / std::stable_sort
+ */
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/RadixSort.hpp>
+
+using namespace Core;
+
+namespace
+{
+    struct Event
+    {
+        std::uint64_t timestamp;
+        std::uint32_t note;
+        float velocity;
+    };
+}
+
+static Vector<Event> MakeEvents(const std::size_t count)
+{
+    Vector<Event> events;
+    std::mt19937_64 engine(42);
+    std::uniform_int_distribution<std::uint64_t> distribution(0, 48000ul * 60ul * 10ul);
+
+    events.reserve(count);
+    for (auto i = 0ul; i < count; ++i)
+        events.push(Event { distribution(engine), static_cast<std::uint32_t>(i & 127), 0.5f });
+    return events;
+}
+
+template<typename Sort>
+static void SortEvents(benchmark::State &state, Sort &&sort)
+{
+    const auto input = MakeEvents(static_cast<std::size_t>(state.range(0)));
+    Vector<Event> events;
+
+    events.resizeUninitialized(input.size());
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::copy(input.begin(), input.end(), events.begin());
+        state.ResumeTiming();
+        sort(events);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+}
+
+static bool CompareEvents(const Event &lhs, const Event &rhs) noexcept { return lhs.timestamp < rhs.timestamp; }
+
+static void Events_StdSort(benchmark::State &state)
+{
+    SortEvents(state, [](auto &events) { std::sort(events.begin(), events.end(), &CompareEvents); });
+}
+BENCHMARK(Events_StdSort)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 22)->Unit(benchmark::kMillisecond);
+
+static void Events_StdStableSort(benchmark::State &state)
+{
+    SortEvents(state, [](auto &events) { std::stable_sort(events.begin(), events.end(), &CompareEvents); });
+}
+BENCHMARK(Events_StdStableSort)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 22)->Unit(benchmark::kMillisecond);
+
+static void Events_RadixSort(benchmark::State &state)
+{
+    SortEvents(state, [](auto &events) {
+        RadixSort(events.begin(), events.end(), [](const Event &event) { return event.timestamp; });
+    });
+}
+BENCHMARK(Events_RadixSort)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 22)->Unit(benchmark::kMillisecond);
+
+static void Events_RadixSortParallel(benchmark::State &state)
+{
+    SortEvents(state, [](auto &events) {
+        RadixSort(events.begin(), events.end(), [](const Event &event) { return event.timestamp; }, &ThreadPool::Default());
+    });
+}
+BENCHMARK(Events_RadixSortParallel)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 22)->Unit(benchmark::kMillisecond);
+
+static void Floats_Sort(benchmark::State &state)
+{
+    Vector<float> input;
+    std::mt19937 engine(42);
+    std::normal_distribution<float> distribution(0.0f, 1.0f);
+    Vector<float> values;
+
+    input.resizeUninitialized(static_cast<std::size_t>(state.range(0)));
+    for (auto &value : input)
+        value = distribution(engine);
+    values.resizeUninitialized(input.size());
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::copy(input.begin(), input.end(), values.begin());
+        state.ResumeTiming();
+        if (state.range(1))
+            RadixSort(values.begin(), values.end());
+        else
+            std::sort(values.begin(), values.end());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * input.size()));
+}
+BENCHMARK(Floats_Sort)->ArgNames({ "count", "radix" })->Args({ 1 << 20, 0 })->Args({ 1 << 20, 1 })->Unit(benchmark::kMillisecond);
@@ -0,0 +1,96 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of the slot map against a plain Vector
+ */
+
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/SlotMap.hpp>
+
+using namespace Core;
+
+namespace
+{
+    struct Node
+    {
+        float gain;
+        float pan;
+        std::uint32_t flags;
+        std::uint32_t id;
+    };
+}
+
+static void Vector_Iterate(benchmark::State &state)
+{
+    Vector<Node> nodes;
+
+    for (auto i = 0u; i < static_cast<std::uint32_t>(state.range(0)); ++i)
+        nodes.push(Node { 1.0f, 0.0f, 0u, i });
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto &node : nodes)
+            sum += node.gain * node.pan;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * nodes.size()));
+}
+BENCHMARK(Vector_Iterate)->Arg(1024)->Arg(1 << 16);
+
+static void SlotMap_Iterate(benchmark::State &state)
+{
+    SlotMap<Node> nodes;
+    Vector<SlotMap<Node>::Handle> handles;
+
+    // Erase half of the nodes so the dense storage went through swap-and-pop
+    for (auto i = 0u; i < static_cast<std::uint32_t>(state.range(0)) * 2; ++i)
+        handles.push(nodes.insert(Node { 1.0f, 0.0f, 0u, i }));
+    for (auto i = 0ul; i < handles.size(); i += 2)
+        nodes.erase(handles[i]);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto &node : nodes)
+            sum += node.gain * node.pan;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * nodes.size()));
+}
+BENCHMARK(SlotMap_Iterate)->Arg(1024)->Arg(1 << 16);
+
+static void SlotMap_Lookup(benchmark::State &state)
+{
+    SlotMap<Node> nodes;
+    Vector<SlotMap<Node>::Handle> handles;
+    std::mt19937 engine(42);
+
+    for (auto i = 0u; i < static_cast<std::uint32_t>(state.range(0)); ++i)
+        handles.push(nodes.insert(Node { 1.0f, 0.0f, 0u, i }));
+    std::shuffle(handles.begin(), handles.end(), engine);
+    for (auto _ : state) {
+        std::uint32_t sum = 0;
+        for (const auto handle : handles)
+            sum += nodes[handle].id;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * handles.size()));
+}
+BENCHMARK(SlotMap_Lookup)->Arg(1024)->Arg(1 << 16);
+
+static void SlotMap_InsertErase(benchmark::State &state)
+{
+    SlotMap<Node> nodes;
+    Vector<SlotMap<Node>::Handle> handles;
+
+    nodes.reserve(static_cast<std::size_t>(state.range(0)));
+    handles.reserve(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        for (auto i = 0u; i < static_cast<std::uint32_t>(state.range(0)); ++i)
+            handles.push(nodes.insert(Node { 1.0f, 0.0f, 0u, i }));
+        for (const auto handle : handles)
+            nodes.erase(handle);
+        handles.clear();
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * state.range(0)));
+}
+BENCHMARK(SlotMap_InsertErase)->Arg(1024);
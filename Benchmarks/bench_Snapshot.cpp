@@ -0,0 +1,101 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of the snapshot reader path against std::atomic<std::shared_ptr> and a mutex
+ */
+
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/Snapshot.hpp>
+
+using namespace Core;
+
+namespace
+{
+    struct Routing
+    {
+        std::size_t inputs[16] {};
+        std::size_t outputs[16] {};
+    };
+
+    /** @brief Background writer publishing a new version every 'period' */
+    template<typename Publish>
+    class Writer
+    {
+    public:
+        Writer(Publish &&publish) noexcept
+            : _thread([this, publish = std::move(publish)] {
+                while (!_stop.load(std::memory_order_relaxed)) {
+                    publish();
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+            }) {}
+
+        ~Writer(void) noexcept
+        {
+            _stop = true;
+            _thread.join();
+        }
+
+    private:
+        std::atomic<bool> _stop { false };
+        std::thread _thread;
+    };
+}
+
+static void Snapshot_Read(benchmark::State &state)
+{
+    Snapshot<Routing> snapshot(std::make_unique<Routing>());
+    Writer writer([&snapshot] { snapshot.emplace(); });
+    auto reader = snapshot.registerReader();
+    std::size_t index = 0;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(reader->inputs[index++ & 15]);
+        if (!(index & 63))
+            reader.quiescent();
+    }
+    reader.offline();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Snapshot_Read);
+
+static void Snapshot_AtomicSharedPtrRead(benchmark::State &state)
+{
+    std::atomic<std::shared_ptr<const Routing>> current { std::make_shared<const Routing>() };
+    Writer writer([&current] { current.store(std::make_shared<const Routing>()); });
+    std::size_t index = 0;
+
+    for (auto _ : state) {
+        const auto routing = current.load(std::memory_order_acquire);
+        benchmark::DoNotOptimize(routing->inputs[index++ & 15]);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Snapshot_AtomicSharedPtrRead);
+
+static void Snapshot_MutexSharedPtrRead(benchmark::State &state)
+{
+    std::mutex mutex;
+    std::shared_ptr<const Routing> current = std::make_shared<const Routing>();
+    Writer writer([&mutex, &current] {
+        auto next = std::make_shared<const Routing>();
+        std::lock_guard lock(mutex);
+        current.swap(next);
+    });
+    std::size_t index = 0;
+
+    for (auto _ : state) {
+        std::shared_ptr<const Routing> routing;
+        {
+            std::lock_guard lock(mutex);
+            routing = current;
+        }
+        benchmark::DoNotOptimize(routing->inputs[index++ & 15]);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Snapshot_MutexSharedPtrRead);
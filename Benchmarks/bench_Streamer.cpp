@@ -0,0 +1,84 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of the asynchronous streamer against synchronous reads of a local file
+ */
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include <unistd.h>
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/Streamer.hpp>
+
+using namespace Core;
+
+static constexpr std::size_t FileSize = 256ul * 1024ul * 1024ul;
+
+static const std::filesystem::path &BenchFile(void)
+{
+    static const auto Path = [] {
+        const auto path = std::filesystem::temp_directory_path() / "MLCoreStreamerBench.bin";
+        if (!std::filesystem::exists(path) || std::filesystem::file_size(path) != FileSize) {
+            std::ofstream file(path, std::ios::binary);
+            Vector<char> chunk(1024 * 1024, 'x');
+            for (auto i = 0ul; i < FileSize / chunk.size(); ++i)
+                file.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+        }
+        return path;
+    }();
+    return Path;
+}
+
+/** @brief Simulated per-block processing so that I/O can overlap with work */
+static std::uint64_t Process(const std::uint8_t *data, const std::size_t size)
+{
+    std::uint64_t sum = 0;
+
+    for (auto i = 0ul; i < size; i += 64)
+        sum += data[i];
+    return sum;
+}
+
+static void Synchronous_Read(benchmark::State &state)
+{
+    const auto blockSize = static_cast<std::size_t>(state.range(0)) * 1024;
+    Vector<std::uint8_t> buffer;
+
+    buffer.resizeUninitialized(blockSize);
+    for (auto _ : state) {
+        const auto file = std::fopen(BenchFile().c_str(), "rb");
+        std::uint64_t sum = 0;
+        while (const auto count = std::fread(buffer.data(), 1, blockSize, file))
+            sum += Process(buffer.data(), count);
+        std::fclose(file);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * FileSize));
+}
+BENCHMARK(Synchronous_Read)->Arg(64)->Arg(1024)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void Streamer_Read(benchmark::State &state)
+{
+    Streamer streamer(Streamer::Config { static_cast<std::size_t>(state.range(0)) * 1024, static_cast<std::size_t>(state.range(1)) });
+
+    for (auto _ : state) {
+        static_cast<void>(streamer.open(BenchFile().c_str()));
+        std::uint64_t sum = 0;
+        while (!streamer.endOfStream()) {
+            if (const auto block = streamer.acquire(); block) {
+                sum += Process(block->data, block->size);
+                streamer.release(block);
+            } else
+                std::this_thread::yield();
+        }
+        streamer.close();
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * FileSize));
+}
+BENCHMARK(Streamer_Read)->ArgNames({ "blockKiB", "readAhead" })
+    ->Args({ 64, 4 })->Args({ 1024, 4 })->Args({ 1024, 16 })->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,87 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of coroutine tasks (per-task overhead and parallel decoding)
+ */
+
+#include <cmath>
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/Task.hpp>
+#include <MLCore/ThreadPool.hpp>
+
+using namespace Core;
+
+static Task<int> Leaf(const int value)
+{
+    co_return value + 1;
+}
+
+static Task<int> Chain(const int count)
+{
+    int sum = 0;
+    for (auto i = 0; i < count; ++i)
+        sum += co_await Leaf(i);
+    co_return sum;
+}
+
+/** @brief Cost of creating, awaiting and destroying a task (frames come from the pool) */
+static void Task_Await(benchmark::State &state)
+{
+    const auto count = static_cast<int>(state.range(0));
+
+    for (auto _ : state)
+        benchmark::DoNotOptimize(SyncWait(Chain(count)));
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(Task_Await)->Arg(1 << 16);
+
+/** @brief Simulated decoding of a file */
+static double Decode(const std::size_t file, const std::size_t samples)
+{
+    double sum = 0.0;
+    for (auto i = 0ul; i < samples; ++i)
+        sum += std::sin(static_cast<double>(file + i) * 0.001);
+    return sum;
+}
+
+static Task<double> DecodeTask(Executor &executor, const std::size_t file, const std::size_t samples)
+{
+    co_await executor.schedule();
+    co_return Decode(file, samples);
+}
+
+/** @brief Decode files concurrently with WhenAll on a PoolExecutor */
+static void Task_WhenAllDecode(benchmark::State &state)
+{
+    const auto files = static_cast<std::size_t>(state.range(0));
+    const auto samples = static_cast<std::size_t>(state.range(1));
+    auto &executor = PoolExecutor::Default();
+
+    for (auto _ : state) {
+        Vector<Task<double>> tasks;
+        tasks.reserve(files);
+        for (auto i = 0ul; i < files; ++i)
+            tasks.push(DecodeTask(executor, i, samples));
+        benchmark::DoNotOptimize(SyncWait(WhenAll(std::move(tasks))));
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * files));
+}
+BENCHMARK(Task_WhenAllDecode)->Args({ 256, 64 })->Args({ 256, 16384 })->UseRealTime();
+
+/** @brief Same decoding with a fork-join dispatch */
+static void ThreadPool_Decode(benchmark::State &state)
+{
+    const auto files = static_cast<std::size_t>(state.range(0));
+    const auto samples = static_cast<std::size_t>(state.range(1));
+    Vector<double> results(files, 0.0);
+
+    for (auto _ : state) {
+        ThreadPool::Default().dispatch(files, [&results, samples](const std::size_t index) {
+            results[index] = Decode(index, samples);
+        });
+        benchmark::DoNotOptimize(results.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * files));
+}
+BENCHMARK(ThreadPool_Decode)->Args({ 256, 64 })->Args({ 256, 16384 })->UseRealTime();
@@ -0,0 +1,99 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmark of the batch erase helpers of Vector against repeated erase calls
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <MLCore/Vector.hpp>
+
+using namespace Core;
+
+namespace
+{
+    struct Voice
+    {
+        float phase;
+        float gain;
+        std::uint32_t note;
+        std::uint32_t finished;
+    };
+
+    /** @brief Build 'count' voices where one out of four is finished */
+    [[nodiscard]] Vector<Voice> MakeVoices(const std::size_t count) noexcept
+    {
+        Vector<Voice> voices;
+
+        voices.reserve(count);
+        for (auto i = 0u; i < count; ++i)
+            voices.push(Voice { 0.0f, 1.0f, i, (i * 2654435761u >> 7) % 4 == 0 });
+        return voices;
+    }
+}
+
+static void Vector_EraseLoop(benchmark::State &state)
+{
+    const auto source = MakeVoices(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto voices = source;
+        for (auto it = voices.begin(); it != voices.end();) {
+            if (it->finished)
+                voices.erase(it);
+            else
+                ++it;
+        }
+        benchmark::DoNotOptimize(voices.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * source.size()));
+}
+BENCHMARK(Vector_EraseLoop)->Arg(256)->Arg(4096);
+
+static void Vector_RemoveIf(benchmark::State &state)
+{
+    const auto source = MakeVoices(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto voices = source;
+        voices.removeIf([](const Voice &voice) { return voice.finished; });
+        benchmark::DoNotOptimize(voices.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * source.size()));
+}
+BENCHMARK(Vector_RemoveIf)->Arg(256)->Arg(4096);
+
+static void Vector_EraseIndices(benchmark::State &state)
+{
+    const auto source = MakeVoices(static_cast<std::size_t>(state.range(0)));
+    Vector<std::size_t> indices;
+
+    for (auto i = 0ul; i < source.size(); ++i) {
+        if (source[i].finished)
+            indices.push(i);
+    }
+    for (auto _ : state) {
+        auto voices = source;
+        voices.eraseIndices(indices);
+        benchmark::DoNotOptimize(voices.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * source.size()));
+}
+BENCHMARK(Vector_EraseIndices)->Arg(256)->Arg(4096);
+
+static void Vector_EraseUnordered(benchmark::State &state)
+{
+    const auto source = MakeVoices(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        auto voices = source;
+        for (auto it = voices.begin(); it != voices.end();) {
+            if (it->finished)
+                voices.eraseUnordered(it);
+            else
+                ++it;
+        }
+        benchmark::DoNotOptimize(voices.data());
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * source.size()));
+}
+BENCHMARK(Vector_EraseUnordered)->Arg(256)->Arg(4096);
@@ -0,0 +1,101 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Allocator
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdlib>
+
+#if defined(__GLIBC__) || defined(__linux__)
+# include <malloc.h>
+#elif defined(__APPLE__)
+# include <malloc/malloc.h>
+#elif defined(_WIN32)
+# include <malloc.h>
+#endif
+
+#include "Utils.hpp"
+
+namespace Core
+{
+    struct MallocAllocator;
+
+    template<std::size_t Alignment>
+    struct AlignedAllocator;
+
+    /** @brief Allocator used by containers when none is specified */
+    using DefaultAllocator = MallocAllocator;
+
+    namespace Utils
+    {
+        /** @brief Get the real size of a block allocated with std::malloc, fallback to the requested size if not supported */
+        [[nodiscard]] inline std::size_t MallocUsableSize(void * const data, const std::size_t requested) noexcept
+        {
+#if defined(__GLIBC__) || defined(__linux__)
+            return std::max(::malloc_usable_size(data), requested);
+#elif defined(__APPLE__)
+            return std::max(::malloc_size(data), requested);
+#elif defined(_WIN32)
+            return std::max(::_msize(data), requested);
+#else
+            static_cast<void>(data);
+            return requested;
+#endif
+        }
+    }
+}
+
+/** @brief Containers allocators are stateless so containers stay pointer-sized
+ *  An allocator must provide :
+ *  - 'Allocate(bytes)' returning a block aligned at least like std::malloc
+ *  - 'Deallocate(data, bytes)' receiving the same size that was passed to Allocate
+ *  - 'UsableSize(data, bytes)' returning the real usable size of a block (at least 'bytes') */
+struct Core::MallocAllocator
+{
+    /** @brief Allocates a block of memory */
+    [[nodiscard]] static void *Allocate(const std::size_t bytes) noexcept { return std::malloc(bytes); }
+
+    /** @brief Deallocates a block of memory */
+    static void Deallocate(void * const data, const std::size_t) noexcept { std::free(data); }
+
+    /** @brief Get the real size of a block */
+    [[nodiscard]] static std::size_t UsableSize(void * const data, const std::size_t bytes) noexcept
+        { return Utils::MallocUsableSize(data, bytes); }
+};
+
+/** @brief Allocator returning blocks aligned to 'Alignment' bytes (page-aligned I/O buffers, SIMD, ...)
+ *  Sizes are rounded up to the alignment so the rounded size is usable */
+template<std::size_t Alignment>
+struct Core::AlignedAllocator
+{
+    static_assert(Alignment && !(Alignment & (Alignment - 1)), "AlignedAllocator requires a power of 2 alignment");
+
+    /** @brief Round a size to the alignment */
+    [[nodiscard]] static constexpr std::size_t RoundSize(const std::size_t bytes) noexcept
+        { return (bytes + Alignment - 1) & ~(Alignment - 1); }
+
+    /** @brief Allocates a block of memory */
+    [[nodiscard]] static void *Allocate(const std::size_t bytes) noexcept
+    {
+#if defined(_WIN32)
+        return ::_aligned_malloc(RoundSize(bytes), Alignment);
+#else
+        return std::aligned_alloc(std::max(Alignment, alignof(void *)), RoundSize(bytes));
+#endif
+    }
+
+    /** @brief Deallocates a block of memory */
+    static void Deallocate(void * const data, const std::size_t) noexcept
+    {
+#if defined(_WIN32)
+        ::_aligned_free(data);
+#else
+        std::free(data);
+#endif
+    }
+
+    /** @brief Get the real size of a block */
+    [[nodiscard]] static std::size_t UsableSize(void * const, const std::size_t bytes) noexcept { return RoundSize(bytes); }
+};
@@ -0,0 +1,164 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: BitVector
+ */
+
+#include "BitVector.hpp"
+
+#if defined(__AVX2__)
+# include <immintrin.h>
+#endif
+
+using namespace Core;
+
+namespace
+{
+    /** @brief Word-level bulk operations */
+    enum class Operation
+    {
+        And,
+        Or,
+        Xor,
+        AndNot
+    };
+
+    /** @brief Apply an operation word by word, 4 words at a time with AVX2 */
+    template<Operation Op>
+    void ApplyWords(BitVector::Word * const target, const BitVector::Word * const source, const std::size_t count) noexcept
+    {
+        std::size_t i = 0;
+
+#if defined(__AVX2__)
+        for (; i + 4 <= count; i += 4) {
+            const auto lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(target + i));
+            const auto rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + i));
+            __m256i result;
+            if constexpr (Op == Operation::And)
+                result = _mm256_and_si256(lhs, rhs);
+            else if constexpr (Op == Operation::Or)
+                result = _mm256_or_si256(lhs, rhs);
+            else if constexpr (Op == Operation::Xor)
+                result = _mm256_xor_si256(lhs, rhs);
+            else // _mm256_andnot_si256 negates its first operand
+                result = _mm256_andnot_si256(rhs, lhs);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(target + i), result);
+        }
+#endif
+        for (; i < count; ++i) {
+            if constexpr (Op == Operation::And)
+                target[i] &= source[i];
+            else if constexpr (Op == Operation::Or)
+                target[i] |= source[i];
+            else if constexpr (Op == Operation::Xor)
+                target[i] ^= source[i];
+            else
+                target[i] &= ~source[i];
+        }
+    }
+}
+
+void BitVector::resize(const std::size_t size, const bool value) noexcept
+{
+    const auto oldSize = _size;
+    const auto wordCount = (size + WordBits - 1) / WordBits;
+
+    if (value && size > oldSize && oldSize % WordBits)
+        _words[oldSize / WordBits] |= ~Word(0) << (oldSize % WordBits);
+    if (wordCount != _words.size()) {
+        const auto oldWordCount = _words.size();
+        _words.resizeUninitialized(wordCount);
+        if (wordCount > oldWordCount)
+            std::fill(_words.begin() + oldWordCount, _words.end(), value ? ~Word(0) : Word(0));
+    }
+    _size = size;
+    clearTrailingBits();
+}
+
+void BitVector::setAll(void) noexcept
+{
+    std::fill(_words.begin(), _words.end(), ~Word(0));
+    clearTrailingBits();
+}
+
+void BitVector::resetAll(void) noexcept
+{
+    std::fill(_words.begin(), _words.end(), Word(0));
+}
+
+std::size_t BitVector::count(void) const noexcept
+{
+    std::size_t total = 0;
+
+    for (const auto word : _words)
+        total += static_cast<std::size_t>(std::popcount(word));
+    return total;
+}
+
+bool BitVector::any(void) const noexcept
+{
+    for (const auto word : _words) {
+        if (word)
+            return true;
+    }
+    return false;
+}
+
+std::size_t BitVector::findNext(const std::size_t from) const noexcept
+{
+    if (from >= _size)
+        return NotFound;
+    const auto words = _words.data();
+    const auto wordCount = _words.size();
+    auto index = from / WordBits;
+    auto word = words[index] & (~Word(0) << (from % WordBits));
+
+    while (!word) {
+        if (++index == wordCount)
+            return NotFound;
+        word = words[index];
+    }
+    return index * WordBits + static_cast<std::size_t>(std::countr_zero(word));
+}
+
+BitVector &BitVector::operator&=(const BitVector &other) noexcept_ndebug
+{
+    coreAssert(_size == other._size,
+        coreDebugThrow(std::logic_error("Core::BitVector::operator&=: Size mismatch")));
+    ApplyWords<Operation::And>(_words.data(), other._words.data(), _words.size());
+    return *this;
+}
+
+BitVector &BitVector::operator|=(const BitVector &other) noexcept_ndebug
+{
+    coreAssert(_size == other._size,
+        coreDebugThrow(std::logic_error("Core::BitVector::operator|=: Size mismatch")));
+    ApplyWords<Operation::Or>(_words.data(), other._words.data(), _words.size());
+    return *this;
+}
+
+BitVector &BitVector::operator^=(const BitVector &other) noexcept_ndebug
+{
+    coreAssert(_size == other._size,
+        coreDebugThrow(std::logic_error("Core::BitVector::operator^=: Size mismatch")));
+    ApplyWords<Operation::Xor>(_words.data(), other._words.data(), _words.size());
+    return *this;
+}
+
+BitVector &BitVector::andNot(const BitVector &other) noexcept_ndebug
+{
+    coreAssert(_size == other._size,
+        coreDebugThrow(std::logic_error("Core::BitVector::andNot: Size mismatch")));
+    ApplyWords<Operation::AndNot>(_words.data(), other._words.data(), _words.size());
+    return *this;
+}
+
+bool BitVector::operator==(const BitVector &other) const noexcept
+{
+    return _size == other._size && std::equal(_words.begin(), _words.end(), other._words.begin());
+}
+
+void BitVector::clearTrailingBits(void) noexcept
+{
+    if (const auto used = _size % WordBits; used)
+        _words.back() &= (Word(1) << used) - 1;
+}
@@ -0,0 +1,145 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: BitVector
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+#include "Vector.hpp"
+
+namespace Core
+{
+    class BitVector;
+}
+
+/** @brief Dynamic array of bits packed in 64 bits words
+ *  Bits past the size are always zero so that word-level operations never need masking
+ *  Bulk operations (and, or, xor, andNot) are vectorized with AVX2 when the target supports it */
+class Core::BitVector
+{
+public:
+    /** @brief Storage word */
+    using Word = std::uint64_t;
+
+    /** @brief Number of bits per word */
+    static constexpr std::size_t WordBits = sizeof(Word) * 8;
+
+    /** @brief Index returned by find functions when there is no set bit */
+    static constexpr std::size_t NotFound = ~static_cast<std::size_t>(0);
+
+
+    /** @brief Default constructor */
+    BitVector(void) noexcept = default;
+
+    /** @brief Construct 'size' bits initialized to 'value' */
+    explicit BitVector(const std::size_t size, const bool value = false) noexcept { resize(size, value); }
+
+    /** @brief Copy / move constructors and assignments */
+    BitVector(const BitVector &other) noexcept = default;
+    BitVector(BitVector &&other) noexcept = default;
+    BitVector &operator=(const BitVector &other) noexcept = default;
+    BitVector &operator=(BitVector &&other) noexcept = default;
+
+
+    /** @brief Get the number of bits */
+    [[nodiscard]] std::size_t size(void) const noexcept { return _size; }
+
+    /** @brief Fast empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return !_size; }
+
+    /** @brief Get the number of words */
+    [[nodiscard]] std::size_t wordCount(void) const noexcept { return _words.size(); }
+
+    /** @brief Get the words */
+    [[nodiscard]] Word *words(void) noexcept { return _words.data(); }
+    [[nodiscard]] const Word *words(void) const noexcept { return _words.data(); }
+
+
+    /** @brief Resize the bit vector, new bits are initialized to 'value' */
+    void resize(const std::size_t size, const bool value = false) noexcept;
+
+    /** @brief Remove all bits */
+    void clear(void) noexcept { _words.clear(); _size = 0; }
+
+
+    /** @brief Test a single bit */
+    [[nodiscard]] bool test(const std::size_t index) const noexcept
+        { return (_words[index / WordBits] >> (index % WordBits)) & 1; }
+    [[nodiscard]] bool operator[](const std::size_t index) const noexcept { return test(index); }
+
+    /** @brief Set a single bit */
+    void set(const std::size_t index) noexcept { _words[index / WordBits] |= Mask(index); }
+
+    /** @brief Set a single bit to a given value */
+    void set(const std::size_t index, const bool value) noexcept { value ? set(index) : reset(index); }
+
+    /** @brief Reset a single bit */
+    void reset(const std::size_t index) noexcept { _words[index / WordBits] &= ~Mask(index); }
+
+    /** @brief Flip a single bit */
+    void flip(const std::size_t index) noexcept { _words[index / WordBits] ^= Mask(index); }
+
+
+    /** @brief Set / reset all bits */
+    void setAll(void) noexcept;
+    void resetAll(void) noexcept;
+
+
+    /** @brief Count the number of set bits */
+    [[nodiscard]] std::size_t count(void) const noexcept;
+
+    /** @brief Check if any / no / every bit is set */
+    [[nodiscard]] bool any(void) const noexcept;
+    [[nodiscard]] bool none(void) const noexcept { return !any(); }
+    [[nodiscard]] bool all(void) const noexcept { return count() == _size; }
+
+
+    /** @brief Find the first set bit (NotFound if none) */
+    [[nodiscard]] std::size_t findFirst(void) const noexcept { return findNext(0); }
+
+    /** @brief Find the first set bit at or after 'from' (NotFound if none) */
+    [[nodiscard]] std::size_t findNext(const std::size_t from) const noexcept;
+
+    /** @brief Call 'function(index)' for each set bit, in increasing order */
+    template<typename Function>
+    void forEach(Function &&function) const noexcept_invokable(Function, std::size_t);
+
+
+    /** @brief Bulk operations, both bit vectors must have the same size (asserted in debug) */
+    BitVector &operator&=(const BitVector &other) noexcept_ndebug;
+    BitVector &operator|=(const BitVector &other) noexcept_ndebug;
+    BitVector &operator^=(const BitVector &other) noexcept_ndebug;
+
+    /** @brief Reset every bit set in 'other' */
+    BitVector &andNot(const BitVector &other) noexcept_ndebug;
+
+
+    /** @brief Comparison operators */
+    [[nodiscard]] bool operator==(const BitVector &other) const noexcept;
+    [[nodiscard]] bool operator!=(const BitVector &other) const noexcept { return !operator==(other); }
+
+private:
+    Vector<Word> _words {};
+    std::size_t _size { 0 };
+
+    /** @brief Get the mask of a bit inside its word */
+    [[nodiscard]] static constexpr Word Mask(const std::size_t index) noexcept { return Word(1) << (index % WordBits); }
+
+    /** @brief Clear the bits past the size in the last word */
+    void clearTrailingBits(void) noexcept;
+};
+
+template<typename Function>
+inline void Core::BitVector::forEach(Function &&function) const noexcept_invokable(Function, std::size_t)
+{
+    const auto words = _words.data();
+    const auto wordCount = _words.size();
+
+    for (auto i = 0ul; i < wordCount; ++i) {
+        for (auto word = words[i]; word; word &= word - 1)
+            function(i * WordBits + static_cast<std::size_t>(std::countr_zero(word)));
+    }
+}
@@ -0,0 +1,158 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: CircularBuffer
+ */
+
+#pragma once
+
+#include <bit>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+
+#include "Assert.hpp"
+#include "Allocator.hpp"
+#include "Memory.hpp"
+
+namespace Core
+{
+    template<typename Type, typename Allocator = DefaultAllocator>
+    class CircularBuffer;
+}
+
+/** @brief Circular buffer of trivially copyable elements (delay lines, lookahead buffers, ...)
+ *  The capacity is a power of 2 so positions wrap with a mask, new buffers are zero-filled
+ *  Positions are expressed backward from the write head: 'delay' elements behind the next element to be written
+ *  Wrapped regions are exposed as two contiguous spans, so block kernels process them in at most two passes
+ *  In mirrored mode the buffer is mapped twice in a row (memfd) so any window is contiguous and the second span is always empty */
+template<typename Type, typename Allocator>
+class Core::CircularBuffer
+{
+public:
+    static_assert(std::is_trivially_copyable_v<Type> && std::is_trivially_default_constructible_v<Type>,
+        "CircularBuffer: elements must be trivial");
+
+    /** @brief Storage mode */
+    enum class Mode
+    {
+        Heap,
+        Mirrored
+    };
+
+    /** @brief A region split in two contiguous parts, 'second' is empty if the region does not wrap */
+    template<typename SpanType>
+    struct SplitSpan
+    {
+        std::span<SpanType> first {};
+        std::span<SpanType> second {};
+
+        /** @brief Get the total number of elements */
+        [[nodiscard]] std::size_t size(void) const noexcept { return first.size() + second.size(); }
+    };
+
+    /** @brief Mutable / constant split spans */
+    using Spans = SplitSpan<Type>;
+    using ConstSpans = SplitSpan<const Type>;
+
+
+    /** @brief Default constructor, the buffer has no capacity */
+    CircularBuffer(void) noexcept = default;
+
+    /** @brief Allocate a buffer of at least 'capacity' elements */
+    explicit CircularBuffer(const std::size_t capacity, const Mode mode = Mode::Heap) noexcept { allocate(capacity, mode); }
+
+    /** @brief A buffer is movable but not copyable */
+    CircularBuffer(const CircularBuffer &other) = delete;
+    CircularBuffer(CircularBuffer &&other) noexcept { swap(other); }
+    CircularBuffer &operator=(const CircularBuffer &other) = delete;
+    CircularBuffer &operator=(CircularBuffer &&other) noexcept { swap(other); return *this; }
+
+    /** @brief Release the buffer */
+    ~CircularBuffer(void) noexcept { release(); }
+
+
+    /** @brief Allocate a zero-filled buffer of at least 'capacity' elements (rounded to a power of 2)
+     *  Mirrored buffers are also rounded to a whole number of pages, if mirroring is not supported the buffer falls back to the heap */
+    void allocate(const std::size_t capacity, const Mode mode = Mode::Heap) noexcept;
+
+    /** @brief Release the buffer */
+    void release(void) noexcept;
+
+    /** @brief Swap two instances */
+    void swap(CircularBuffer &other) noexcept;
+
+
+    /** @brief Get the capacity (a power of 2) */
+    [[nodiscard]] std::size_t capacity(void) const noexcept { return _mask + (_data ? 1 : 0); }
+
+    /** @brief Get the index mask (capacity - 1) */
+    [[nodiscard]] std::size_t mask(void) const noexcept { return _mask; }
+
+    /** @brief Check if the buffer is mapped twice in a row */
+    [[nodiscard]] bool isMirrored(void) const noexcept { return _mirrored; }
+
+    /** @brief Get the underlying storage, the physical layout ignores the write head */
+    [[nodiscard]] Type *data(void) noexcept { return _data; }
+    [[nodiscard]] const Type *data(void) const noexcept { return _data; }
+
+    /** @brief Get the physical index of the next element to be written */
+    [[nodiscard]] std::size_t head(void) const noexcept { return _head; }
+
+
+    /** @brief Zero-fill the buffer and reset the write head */
+    void clear(void) noexcept;
+
+
+    /** @brief Access an element by physical index, the index is wrapped */
+    [[nodiscard]] Type &operator[](const std::size_t index) noexcept { return _data[index & _mask]; }
+    [[nodiscard]] const Type &operator[](const std::size_t index) const noexcept { return _data[index & _mask]; }
+
+    /** @brief Get the element written 'delay' elements before the last one (0 is the last written element) */
+    [[nodiscard]] const Type &tap(const std::size_t delay) const noexcept { return _data[(_head - 1 - delay) & _mask]; }
+
+
+    /** @brief Write an element and advance the write head */
+    void push(const Type &value) noexcept { _data[_head] = value; _head = (_head + 1) & _mask; }
+
+    /** @brief Write a range of elements and advance the write head, at most 'capacity' elements */
+    void write(const std::span<const Type> values) noexcept_ndebug;
+
+    /** @brief Get the 'count' elements starting at the write head, to be filled before calling advance */
+    [[nodiscard]] Spans writeSpans(const std::size_t count) noexcept_ndebug { return spansAt<Type>(_head, count); }
+
+    /** @brief Advance the write head */
+    void advance(const std::size_t count) noexcept { _head = (_head + count) & _mask; }
+
+
+    /** @brief Copy 'output.size()' elements starting 'delay' elements behind the write head
+     *  read(n, output) with output.size() == n copies the last n written elements, oldest first */
+    void read(const std::size_t delay, const std::span<Type> output) const noexcept_ndebug;
+
+    /** @brief Get the 'count' elements starting 'delay' elements behind the write head */
+    [[nodiscard]] ConstSpans readSpans(const std::size_t delay, const std::size_t count) const noexcept_ndebug
+        { return spansAt<const Type>(_head - delay, count); }
+
+    /** @brief Get a contiguous window of elements starting 'delay' elements behind the write head, only in mirrored mode
+     *  The window may be up to 'capacity' elements long */
+    [[nodiscard]] const Type *window(const std::size_t delay) const noexcept_ndebug;
+    [[nodiscard]] Type *window(const std::size_t delay) noexcept_ndebug;
+
+
+    /** @brief Read an element at a fractional delay with linear interpolation (0 is the last written element) */
+    [[nodiscard]] Type readLinear(const float delay) const noexcept;
+
+    /** @brief Read an element at a fractional delay with 4-point Hermite interpolation (delay must be at least 1) */
+    [[nodiscard]] Type readCubic(const float delay) const noexcept;
+
+private:
+    Type *_data { nullptr };
+    std::size_t _mask { 0 };
+    std::size_t _head { 0 };
+    bool _mirrored { false };
+
+    /** @brief Get the spans of a region of 'count' elements starting at a (wrapped) physical index */
+    template<typename SpanType>
+    [[nodiscard]] SplitSpan<SpanType> spansAt(const std::size_t index, const std::size_t count) const noexcept_ndebug;
+};
+
+#include "CircularBuffer.ipp"
@@ -0,0 +1,142 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: CircularBuffer
+ */
+
+template<typename Type, typename Allocator>
+inline void Core::CircularBuffer<Type, Allocator>::allocate(const std::size_t capacity, const Mode mode) noexcept
+{
+    release();
+    if (!capacity)
+        return;
+    auto count = std::bit_ceil(capacity);
+    // The mapping granularity is a page, elements must tile pages and the capacity must cover whole pages
+    if (const auto pageSize = Memory::PageSize(); mode == Mode::Mirrored && pageSize % sizeof(Type) == 0) {
+        count = std::max(count, pageSize / sizeof(Type));
+        if (const auto data = Memory::MapMirrored(count * sizeof(Type)); data) {
+            _data = reinterpret_cast<Type *>(data);
+            _mirrored = true;
+        }
+    }
+    if (!_data)
+        _data = reinterpret_cast<Type *>(Allocator::Allocate(count * sizeof(Type)));
+    _mask = count - 1;
+    clear();
+}
+
+template<typename Type, typename Allocator>
+inline void Core::CircularBuffer<Type, Allocator>::release(void) noexcept
+{
+    if (!_data)
+        return;
+    if (_mirrored)
+        Memory::UnmapMirrored(_data, capacity() * sizeof(Type));
+    else
+        Allocator::Deallocate(_data, capacity() * sizeof(Type));
+    _data = nullptr;
+    _mask = 0;
+    _head = 0;
+    _mirrored = false;
+}
+
+template<typename Type, typename Allocator>
+inline void Core::CircularBuffer<Type, Allocator>::swap(CircularBuffer &other) noexcept
+{
+    std::swap(_data, other._data);
+    std::swap(_mask, other._mask);
+    std::swap(_head, other._head);
+    std::swap(_mirrored, other._mirrored);
+}
+
+template<typename Type, typename Allocator>
+inline void Core::CircularBuffer<Type, Allocator>::clear(void) noexcept
+{
+    if (_data)
+        std::memset(static_cast<void *>(_data), 0, capacity() * sizeof(Type));
+    _head = 0;
+}
+
+template<typename Type, typename Allocator>
+template<typename SpanType>
+inline typename Core::CircularBuffer<Type, Allocator>::template SplitSpan<SpanType>
+    Core::CircularBuffer<Type, Allocator>::spansAt(const std::size_t index, const std::size_t count) const noexcept_ndebug
+{
+    coreAssert(count <= capacity(),
+        coreDebugThrow(std::logic_error("Core::CircularBuffer: Region larger than capacity")));
+    const auto begin = index & _mask;
+    const auto data = const_cast<Type *>(_data);
+
+    if (_mirrored || begin + count <= capacity())
+        return SplitSpan<SpanType> { std::span<SpanType>(data + begin, count), std::span<SpanType>() };
+    const auto firstCount = capacity() - begin;
+    return SplitSpan<SpanType> { std::span<SpanType>(data + begin, firstCount), std::span<SpanType>(data, count - firstCount) };
+}
+
+template<typename Type, typename Allocator>
+inline void Core::CircularBuffer<Type, Allocator>::write(const std::span<const Type> values) noexcept_ndebug
+{
+    const auto spans = writeSpans(values.size());
+
+    std::memcpy(spans.first.data(), values.data(), spans.first.size_bytes());
+    if (!spans.second.empty())
+        std::memcpy(spans.second.data(), values.data() + spans.first.size(), spans.second.size_bytes());
+    advance(values.size());
+}
+
+template<typename Type, typename Allocator>
+inline void Core::CircularBuffer<Type, Allocator>::read(const std::size_t delay, const std::span<Type> output) const noexcept_ndebug
+{
+    const auto spans = readSpans(delay, output.size());
+
+    std::memcpy(output.data(), spans.first.data(), spans.first.size_bytes());
+    if (!spans.second.empty())
+        std::memcpy(output.data() + spans.first.size(), spans.second.data(), spans.second.size_bytes());
+}
+
+template<typename Type, typename Allocator>
+inline const Type *Core::CircularBuffer<Type, Allocator>::window(const std::size_t delay) const noexcept_ndebug
+{
+    coreAssert(_mirrored,
+        coreDebugThrow(std::logic_error("Core::CircularBuffer::window: Buffer is not mirrored")));
+    return _data + ((_head - delay) & _mask);
+}
+
+template<typename Type, typename Allocator>
+inline Type *Core::CircularBuffer<Type, Allocator>::window(const std::size_t delay) noexcept_ndebug
+{
+    coreAssert(_mirrored,
+        coreDebugThrow(std::logic_error("Core::CircularBuffer::window: Buffer is not mirrored")));
+    return _data + ((_head - delay) & _mask);
+}
+
+template<typename Type, typename Allocator>
+inline Type Core::CircularBuffer<Type, Allocator>::readLinear(const float delay) const noexcept
+{
+    static_assert(std::is_floating_point_v<Type>, "CircularBuffer::readLinear: requires floating point elements");
+
+    const auto integral = static_cast<std::size_t>(delay);
+    const auto fraction = static_cast<Type>(delay - static_cast<float>(integral));
+    const auto a = tap(integral);
+    const auto b = tap(integral + 1);
+
+    return a + (b - a) * fraction;
+}
+
+template<typename Type, typename Allocator>
+inline Type Core::CircularBuffer<Type, Allocator>::readCubic(const float delay) const noexcept
+{
+    static_assert(std::is_floating_point_v<Type>, "CircularBuffer::readCubic: requires floating point elements");
+
+    const auto integral = static_cast<std::size_t>(delay);
+    const auto t = static_cast<Type>(delay - static_cast<float>(integral));
+    const auto y0 = tap(integral - 1);
+    const auto y1 = tap(integral);
+    const auto y2 = tap(integral + 1);
+    const auto y3 = tap(integral + 2);
+    // Catmull-Rom spline between y1 and y2
+    const auto c1 = Type(0.5) * (y2 - y0);
+    const auto c2 = y0 - Type(2.5) * y1 + Type(2) * y2 - Type(0.5) * y3;
+    const auto c3 = Type(0.5) * (y3 - y0) + Type(1.5) * (y1 - y2);
+
+    return ((c3 * t + c2) * t + c1) * t + y1;
+}
@@ -0,0 +1,302 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Block-compressed vector of numeric values
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+#include "Vector.hpp"
+
+namespace Core
+{
+    template<typename Type, std::size_t BlockSize = 512>
+    class CompressedVector;
+
+    namespace Internal
+    {
+        /** @brief Unsigned integer of a given byte size */
+        template<std::size_t Bytes>
+        using CompressedUnsigned = std::conditional_t<Bytes == 1, std::uint8_t,
+            std::conditional_t<Bytes == 2, std::uint16_t, std::conditional_t<Bytes == 4, std::uint32_t, std::uint64_t>>>;
+
+        /** @brief Codes are packed vertically by groups of 128 : value 'Row * Lanes + Lane' of a group is the 'Row'th value
+         *  packed in the word stream of 'Lane', and the streams of all lanes are interleaved word by word
+         *  Each row of a group is unpacked with the same constant shifts on a 16 bytes vector of words */
+        constexpr std::size_t CompressedGroupSize = 128;
+
+        /** @brief Unpack a row of a group packed on 'Width' bits, every shift is a compile-time constant */
+        template<typename Unsigned, std::size_t Width, std::size_t Row>
+        inline void UnpackRow(const Unsigned * __restrict const in, Unsigned * __restrict const out) noexcept
+        {
+            constexpr std::size_t Bits = sizeof(Unsigned) * 8;
+            constexpr std::size_t Lanes = CompressedGroupSize / Bits;
+            constexpr std::size_t Bit = Row * Width;
+            constexpr std::size_t Word = Bit / Bits;
+            constexpr std::size_t Shift = Bit % Bits;
+            constexpr auto Mask = static_cast<Unsigned>(Width == Bits ? ~Unsigned(0) : (Unsigned(1) << Width) - 1);
+
+            for (auto lane = 0ul; lane < Lanes; ++lane) {
+                if constexpr (Shift + Width <= Bits)
+                    out[Row * Lanes + lane] = static_cast<Unsigned>(static_cast<Unsigned>(in[Word * Lanes + lane] >> Shift) & Mask);
+                else
+                    out[Row * Lanes + lane] = static_cast<Unsigned>(static_cast<Unsigned>(static_cast<Unsigned>(in[Word * Lanes + lane] >> Shift)
+                        | static_cast<Unsigned>(in[(Word + 1) * Lanes + lane] << (Bits - Shift))) & Mask);
+            }
+        }
+
+        /** @brief Unpack a block of 'BlockSize' codes packed on 'Width' bits, a group uses exactly 'Width' rows of words */
+        template<typename Unsigned, std::size_t Width, std::size_t BlockSize>
+        inline void UnpackBlock(const Unsigned * __restrict const in, Unsigned * __restrict const out) noexcept
+        {
+            constexpr std::size_t Bits = sizeof(Unsigned) * 8;
+            constexpr std::size_t Lanes = CompressedGroupSize / Bits;
+
+            if constexpr (!Width) {
+                std::fill_n(out, BlockSize, Unsigned(0));
+            } else {
+                for (auto group = 0ul; group < BlockSize / CompressedGroupSize; ++group) {
+                    [groupIn = in + group * Width * Lanes, groupOut = out + group * CompressedGroupSize]<std::size_t ...Rows>(std::index_sequence<Rows...>) {
+                        (UnpackRow<Unsigned, Width, Rows>(groupIn, groupOut), ...);
+                    }(std::make_index_sequence<Bits>());
+                }
+            }
+        }
+
+        /** @brief Decode zigzag codes and accumulate them starting from 'first', 'out' receives the bit patterns of the sums */
+        template<typename Unsigned>
+        inline void ZigZagPrefixSum(const Unsigned * const codes, void * const out, const std::size_t count, Unsigned first) noexcept
+        {
+            const auto bytes = static_cast<std::byte *>(out);
+            std::size_t i = 0;
+#if defined(__SSE2__)
+            // 16 bytes at a time, the running sum is broadcast so that the loop carried dependency is a single add
+            if constexpr (sizeof(Unsigned) >= 2) {
+                constexpr std::size_t Bytes = sizeof(Unsigned);
+                constexpr std::size_t Lanes = 16 / Bytes;
+                const auto add = [](const __m128i lhs, const __m128i rhs) {
+                    if constexpr (Bytes == 2) return _mm_add_epi16(lhs, rhs);
+                    else if constexpr (Bytes == 4) return _mm_add_epi32(lhs, rhs);
+                    else return _mm_add_epi64(lhs, rhs);
+                };
+                const auto negate = [](const __m128i value) {
+                    if constexpr (Bytes == 2) return _mm_sub_epi16(_mm_setzero_si128(), value);
+                    else if constexpr (Bytes == 4) return _mm_sub_epi32(_mm_setzero_si128(), value);
+                    else return _mm_sub_epi64(_mm_setzero_si128(), value);
+                };
+                const auto halve = [](const __m128i value) {
+                    if constexpr (Bytes == 2) return _mm_srli_epi16(value, 1);
+                    else if constexpr (Bytes == 4) return _mm_srli_epi32(value, 1);
+                    else return _mm_srli_epi64(value, 1);
+                };
+                const auto broadcastLast = [](const __m128i value) {
+                    if constexpr (Bytes == 2) return _mm_shuffle_epi32(_mm_shufflehi_epi16(value, 0xFF), 0xFF);
+                    else if constexpr (Bytes == 4) return _mm_shuffle_epi32(value, 0xFF);
+                    else return _mm_shuffle_epi32(value, 0xEE);
+                };
+                const auto broadcast = [](const Unsigned value) {
+                    if constexpr (Bytes == 2) return _mm_set1_epi16(static_cast<short>(value));
+                    else if constexpr (Bytes == 4) return _mm_set1_epi32(static_cast<int>(value));
+                    else return _mm_set1_epi64x(static_cast<long long>(value));
+                };
+                const auto one = broadcast(1);
+                auto carry = broadcast(first);
+
+                for (; i + Lanes <= count; i += Lanes) {
+                    const auto code = _mm_loadu_si128(reinterpret_cast<const __m128i *>(codes + i));
+                    auto value = _mm_xor_si128(halve(code), negate(_mm_and_si128(code, one)));
+                    // In-register inclusive scan
+                    value = add(value, _mm_slli_si128(value, Bytes));
+                    if constexpr (Bytes * 2 < 16)
+                        value = add(value, _mm_slli_si128(value, Bytes * 2));
+                    if constexpr (Bytes * 4 < 16)
+                        value = add(value, _mm_slli_si128(value, Bytes * 4));
+                    _mm_storeu_si128(reinterpret_cast<__m128i *>(bytes + i * sizeof(Unsigned)), add(value, carry));
+                    carry = add(carry, broadcastLast(value));
+                }
+                if (i)
+                    std::memcpy(&first, bytes + (i - 1) * sizeof(Unsigned), sizeof(Unsigned));
+            }
+#endif
+            for (; i < count; ++i) {
+                const auto code = codes[i];
+                first = static_cast<Unsigned>(first + static_cast<Unsigned>((code >> 1) ^ static_cast<Unsigned>(Unsigned(0) - static_cast<Unsigned>(code & 1))));
+                std::memcpy(bytes + i * sizeof(Unsigned), &first, sizeof(Unsigned));
+            }
+        }
+    }
+}
+
+/** @brief Append-only vector of integers or floating points stored in compressed blocks of 'BlockSize' values
+ *  Each block is encoded losslessly : values are delta coded, zigzag mapped then bit-packed on the smallest width
+ *  able to hold every delta of the block (frame-of-reference on deltas)
+ *  Smooth signals like PCM samples need a few bits per value, floating points are coded through their bit pattern
+ *  so they compress far less than integer samples
+ *  A block index gives O(1) access to any block
+ *  Decoding runs a width-specialized kernel unpacking 16 bytes of codes per step, then an SSE2 prefix sum
+ *  Decoding is const and thread-safe, use a Reader for cached random access */
+template<typename Type, std::size_t BlockSize>
+class Core::CompressedVector
+{
+public:
+    static_assert((std::is_integral_v<Type> || std::is_floating_point_v<Type>) && sizeof(Type) <= 8,
+        "CompressedVector: Type must be an integer or a floating point of at most 64 bits");
+    static_assert(BlockSize && BlockSize % Internal::CompressedGroupSize == 0, "CompressedVector: BlockSize must be a multiple of 128");
+
+    /** @brief Unsigned integer used to code values */
+    using Unsigned = Internal::CompressedUnsigned<sizeof(Type)>;
+
+    /** @brief Number of bits of a value */
+    static constexpr std::size_t ValueBits = sizeof(Type) * 8;
+
+    /** @brief Entry of the block index */
+    struct Block
+    {
+        std::size_t offset {};
+        Unsigned first {};
+        std::uint8_t width {};
+    };
+
+    /** @brief Random access reader with a small round-robin cache of decoded blocks
+     *  A reader is owned by a single thread, it must be invalidated after the vector is modified */
+    class Reader
+    {
+    public:
+        /** @brief Construct a reader caching up to 'cacheBlocks' decoded blocks (allocates once) */
+        explicit Reader(const CompressedVector &vector, const std::size_t cacheBlocks = 2) noexcept;
+
+
+        /** @brief Get the value at index */
+        [[nodiscard]] Type at(const std::size_t index) noexcept_ndebug
+            { return block(index / BlockSize)[index % BlockSize]; }
+        [[nodiscard]] Type operator[](const std::size_t index) noexcept_ndebug { return at(index); }
+
+        /** @brief Get a decoded block, the pointer is valid until the block is evicted from the cache */
+        [[nodiscard]] const Type *block(const std::size_t blockIndex) noexcept_ndebug;
+
+        /** @brief Copy a range of values starting at 'first' into 'out' */
+        void read(std::size_t first, std::span<Type> out) noexcept_ndebug;
+
+        /** @brief Drop every cached block */
+        void invalidate(void) noexcept;
+
+
+        /** @brief Get the number of cache hits and misses */
+        [[nodiscard]] std::size_t hits(void) const noexcept { return _hits; }
+        [[nodiscard]] std::size_t misses(void) const noexcept { return _misses; }
+
+    private:
+        static constexpr std::size_t NoBlock = ~static_cast<std::size_t>(0);
+
+        const CompressedVector *_vector { nullptr };
+        Vector<Type> _cache {};
+        Vector<std::size_t> _tags {};
+        std::size_t _victim { 0 };
+        std::size_t _hits { 0 };
+        std::size_t _misses { 0 };
+    };
+
+
+    /** @brief Default constructor */
+    CompressedVector(void) noexcept = default;
+
+    /** @brief Values constructor */
+    explicit CompressedVector(const std::span<const Type> values) noexcept { append(values); }
+
+    /** @brief Copy / move constructors and assignments */
+    CompressedVector(const CompressedVector &other) noexcept = default;
+    CompressedVector(CompressedVector &&other) noexcept = default;
+    CompressedVector &operator=(const CompressedVector &other) noexcept = default;
+    CompressedVector &operator=(CompressedVector &&other) noexcept = default;
+
+
+    /** @brief Get the number of values */
+    [[nodiscard]] std::size_t size(void) const noexcept { return _size; }
+
+    /** @brief Fast empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return !_size; }
+
+    /** @brief Get the number of blocks */
+    [[nodiscard]] std::size_t blockCount(void) const noexcept { return _blocks.size(); }
+
+    /** @brief Get the number of values of a block */
+    [[nodiscard]] std::size_t blockValueCount(const std::size_t blockIndex) const noexcept
+        { return blockIndex + 1 < _blocks.size() ? BlockSize : _size - blockIndex * BlockSize; }
+
+    /** @brief Get an entry of the block index */
+    [[nodiscard]] const Block &block(const std::size_t blockIndex) const noexcept { return _blocks[blockIndex]; }
+
+
+    /** @brief Get the number of bytes used by the compressed data and the block index */
+    [[nodiscard]] std::size_t compressedBytes(void) const noexcept
+        { return _words.size() * sizeof(Unsigned) + _blocks.size() * sizeof(Block); }
+
+    /** @brief Get the number of bytes the values would use uncompressed */
+    [[nodiscard]] std::size_t uncompressedBytes(void) const noexcept { return _size * sizeof(Type); }
+
+
+    /** @brief Append values, the last block is re-encoded if it was partial (prefer large appends over single pushes) */
+    void append(std::span<const Type> values) noexcept;
+
+    /** @brief Append a single value */
+    void push(const Type value) noexcept { append(std::span<const Type>(&value, 1)); }
+
+    /** @brief Remove every value */
+    void clear(void) noexcept { _words.clear(); _blocks.clear(); _size = 0; }
+
+    /** @brief Remove every value and release memory */
+    void release(void) noexcept { _words.release(); _blocks.release(); _size = 0; }
+
+
+    /** @brief Decode a block into 'out' which must hold at least BlockSize values
+     *  @return The number of decoded values */
+    std::size_t decodeBlock(const std::size_t blockIndex, Type * const out) const noexcept_ndebug;
+
+    /** @brief Decode a range of values starting at 'first' into 'out' */
+    void decode(std::size_t first, std::span<Type> out) const noexcept_ndebug;
+
+private:
+    using Unpacker = void(*)(const Unsigned *, Unsigned *);
+
+    /** @brief Unpack kernels indexed by bit width */
+    static constexpr auto Unpackers = []<std::size_t ...Widths>(std::index_sequence<Widths...>) {
+        return std::array<Unpacker, sizeof...(Widths)> { &Internal::UnpackBlock<Unsigned, Widths, BlockSize>... };
+    }(std::make_index_sequence<ValueBits + 1>());
+
+    Vector<Unsigned> _words {};
+    Vector<Block> _blocks {};
+    std::size_t _size { 0 };
+
+    /** @brief Encode a block of at most BlockSize values at the end of the vector */
+    void encodeBlock(const Type * const values, const std::size_t count) noexcept;
+
+    /** @brief Get the code of a value */
+    [[nodiscard]] static Unsigned ToUnsigned(const Type value) noexcept
+    {
+        if constexpr (std::is_floating_point_v<Type>)
+            return std::bit_cast<Unsigned>(value);
+        else
+            return static_cast<Unsigned>(value);
+    }
+
+    /** @brief Map a signed delta to an unsigned code, small magnitudes get small codes */
+    [[nodiscard]] static Unsigned ZigZag(const Unsigned delta) noexcept
+    {
+        using Signed = std::make_signed_t<Unsigned>;
+        return static_cast<Unsigned>(static_cast<Unsigned>(delta << 1) ^ static_cast<Unsigned>(static_cast<Signed>(delta) >> (ValueBits - 1)));
+    }
+};
+
+#include "CompressedVector.ipp"
@@ -0,0 +1,164 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Block-compressed vector of numeric values
+ */
+
+template<typename Type, std::size_t BlockSize>
+inline Core::CompressedVector<Type, BlockSize>::Reader::Reader(const CompressedVector &vector, const std::size_t cacheBlocks) noexcept
+    : _vector(&vector)
+{
+    const auto count = std::max<std::size_t>(cacheBlocks, 1);
+
+    _cache.resizeUninitialized(count * BlockSize);
+    _tags.resize(count, NoBlock);
+}
+
+template<typename Type, std::size_t BlockSize>
+inline const Type *Core::CompressedVector<Type, BlockSize>::Reader::block(const std::size_t blockIndex) noexcept_ndebug
+{
+    coreAssert(blockIndex < _vector->blockCount(),
+        coreDebugThrow(std::out_of_range("Core::CompressedVector::Reader::block: Block index out of range")));
+
+    const auto count = _tags.size();
+    for (auto i = 0ul; i < count; ++i) {
+        if (_tags[i] == blockIndex) {
+            ++_hits;
+            return _cache.data() + i * BlockSize;
+        }
+    }
+    ++_misses;
+    const auto slot = _victim;
+    _victim = (_victim + 1) % count;
+    _tags[slot] = blockIndex;
+    const auto out = _cache.data() + slot * BlockSize;
+    _vector->decodeBlock(blockIndex, out);
+    return out;
+}
+
+template<typename Type, std::size_t BlockSize>
+inline void Core::CompressedVector<Type, BlockSize>::Reader::read(std::size_t first, std::span<Type> out) noexcept_ndebug
+{
+    coreAssert(first + out.size() <= _vector->size(),
+        coreDebugThrow(std::out_of_range("Core::CompressedVector::Reader::read: Range out of bounds")));
+
+    while (!out.empty()) {
+        const auto offset = first % BlockSize;
+        const auto count = std::min(BlockSize - offset, out.size());
+        std::copy_n(block(first / BlockSize) + offset, count, out.data());
+        first += count;
+        out = out.subspan(count);
+    }
+}
+
+template<typename Type, std::size_t BlockSize>
+inline void Core::CompressedVector<Type, BlockSize>::Reader::invalidate(void) noexcept
+{
+    for (auto &tag : _tags)
+        tag = NoBlock;
+    _victim = 0;
+}
+
+template<typename Type, std::size_t BlockSize>
+inline void Core::CompressedVector<Type, BlockSize>::append(std::span<const Type> values) noexcept
+{
+    if (values.empty())
+        return;
+    // Merge into the partial last block
+    if (const auto tail = _size % BlockSize; tail) {
+        Type merged[BlockSize];
+        const auto count = std::min(BlockSize - tail, values.size());
+        decodeBlock(_blocks.size() - 1, merged);
+        std::copy_n(values.data(), count, merged + tail);
+        _words.resizeUninitialized(_blocks.back().offset);
+        _blocks.pop();
+        encodeBlock(merged, tail + count);
+        _size += count;
+        values = values.subspan(count);
+    }
+    _blocks.reserve(static_cast<std::size_t>(_blocks.size() + (values.size() + BlockSize - 1) / BlockSize));
+    while (!values.empty()) {
+        const auto count = std::min(BlockSize, values.size());
+        encodeBlock(values.data(), count);
+        _size += count;
+        values = values.subspan(count);
+    }
+}
+
+template<typename Type, std::size_t BlockSize>
+inline void Core::CompressedVector<Type, BlockSize>::encodeBlock(const Type * const values, const std::size_t count) noexcept
+{
+    Unsigned codes[BlockSize] {};
+    const auto first = ToUnsigned(values[0]);
+    auto previous = first;
+    Unsigned bits = 0;
+
+    for (auto i = 1ul; i < count; ++i) {
+        const auto current = ToUnsigned(values[i]);
+        codes[i] = ZigZag(static_cast<Unsigned>(current - previous));
+        bits |= codes[i];
+        previous = current;
+    }
+
+    constexpr std::size_t Lanes = Internal::CompressedGroupSize / ValueBits;
+    const auto width = static_cast<std::size_t>(std::bit_width(bits));
+    const auto offset = _words.size();
+    const auto wordCount = width * BlockSize / ValueBits;
+    if (_words.capacity() < offset + wordCount)
+        _words.grow(offset + wordCount);
+    _words.resizeUninitialized(offset + wordCount);
+    const auto out = _words.data() + offset;
+    std::fill_n(out, wordCount, Unsigned(0));
+    if (width) {
+        for (auto i = 1ul; i < count; ++i) {
+            const auto group = out + i / Internal::CompressedGroupSize * width * Lanes;
+            const auto row = i % Internal::CompressedGroupSize / Lanes;
+            const auto lane = i % Lanes;
+            const auto bit = row * width;
+            const auto word = bit / ValueBits;
+            const auto shift = bit % ValueBits;
+            group[word * Lanes + lane] |= static_cast<Unsigned>(codes[i] << shift);
+            if (shift + width > ValueBits)
+                group[(word + 1) * Lanes + lane] |= static_cast<Unsigned>(codes[i] >> (ValueBits - shift));
+        }
+    }
+    _blocks.push(Block { offset, first, static_cast<std::uint8_t>(width) });
+}
+
+template<typename Type, std::size_t BlockSize>
+inline std::size_t Core::CompressedVector<Type, BlockSize>::decodeBlock(const std::size_t blockIndex, Type * const out) const noexcept_ndebug
+{
+    coreAssert(blockIndex < _blocks.size(),
+        coreDebugThrow(std::out_of_range("Core::CompressedVector::decodeBlock: Block index out of range")));
+
+    alignas_cacheline Unsigned codes[BlockSize];
+    const auto &block = _blocks[blockIndex];
+    const auto count = blockValueCount(blockIndex);
+
+    Unpackers[block.width](_words.data() + block.offset, codes);
+    Internal::ZigZagPrefixSum(codes, out, count, block.first);
+    return count;
+}
+
+template<typename Type, std::size_t BlockSize>
+inline void Core::CompressedVector<Type, BlockSize>::decode(std::size_t first, std::span<Type> out) const noexcept_ndebug
+{
+    coreAssert(first + out.size() <= _size,
+        coreDebugThrow(std::out_of_range("Core::CompressedVector::decode: Range out of bounds")));
+
+    while (!out.empty()) {
+        const auto blockIndex = first / BlockSize;
+        const auto offset = first % BlockSize;
+        const auto available = blockValueCount(blockIndex) - offset;
+        const auto count = std::min(available, out.size());
+        if (!offset && out.size() >= BlockSize) {
+            // Whole block, decode in place
+            decodeBlock(blockIndex, out.data());
+        } else {
+            Type block[BlockSize];
+            decodeBlock(blockIndex, block);
+            std::copy_n(block + offset, count, out.data());
+        }
+        first += count;
+        out = out.subspan(count);
+    }
+}
@@ -0,0 +1,109 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: ContainerMetrics
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#ifdef CORE_CONTAINER_METRICS
+# define coreContainerMetric(hook) Core::ContainerMetrics::hook
+#else
+# define coreContainerMetric(hook) static_cast<void>(0)
+#endif
+
+#ifdef CORE_CONTAINER_ACCOUNTING
+# define coreContainerAccount(hook) Core::ContainerMetrics::hook
+#else
+# define coreContainerAccount(hook) static_cast<void>(0)
+#endif
+
+/** @brief Containers hooks, only called when CORE_CONTAINER_METRICS / CORE_CONTAINER_ACCOUNTING are defined
+ *  This header must not include any container header as it is included by VectorDetails */
+namespace Core::ContainerMetrics
+{
+    /** @brief Notify that a container allocated a buffer of a given size */
+    void OnAllocation(const std::size_t bytes) noexcept;
+
+    /** @brief Notify that a container had to move its elements into a bigger buffer */
+    void OnGrowth(void) noexcept;
+
+
+    /** @brief Memory held by every container of a given storage type (Vector<int>, FlatString, ...)
+     *  Accounts are created on first use, registered globally and never destroyed */
+    struct Account
+    {
+        /** @brief Construct and register an account */
+        explicit Account(const std::string_view accountName) noexcept;
+
+        std::string_view name {};
+        std::atomic<std::int64_t> buffers { 0 };
+        std::atomic<std::int64_t> capacityBytes { 0 };
+        std::atomic<std::int64_t> sizeBytes { 0 };
+        std::atomic<std::int64_t> peakCapacityBytes { 0 };
+        Account *next { nullptr };
+    };
+
+    /** @brief Get the first registered account, accounts are linked through 'next' */
+    [[nodiscard]] const Account *FirstAccount(void) noexcept;
+
+    /** @brief Get the readable name of a type at compile time */
+    template<typename Type>
+    [[nodiscard]] constexpr std::string_view TypeName(void) noexcept
+    {
+#if defined(_MSC_VER)
+        constexpr std::string_view Signature = __FUNCSIG__;
+        constexpr auto Begin = Signature.find("TypeName<") + 9;
+        constexpr auto End = Signature.rfind(">(void)");
+#else
+        constexpr std::string_view Signature = __PRETTY_FUNCTION__;
+        constexpr auto Begin = Signature.find("Type = ") + 7;
+        constexpr auto End = Signature.find_first_of(";]", Begin);
+#endif
+        return Signature.substr(Begin, End - Begin);
+    }
+
+    /** @brief Get the account of a container storage type */
+    template<typename Container>
+    [[nodiscard]] Account &AccountOf(void) noexcept
+    {
+        static Account ContainerAccount(TypeName<Container>());
+        return ContainerAccount;
+    }
+
+    /** @brief Notify that a container allocated a buffer of 'bytes' */
+    template<typename Container>
+    void OnAccountAllocation(const std::size_t bytes) noexcept
+    {
+        auto &account = AccountOf<Container>();
+        const auto total = account.capacityBytes.fetch_add(static_cast<std::int64_t>(bytes), std::memory_order_relaxed) + static_cast<std::int64_t>(bytes);
+        auto peak = account.peakCapacityBytes.load(std::memory_order_relaxed);
+
+        account.buffers.fetch_add(1, std::memory_order_relaxed);
+        while (peak < total && !account.peakCapacityBytes.compare_exchange_weak(peak, total, std::memory_order_relaxed));
+    }
+
+    /** @brief Notify that a container released a buffer of 'bytes' */
+    template<typename Container>
+    void OnAccountDeallocation(const std::size_t bytes) noexcept
+    {
+        auto &account = AccountOf<Container>();
+
+        account.buffers.fetch_sub(1, std::memory_order_relaxed);
+        account.capacityBytes.fetch_sub(static_cast<std::int64_t>(bytes), std::memory_order_relaxed);
+    }
+
+    /** @brief Notify that the elements of a container went from 'previousBytes' to 'bytes' */
+    template<typename Container>
+    void OnAccountResize(const std::size_t previousBytes, const std::size_t bytes) noexcept
+    {
+        if (previousBytes != bytes) {
+            AccountOf<Container>().sizeBytes.fetch_add(
+                static_cast<std::int64_t>(bytes) - static_cast<std::int64_t>(previousBytes), std::memory_order_relaxed);
+        }
+    }
+}
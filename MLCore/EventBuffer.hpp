@@ -0,0 +1,98 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: EventBuffer
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <limits>
+#include <span>
+
+#include "RadixSort.hpp"
+
+namespace Core
+{
+    /** @brief Default event key extractor, events expose a 'timestamp' member (sample offset) */
+    struct EventTimestamp
+    {
+        template<typename Type>
+        [[nodiscard]] constexpr auto operator()(const Type &event) const noexcept { return event.timestamp; }
+    };
+
+    /** @brief Merge up to 'MaxWays' sorted runs into 'output' with a loser tree, without allocating
+     *  The merge is stable: equal keys keep their run order, then their order inside each run
+     *  @return End of the written output */
+    template<std::size_t MaxWays = 64, typename Type, typename KeyFunction = EventTimestamp>
+    Type *MergeRuns(const std::span<const std::span<const Type>> runs, Type *output, KeyFunction &&key = KeyFunction()) noexcept_ndebug;
+
+    template<typename Type, typename KeyFunction = EventTimestamp>
+    class EventBuffer;
+}
+
+/** @brief Contiguous buffer of fixed-size events made of sorted runs (one per producer)
+ *  Producers append already-sorted runs, 'merge' then produces a single sorted stream with a k-way loser tree merge
+ *  The merge reuses an internal scratch buffer, so once capacities are warmed up it never allocates
+ *  Equal timestamps keep the order in which runs were appended */
+template<typename Type, typename KeyFunction>
+class Core::EventBuffer
+{
+public:
+    static_assert(std::is_trivially_copyable_v<Type> && std::is_trivially_default_constructible_v<Type>,
+        "EventBuffer: events must be trivial (no default member initializers)");
+
+    /** @brief Maximum number of runs merged in a single pass */
+    static constexpr std::size_t MaxWays = 64;
+
+    /** @brief Input iterator */
+    using ConstIterator = const Type *;
+
+
+    /** @brief Get the number of events */
+    [[nodiscard]] std::size_t size(void) const noexcept { return _events.size(); }
+
+    /** @brief Fast empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return _events.empty(); }
+
+    /** @brief Get the number of sorted runs (0 or 1 means the buffer is sorted) */
+    [[nodiscard]] std::size_t runCount(void) const noexcept { return _runEnds.size(); }
+
+    /** @brief Check if the buffer is sorted */
+    [[nodiscard]] bool isSorted(void) const noexcept { return _runEnds.size() <= 1; }
+
+    /** @brief Get the events */
+    [[nodiscard]] const Type *data(void) const noexcept { return _events.data(); }
+    [[nodiscard]] ConstIterator begin(void) const noexcept { return _events.begin(); }
+    [[nodiscard]] ConstIterator end(void) const noexcept { return _events.end(); }
+
+
+    /** @brief Reserve memory for 'count' events and 'runCount' runs */
+    void reserve(const std::size_t count, const std::size_t runCount = MaxWays) noexcept;
+
+    /** @brief Remove all events, capacities are kept */
+    void clear(void) noexcept { _events.clear(); _runEnds.clear(); }
+
+
+    /** @brief Append a single event, a new run starts if it is older than the last event */
+    void push(const Type &event) noexcept;
+
+    /** @brief Append an already sorted run of events (asserted in debug) */
+    void appendRun(const std::span<const Type> run) noexcept_ndebug;
+
+
+    /** @brief Merge all runs into a single sorted run */
+    void merge(void) noexcept;
+
+    /** @brief Get the events whose key lies in [from, to), the buffer must be sorted (asserted in debug) */
+    template<typename Key>
+    [[nodiscard]] std::span<const Type> range(const Key from, const Key to) const noexcept_ndebug;
+
+private:
+    Vector<Type> _events {};
+    Vector<Type> _scratch {};
+    Vector<std::size_t> _runEnds {};
+    [[no_unique_address]] KeyFunction _key {};
+};
+
+#include "EventBuffer.ipp"
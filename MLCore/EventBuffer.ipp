@@ -0,0 +1,198 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: EventBuffer
+ */
+
+template<std::size_t MaxWays, typename Type, typename KeyFunction>
+inline Type *Core::MergeRuns(const std::span<const std::span<const Type>> runs, Type *output, KeyFunction &&key) noexcept_ndebug
+{
+    static_assert(MaxWays && !(MaxWays & (MaxWays - 1)), "MergeRuns: MaxWays must be a power of 2");
+
+    constexpr auto Empty = ~static_cast<std::uint32_t>(0);
+
+    coreAssert(runs.size() <= MaxWays,
+        coreDebugThrow(std::logic_error("Core::MergeRuns: Too many runs")));
+    if (runs.empty())
+        return output;
+    else if (runs.size() == 1)
+        return std::copy(runs[0].begin(), runs[0].end(), output);
+
+    using Key = std::remove_cvref_t<decltype(key(*runs[0].data()))>;
+
+    static_assert(std::numeric_limits<Key>::is_specialized, "MergeRuns: keys must be arithmetic");
+
+    // Leaves are padded to a power of 2, padding leaves are exhausted runs
+    // Each leaf is ranked by (key, rank) where rank is the run index, so equal keys keep the run order (stable merge)
+    // Exhausted runs get a rank past every live run so they always lose, whatever the key of the live runs (+inf, NaN)
+    const auto leafCount = static_cast<std::uint32_t>(std::bit_ceil(runs.size()));
+    std::array<const Type *, MaxWays> heads;
+    std::array<const Type *, MaxWays> ends;
+    std::size_t remaining = 0;
+
+    for (auto i = 0u; i < leafCount; ++i) {
+        const auto live = i < runs.size() && !runs[i].empty();
+        heads[i] = live ? runs[i].data() : nullptr;
+        ends[i] = live ? runs[i].data() + runs[i].size() : nullptr;
+        remaining += live ? runs[i].size() : 0;
+    }
+
+    if constexpr (sizeof(Key) <= sizeof(std::uint32_t)) {
+        // Small keys: (key, rank) pairs are packed into a single integer stored in the tree, matches are a min / max
+        // Ranks stay below 2 * MaxWays so no packed pair can collide with the empty node marker (all bits set)
+        static_assert(MaxWays <= (static_cast<std::size_t>(1) << 30), "MergeRuns: MaxWays is too large");
+        constexpr auto Exhausted = ~static_cast<std::uint64_t>(0) << 32;
+        constexpr auto EmptyNode = ~static_cast<std::uint64_t>(0);
+        const auto pack = [&key](const Type &event, const std::uint32_t rank) {
+            return (static_cast<std::uint64_t>(Internal::RadixEncode(key(event))) << 32) | rank;
+        };
+        std::array<std::uint64_t, MaxWays> tree;
+
+        for (auto i = 0u; i < leafCount; ++i)
+            tree[i] = EmptyNode;
+        for (auto leaf = 0u; leaf < leafCount; ++leaf) {
+            auto winner = heads[leaf] ? pack(*heads[leaf], leaf) : Exhausted | (leaf + MaxWays);
+            for (auto node = (leaf + leafCount) / 2; node; node /= 2) {
+                if (tree[node] == EmptyNode) {
+                    tree[node] = winner;
+                    winner = EmptyNode;
+                    break;
+                }
+                const auto loser = tree[node];
+                tree[node] = std::max(loser, winner);
+                winner = std::min(loser, winner);
+            }
+            if (winner != EmptyNode)
+                tree[0] = winner;
+        }
+        // The overall winner stays in a register across iterations
+        for (auto top = tree[0]; remaining; --remaining) {
+            const auto leaf = static_cast<std::uint32_t>(top & (MaxWays - 1));
+            const auto head = heads[leaf]++;
+            *output++ = *head;
+            top = head + 1 != ends[leaf] ? pack(head[1], leaf) : Exhausted | (leaf + MaxWays);
+            for (auto node = (leaf + leafCount) / 2; node; node /= 2) {
+                const auto loser = tree[node];
+                tree[node] = std::max(loser, top);
+                top = std::min(loser, top);
+            }
+        }
+    } else {
+        // Large keys: the tree stores leaf indexes, head keys are cached
+        std::array<Key, MaxWays> keys;
+        std::array<std::uint32_t, MaxWays> ranks;
+        std::array<std::uint32_t, MaxWays> tree;
+        // Exhaustion is compared before the keys: a live key may compare greater than the max key (+inf) or unordered (NaN)
+        const auto beats = [&keys, &ranks](const std::uint32_t lhs, const std::uint32_t rhs) -> bool {
+            const auto lhsLive = ranks[lhs] < MaxWays;
+            const auto rhsLive = ranks[rhs] < MaxWays;
+            if (lhsLive != rhsLive)
+                return lhsLive;
+            return (keys[lhs] < keys[rhs]) | ((keys[lhs] == keys[rhs]) & (ranks[lhs] < ranks[rhs]));
+        };
+
+        for (auto i = 0u; i < leafCount; ++i) {
+            keys[i] = heads[i] ? key(*heads[i]) : std::numeric_limits<Key>::max();
+            ranks[i] = heads[i] ? i : i + MaxWays;
+            tree[i] = Empty;
+        }
+        // Build: each leaf climbs until it finds an empty node, the winner of each match keeps climbing
+        for (auto leaf = 0u; leaf < leafCount; ++leaf) {
+            auto winner = leaf;
+            for (auto node = (leaf + leafCount) / 2; node; node /= 2) {
+                if (tree[node] == Empty) {
+                    tree[node] = winner;
+                    winner = Empty;
+                    break;
+                } else if (beats(tree[node], winner))
+                    std::swap(tree[node], winner);
+            }
+            if (winner != Empty)
+                tree[0] = winner;
+        }
+        // Pop the overall winner then replay its path to the root against the stored losers
+        for (; remaining; --remaining) {
+            auto winner = tree[0];
+            *output++ = *heads[winner];
+            if (++heads[winner] != ends[winner])
+                keys[winner] = key(*heads[winner]);
+            else {
+                keys[winner] = std::numeric_limits<Key>::max();
+                ranks[winner] += MaxWays;
+            }
+            for (auto node = (winner + leafCount) / 2; node; node /= 2) {
+                const auto loser = tree[node];
+                const auto swap = beats(loser, winner);
+                tree[node] = swap ? winner : loser;
+                winner = swap ? loser : winner;
+            }
+            tree[0] = winner;
+        }
+    }
+    return output;
+}
+
+template<typename Type, typename KeyFunction>
+inline void Core::EventBuffer<Type, KeyFunction>::reserve(const std::size_t count, const std::size_t runCount) noexcept
+{
+    _events.reserve(count);
+    _scratch.reserve(count);
+    _runEnds.reserve(runCount);
+}
+
+template<typename Type, typename KeyFunction>
+inline void Core::EventBuffer<Type, KeyFunction>::push(const Type &event) noexcept
+{
+    if (_runEnds.empty() || _key(event) < _key(_events.back()))
+        _runEnds.push(_events.size() + 1);
+    else
+        ++_runEnds.back();
+    _events.push(event);
+}
+
+template<typename Type, typename KeyFunction>
+inline void Core::EventBuffer<Type, KeyFunction>::appendRun(const std::span<const Type> run) noexcept_ndebug
+{
+    coreAssert(std::is_sorted(run.begin(), run.end(), [this](const Type &lhs, const Type &rhs) { return _key(lhs) < _key(rhs); }),
+        coreDebugThrow(std::logic_error("Core::EventBuffer::appendRun: Run is not sorted")));
+    if (run.empty())
+        return;
+    _events.append(run);
+    _runEnds.push(_events.size());
+}
+
+template<typename Type, typename KeyFunction>
+inline void Core::EventBuffer<Type, KeyFunction>::merge(void) noexcept
+{
+    std::array<std::span<const Type>, MaxWays> runs;
+
+    // Each pass merges groups of MaxWays runs, new run ends are written in place since there are fewer of them
+    while (_runEnds.size() > 1) {
+        _scratch.resizeUninitialized(_events.size());
+        auto output = _scratch.data();
+        std::size_t runBegin = 0;
+        std::size_t groupCount = 0;
+        for (std::size_t first = 0; first < _runEnds.size(); first += MaxWays) {
+            const auto last = std::min(first + MaxWays, _runEnds.size());
+            for (auto i = first; i < last; ++i) {
+                runs[i - first] = std::span<const Type>(_events.data() + runBegin, _runEnds[i] - runBegin);
+                runBegin = _runEnds[i];
+            }
+            output = MergeRuns<MaxWays>(std::span<const std::span<const Type>>(runs.data(), last - first), output, _key);
+            _runEnds[groupCount++] = runBegin;
+        }
+        _runEnds.resizeUninitialized(groupCount);
+        _events.swap(_scratch);
+    }
+}
+
+template<typename Type, typename KeyFunction>
+template<typename Key>
+inline std::span<const Type> Core::EventBuffer<Type, KeyFunction>::range(const Key from, const Key to) const noexcept_ndebug
+{
+    coreAssert(isSorted(),
+        coreDebugThrow(std::logic_error("Core::EventBuffer::range: Buffer is not merged")));
+    const auto first = std::partition_point(_events.begin(), _events.end(), [this, from](const Type &event) { return _key(event) < from; });
+    const auto last = std::partition_point(first, _events.end(), [this, to](const Type &event) { return _key(event) < to; });
+
+    return std::span<const Type>(first, last);
+}
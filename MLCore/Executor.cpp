@@ -0,0 +1,79 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Executor
+ */
+
+#include "Executor.hpp"
+
+using namespace Core;
+
+PoolExecutor::PoolExecutor(const std::size_t threadCount) noexcept
+{
+    const auto workerCount = std::max<std::size_t>(threadCount, 1);
+
+    _workers.reserve(workerCount);
+    for (auto i = 0ul; i < workerCount; ++i)
+        _workers.push([this] { work(); });
+}
+
+PoolExecutor::~PoolExecutor(void) noexcept
+{
+    {
+        std::lock_guard lock(_mutex);
+        _stop = true;
+    }
+    _condition.notify_all();
+    for (auto &worker : _workers)
+        worker.join();
+}
+
+PoolExecutor &PoolExecutor::Default(void) noexcept
+{
+    static PoolExecutor Executor;
+
+    return Executor;
+}
+
+void PoolExecutor::post(ExecutorNode &node) noexcept
+{
+    node.next.store(nullptr, std::memory_order_relaxed);
+    {
+        std::lock_guard lock(_mutex);
+        if (_last)
+            _last->next.store(&node, std::memory_order_relaxed);
+        else
+            _first = &node;
+        _last = &node;
+    }
+    _condition.notify_one();
+}
+
+void PoolExecutor::work(void) noexcept
+{
+    std::unique_lock lock(_mutex);
+
+    while (true) {
+        _condition.wait(lock, [this] { return _stop || _first; });
+        // Pending coroutines are still resumed when stopping
+        if (!_first)
+            return;
+        const auto node = _first;
+        _first = static_cast<ExecutorNode *>(node->next.load(std::memory_order_relaxed));
+        if (!_first)
+            _last = nullptr;
+        lock.unlock();
+        node->handle.resume();
+        lock.lock();
+    }
+}
+
+std::size_t ManualExecutor::poll(void) noexcept
+{
+    std::size_t count = 0;
+
+    while (const auto node = _queue.pop()) {
+        node->handle.resume();
+        ++count;
+    }
+    return count;
+}
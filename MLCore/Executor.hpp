@@ -0,0 +1,124 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Executor
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <mutex>
+#include <thread>
+
+#include "MPSCQueue.hpp"
+#include "Vector.hpp"
+
+namespace Core
+{
+    struct ExecutorNode;
+
+    class Executor;
+    class InlineExecutor;
+    class PoolExecutor;
+    class ManualExecutor;
+}
+
+/** @brief A coroutine waiting to be resumed by an executor
+ *  Nodes live in the suspended coroutine frame so posting never allocates */
+struct Core::ExecutorNode : public MPSCQueueNode
+{
+    std::coroutine_handle<> handle {};
+};
+
+/** @brief Interface of objects resuming suspended coroutines
+ *  'co_await executor.schedule()' moves the rest of a coroutine onto the executor */
+class Core::Executor
+{
+public:
+    /** @brief Awaiter posting the awaiting coroutine to its executor */
+    class ScheduleAwaiter : public ExecutorNode
+    {
+    public:
+        /** @brief Construct the awaiter */
+        explicit ScheduleAwaiter(Executor &executor) noexcept : _executor(&executor) {}
+
+        [[nodiscard]] bool await_ready(void) const noexcept { return false; }
+        void await_suspend(const std::coroutine_handle<> handle) noexcept { this->handle = handle; _executor->post(*this); }
+        void await_resume(void) const noexcept {}
+
+    private:
+        Executor *_executor {};
+    };
+
+
+    /** @brief Virtual destructor */
+    virtual ~Executor(void) noexcept = default;
+
+    /** @brief Resume the coroutine of a node, now or later, on a thread of the executor
+     *  The node must stay alive until its coroutine is resumed */
+    virtual void post(ExecutorNode &node) noexcept = 0;
+
+    /** @brief Get an awaiter resuming the awaiting coroutine on this executor */
+    [[nodiscard]] ScheduleAwaiter schedule(void) noexcept { return ScheduleAwaiter(*this); }
+};
+
+/** @brief Executor resuming coroutines immediately on the posting thread */
+class Core::InlineExecutor final : public Executor
+{
+public:
+    /** @brief Resume the node immediately */
+    void post(ExecutorNode &node) noexcept override { node.handle.resume(); }
+};
+
+/** @brief Executor resuming coroutines on its own worker threads, in posting order */
+class alignas_cacheline Core::PoolExecutor final : public Executor
+{
+public:
+    /** @brief Construct an executor of 'threadCount' worker threads */
+    explicit PoolExecutor(const std::size_t threadCount = std::thread::hardware_concurrency()) noexcept;
+
+    /** @brief Resume every pending coroutine then join all workers */
+    ~PoolExecutor(void) noexcept override;
+
+    /** @brief An executor is neither copyable nor movable */
+    PoolExecutor(const PoolExecutor &other) = delete;
+    PoolExecutor &operator=(const PoolExecutor &other) = delete;
+
+
+    /** @brief Get the global executor (hardware concurrency) */
+    [[nodiscard]] static PoolExecutor &Default(void) noexcept;
+
+
+    /** @brief Get the number of worker threads */
+    [[nodiscard]] std::size_t threadCount(void) const noexcept { return _workers.size(); }
+
+    /** @brief Queue a node for a worker */
+    void post(ExecutorNode &node) noexcept override;
+
+private:
+    std::mutex _mutex {};
+    std::condition_variable _condition {};
+    ExecutorNode *_first { nullptr };
+    ExecutorNode *_last { nullptr };
+    bool _stop { false };
+    Vector<std::thread> _workers {};
+
+    /** @brief Worker entry point */
+    void work(void) noexcept;
+};
+
+/** @brief Executor resuming coroutines when a thread polls it (I/O completion thread, audio thread, main loop, ...)
+ *  Any thread can post without blocking, a single thread at a time may poll */
+class Core::ManualExecutor final : public Executor
+{
+public:
+    /** @brief Queue a node until the next poll */
+    void post(ExecutorNode &node) noexcept override { _queue.push(&node); }
+
+    /** @brief Resume queued coroutines on the calling thread until the queue is empty (coroutines posted meanwhile included)
+     *  @return The number of resumed coroutines */
+    std::size_t poll(void) noexcept;
+
+private:
+    MPSCQueue<ExecutorNode> _queue {};
+};
@@ -12,13 +12,17 @@
 #include <algorithm>
 
 #include "FlatVector.hpp"
+#include "SharedFlatVector.hpp"
 
 namespace Core
 {
-    template<typename Type>
+    template<typename Type, typename VectorType = FlatVector<Type>>
     class FlatStringBase;
 
     using FlatString = FlatStringBase<char>;
+
+    /** @brief Copy-on-write flat string, copies share the same buffer until one of them is modified */
+    using SharedFlatString = FlatStringBase<char, SharedFlatVector<char>>;
 }
 
 /** @brief Flat string is pointer-sized std::string alternative that is NOT NULL TERMINATED
@@ -28,19 +32,19 @@ namespace Core
  * it is slower due to memory indirection
  * Because the string don't have small optimization, it will perform worse than an std::string with short strings
 */
-template<typename Type>
-class Core::FlatStringBase : public Core::FlatVector<Type>
+template<typename Type, typename VectorType>
+class Core::FlatStringBase : public VectorType
 {
 public:
-    using FlatVector<Type>::FlatVector;
-    using FlatVector<Type>::data;
-    using FlatVector<Type>::size;
-    using FlatVector<Type>::begin;
-    using FlatVector<Type>::end;
-    using FlatVector<Type>::resize;
-    using FlatVector<Type>::insert;
-    using FlatVector<Type>::empty;
-    using FlatVector<Type>::operator bool;
+    using VectorType::VectorType;
+    using VectorType::data;
+    using VectorType::size;
+    using VectorType::begin;
+    using VectorType::end;
+    using VectorType::resize;
+    using VectorType::insert;
+    using VectorType::empty;
+    using VectorType::operator bool;
 
     /** @brief Default constructor */
     FlatStringBase(void) noexcept = default;
@@ -81,6 +85,28 @@ public:
     /** @brief std::string_view assignment */
     FlatStringBase &operator=(const std::basic_string_view<Type> &other) noexcept { resize(other.begin(), other.end()); return *this; }
 
+    /** @brief Append another string, grows at most once */
+    FlatStringBase &append(const FlatStringBase &other) noexcept { VectorType::append(other.begin(), other.end()); return *this; }
+
+    /** @brief Append a cstring, grows at most once */
+    FlatStringBase &append(const char * const cstring) noexcept { VectorType::append(cstring, cstring + SafeStrlen(cstring)); return *this; }
+
+    /** @brief Append a std::string, grows at most once */
+    FlatStringBase &append(const std::basic_string<Type> &other) noexcept { VectorType::append(other.data(), other.data() + other.size()); return *this; }
+
+    /** @brief Append a std::string_view, grows at most once */
+    FlatStringBase &append(const std::basic_string_view<Type> &other) noexcept { VectorType::append(other.data(), other.data() + other.size()); return *this; }
+
+    /** @brief Append a single character */
+    FlatStringBase &append(const Type character) noexcept { VectorType::push(character); return *this; }
+
+    /** @brief Append operators */
+    FlatStringBase &operator+=(const FlatStringBase &other) noexcept { return append(other); }
+    FlatStringBase &operator+=(const char * const cstring) noexcept { return append(cstring); }
+    FlatStringBase &operator+=(const std::basic_string<Type> &other) noexcept { return append(other); }
+    FlatStringBase &operator+=(const std::basic_string_view<Type> &other) noexcept { return append(other); }
+    FlatStringBase &operator+=(const Type character) noexcept { return append(character); }
+
     /** @brief Comparison operator */
     [[nodiscard]] bool operator==(const FlatStringBase &other) const noexcept { return std::equal(begin(), end(), other.begin(), other.end()); }
     [[nodiscard]] bool operator!=(const FlatStringBase &other) const noexcept { return !operator==(other); }
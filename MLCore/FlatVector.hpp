@@ -5,24 +5,23 @@
 
 #pragma once
 
-#include <cstdlib>
-
+#include "Allocator.hpp"
 #include "VectorDetails.hpp"
 
 namespace Core
 {
     namespace Internal
     {
-        template<typename Type, typename Range>
+        template<typename Type, typename Range, typename Allocator>
         class FlatVectorBase;
     }
 
-    template<typename Type, typename Range = std::size_t>
-    using FlatVector = Internal::VectorDetails<Internal::FlatVectorBase<Type, Range>, Type, Range>;
+    template<typename Type, typename Range = std::size_t, typename Growth = GrowthPolicy::Default, typename Allocator = DefaultAllocator>
+    using FlatVector = Internal::VectorDetails<Internal::FlatVectorBase<Type, Range, Allocator>, Type, Range, Growth>;
 }
 
 /** @brief Base implementation of a vector with size and capacity allocated with data */
-template<typename Type, typename Range>
+template<typename Type, typename Range, typename Allocator>
 class Core::Internal::FlatVectorBase
 {
 public:
@@ -75,7 +74,7 @@ protected:
     [[nodiscard]] bool isSafe(void) const noexcept { return _ptr; }
 
     /** @brief Protected data setter */
-    void setData(Type * const data) noexcept { _ptr = reinterpret_cast<Header *>(data) - 1; }
+    void setData(Type * const data) noexcept { _ptr = data ? reinterpret_cast<Header *>(data) - 1 : nullptr; }
 
     /** @brief Protected size setter */
     void setSize(const Range size) noexcept { _ptr->size = size; }
@@ -91,13 +90,23 @@ protected:
     [[nodiscard]] ConstIterator endUnsafe(void) const noexcept { return data() + sizeUnsafe(); }
 
 
+    /** @brief Number of bytes allocated alongside the elements of each buffer */
+    static constexpr std::size_t AllocationOverhead = sizeof(Header);
+
     /** @brief Allocates a new buffer */
     [[nodiscard]] Type *allocate(const Range capacity) noexcept
-        { return reinterpret_cast<Type *>(reinterpret_cast<Header *>(std::malloc(sizeof(Header) + sizeof(Type) * capacity)) + 1); }
+        { return reinterpret_cast<Type *>(reinterpret_cast<Header *>(Allocator::Allocate(sizeof(Header) + sizeof(Type) * capacity)) + 1); }
+
+    /** @brief Get the real capacity of an allocated buffer */
+    [[nodiscard]] Range usableCapacity(Type * const data, const Range capacity) const noexcept
+    {
+        const auto bytes = Allocator::UsableSize(reinterpret_cast<Header *>(data) - 1, sizeof(Header) + sizeof(Type) * capacity);
+        return static_cast<Range>((bytes - sizeof(Header)) / sizeof(Type));
+    }
 
-    /** @brief Deallocates a buffer */
-    void deallocate(Type *data) noexcept
-        { std::free(reinterpret_cast<Header *>(data) - 1); }
+    /** @brief Deallocates a buffer of a given capacity */
+    void deallocate(Type *data, const Range capacity) noexcept
+        { Allocator::Deallocate(reinterpret_cast<Header *>(data) - 1, sizeof(Header) + sizeof(Type) * capacity); }
 
 private:
     Header *_ptr { nullptr };
@@ -0,0 +1,89 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: GrowthPolicy
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include "Utils.hpp"
+
+/** @brief Growth policies decide the capacity of a vector when it runs out of memory
+ *  A policy must provide :
+ *  - 'NextCapacity<Type, Range, Overhead>(capacity, minimum)' returning a capacity of at least 'capacity + minimum' (capacity is 0 on first allocation)
+ *    'Overhead' is the number of bytes the vector allocates alongside its elements (header of flat vectors)
+ *  - 'RoundToUsableSize' telling if the capacity must be extended to the real size of the allocated block */
+namespace Core::GrowthPolicy
+{
+    /** @brief Double the capacity (default) */
+    template<std::size_t InitialCapacity = 2>
+    struct Doubling
+    {
+        static constexpr bool RoundToUsableSize = false;
+
+        template<typename Type, typename Range, std::size_t Overhead = 0>
+        [[nodiscard]] static constexpr Range NextCapacity(const Range capacity, const Range minimum) noexcept
+        {
+            if (!capacity)
+                return std::max(static_cast<Range>(InitialCapacity), minimum);
+            return capacity + std::max(capacity, minimum);
+        }
+    };
+
+    /** @brief Grow the capacity by half, wasting at most a third of the buffer */
+    template<std::size_t InitialCapacity = 4>
+    struct OneAndHalf
+    {
+        static constexpr bool RoundToUsableSize = false;
+
+        template<typename Type, typename Range, std::size_t Overhead = 0>
+        [[nodiscard]] static constexpr Range NextCapacity(const Range capacity, const Range minimum) noexcept
+        {
+            if (!capacity)
+                return std::max(static_cast<Range>(InitialCapacity), minimum);
+            return capacity + std::max(static_cast<Range>(std::max(capacity / 2, Range(1))), minimum);
+        }
+    };
+
+    /** @brief Grow the capacity of a fixed number of elements, wastes at most 'Step' elements but push is O(n) amortized */
+    template<std::size_t Step>
+    struct FixedStep
+    {
+        static_assert(Step > 0, "FixedStep policy requires a non-zero step");
+
+        static constexpr bool RoundToUsableSize = false;
+
+        template<typename Type, typename Range, std::size_t Overhead = 0>
+        [[nodiscard]] static constexpr Range NextCapacity(const Range capacity, const Range minimum) noexcept
+            { return capacity + std::max(static_cast<Range>(Step), minimum); }
+    };
+
+    /** @brief Use a base policy then round the allocated size (overhead included) up to a whole number of pages */
+    template<std::size_t PageSize = 4096, typename Base = OneAndHalf<>>
+    struct PageGranular
+    {
+        static_assert(PageSize && !(PageSize & (PageSize - 1)), "PageGranular policy requires a power of 2 page size");
+
+        static constexpr bool RoundToUsableSize = Base::RoundToUsableSize;
+
+        template<typename Type, typename Range, std::size_t Overhead = 0>
+        [[nodiscard]] static constexpr Range NextCapacity(const Range capacity, const Range minimum) noexcept
+        {
+            const std::size_t bytes = Overhead + sizeof(Type) * Base::template NextCapacity<Type, Range, Overhead>(capacity, minimum);
+            const std::size_t roundedBytes = (bytes + PageSize - 1) & ~(PageSize - 1);
+            return static_cast<Range>((roundedBytes - Overhead) / sizeof(Type));
+        }
+    };
+
+    /** @brief Use a base policy then extend the capacity to the real size of the block returned by the allocator
+     *  This gives back memory that the allocator's size classes would have wasted anyway */
+    template<typename Base = Doubling<>>
+    struct UsableSize : public Base
+    {
+        static constexpr bool RoundToUsableSize = true;
+    };
+
+    /** @brief Default growth policy of every vector */
+    using Default = Doubling<>;
+}
@@ -0,0 +1,47 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: HugePageAllocator
+ */
+
+#pragma once
+
+#include "Allocator.hpp"
+#include "Memory.hpp"
+
+namespace Core
+{
+    template<std::size_t Threshold>
+    struct HugePageAllocator;
+}
+
+/** @brief Allocator that maps huge pages for large blocks and uses std::malloc for small ones
+ *  Large blocks are bound to the calling thread's NUMA node if one was set with Memory::SetThreadNumaNode
+ *  Large blocks are rounded to whole huge pages, use GrowthPolicy::UsableSize to make that space usable */
+template<std::size_t Threshold = Core::Memory::HugePageSize>
+struct Core::HugePageAllocator
+{
+    /** @brief Allocates a block of memory */
+    [[nodiscard]] static void *Allocate(const std::size_t bytes) noexcept
+    {
+        if (bytes < Threshold)
+            return MallocAllocator::Allocate(bytes);
+        return Memory::MapHuge(Memory::RoundToHugePage(bytes));
+    }
+
+    /** @brief Deallocates a block of memory */
+    static void Deallocate(void * const data, const std::size_t bytes) noexcept
+    {
+        if (bytes < Threshold)
+            MallocAllocator::Deallocate(data, bytes);
+        else
+            Memory::UnmapHuge(data, Memory::RoundToHugePage(bytes));
+    }
+
+    /** @brief Get the real size of a block */
+    [[nodiscard]] static std::size_t UsableSize(void * const data, const std::size_t bytes) noexcept
+    {
+        if (bytes < Threshold)
+            return std::min(MallocAllocator::UsableSize(data, bytes), Threshold - 1);
+        return Memory::RoundToHugePage(bytes);
+    }
+};
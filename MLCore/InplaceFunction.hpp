@@ -0,0 +1,198 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Allocation-free function wrappers with an inline buffer
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "Utils.hpp"
+#include "Assert.hpp"
+
+namespace Core
+{
+    /** @brief Alignment of the inline buffer of function wrappers */
+    constexpr std::size_t FunctionAlignment = alignof(std::max_align_t);
+
+    template<typename Signature, std::size_t Capacity = CacheLineSize - 2 * sizeof(void *), bool MoveOnly = false>
+    class InplaceFunction;
+
+    /** @brief Move-only inline function, accepts callables that cannot be copied */
+    template<typename Signature, std::size_t Capacity = CacheLineSize - 2 * sizeof(void *)>
+    using MoveOnlyFunction = InplaceFunction<Signature, Capacity, true>;
+
+    template<typename Signature, std::size_t Capacity = CacheLineSize - sizeof(void *)>
+    class TrivialFunction;
+}
+
+/** @brief std::function alternative storing its callable in a fixed inline buffer, it never allocates
+ *  A callable that does not fit the buffer is a compile-time error
+ *  Trivially copyable callables are moved and copied with memcpy and need no destruction */
+template<typename Return, typename ...Args, std::size_t Capacity, bool MoveOnly>
+class Core::InplaceFunction<Return(Args...), Capacity, MoveOnly>
+{
+public:
+    /** @brief Check if a callable can be stored */
+    template<typename Functor>
+    static constexpr bool IsStorable = sizeof(Functor) <= Capacity && alignof(Functor) <= FunctionAlignment;
+
+
+    /** @brief Default constructor, the function is empty */
+    InplaceFunction(void) noexcept = default;
+
+    /** @brief Null constructor, the function is empty */
+    InplaceFunction(std::nullptr_t) noexcept {}
+
+    /** @brief Callable constructor */
+    template<typename Functor, typename Decayed = std::decay_t<Functor>,
+            std::enable_if_t<!std::is_same_v<Decayed, InplaceFunction> && std::is_invocable_r_v<Return, Decayed &, Args...>, int> = 0>
+    InplaceFunction(Functor &&functor) noexcept_constructible(Decayed, Functor)
+        { construct<Decayed>(std::forward<Functor>(functor)); }
+
+    /** @brief Copy constructor */
+    InplaceFunction(const InplaceFunction &other) requires (!MoveOnly) { copy(other); }
+
+    /** @brief Move constructor */
+    InplaceFunction(InplaceFunction &&other) noexcept { move(other); }
+
+    /** @brief Destroy the callable */
+    ~InplaceFunction(void) noexcept { reset(); }
+
+    /** @brief Copy assignment */
+    InplaceFunction &operator=(const InplaceFunction &other) requires (!MoveOnly);
+
+    /** @brief Move assignment */
+    InplaceFunction &operator=(InplaceFunction &&other) noexcept;
+
+    /** @brief Null assignment, the function becomes empty */
+    InplaceFunction &operator=(std::nullptr_t) noexcept { reset(); return *this; }
+
+    /** @brief Callable assignment */
+    template<typename Functor, typename Decayed = std::decay_t<Functor>,
+            std::enable_if_t<!std::is_same_v<Decayed, InplaceFunction> && std::is_invocable_r_v<Return, Decayed &, Args...>, int> = 0>
+    InplaceFunction &operator=(Functor &&functor) noexcept_constructible(Decayed, Functor)
+        { reset(); construct<Decayed>(std::forward<Functor>(functor)); return *this; }
+
+
+    /** @brief Check if the function holds a callable */
+    [[nodiscard]] operator bool(void) const noexcept { return _invoke; }
+
+    /** @brief Check if the stored callable is moved with memcpy */
+    [[nodiscard]] bool isTrivial(void) const noexcept { return !_manage; }
+
+
+    /** @brief Invoke the callable, the function must not be empty (asserted in debug) */
+    Return operator()(Args ...args) const
+    {
+        coreAssert(_invoke,
+            coreDebugThrow(std::logic_error("Core::InplaceFunction::operator(): Function is empty")));
+        return _invoke(_storage, std::forward<Args>(args)...);
+    }
+
+
+    /** @brief Destroy the callable, the function becomes empty */
+    void reset(void) noexcept;
+
+private:
+    /** @brief Operations of non-trivial callables */
+    enum class Operation
+    {
+        Relocate,
+        Copy,
+        Destroy
+    };
+
+    using Invoker = Return(*)(void *, Args &&...);
+    using Manager = void(*)(const Operation, void *, void *);
+
+    alignas(FunctionAlignment) mutable std::byte _storage[Capacity];
+    Invoker _invoke { nullptr };
+    Manager _manage { nullptr };
+
+    /** @brief Construct a callable into the storage */
+    template<typename Functor, typename Argument>
+    void construct(Argument &&functor) noexcept_constructible(Functor, Argument);
+
+    /** @brief Copy another function (empty storage only) */
+    void copy(const InplaceFunction &other);
+
+    /** @brief Move another function (empty storage only), 'other' becomes empty */
+    void move(InplaceFunction &other) noexcept;
+
+    /** @brief Invoke a callable of a given type */
+    template<typename Functor>
+    static Return Invoke(void * const storage, Args &&...args)
+        { return std::invoke(*std::launder(reinterpret_cast<Functor *>(storage)), std::forward<Args>(args)...); }
+
+    /** @brief Manage a non-trivial callable of a given type */
+    template<typename Functor>
+    static void Manage(const Operation operation, void * const destination, void * const source);
+};
+
+/** @brief Function wrapper restricted to trivially copyable callables (function pointers, lambdas capturing values)
+ *  The wrapper itself is trivially copyable so it can be stored in lock-free queues and be copied with memcpy */
+template<typename Return, typename ...Args, std::size_t Capacity>
+class Core::TrivialFunction<Return(Args...), Capacity>
+{
+public:
+    /** @brief Check if a callable can be stored */
+    template<typename Functor>
+    static constexpr bool IsStorable = sizeof(Functor) <= Capacity && alignof(Functor) <= FunctionAlignment
+        && std::is_trivially_copyable_v<Functor> && std::is_trivially_destructible_v<Functor>;
+
+
+    /** @brief Default constructor, the function is empty */
+    TrivialFunction(void) noexcept = default;
+
+    /** @brief Null constructor, the function is empty */
+    TrivialFunction(std::nullptr_t) noexcept {}
+
+    /** @brief Callable constructor */
+    template<typename Functor, typename Decayed = std::decay_t<Functor>,
+            std::enable_if_t<!std::is_same_v<Decayed, TrivialFunction> && std::is_invocable_r_v<Return, Decayed &, Args...>, int> = 0>
+    TrivialFunction(Functor &&functor) noexcept
+    {
+        static_assert(IsStorable<Decayed>, "TrivialFunction: callable must be trivially copyable and fit the inline buffer");
+
+        if constexpr (std::is_pointer_v<Decayed> || std::is_member_pointer_v<Decayed>) {
+            if (!functor)
+                return;
+        }
+        new (_storage) Decayed(std::forward<Functor>(functor));
+        _invoke = &Invoke<Decayed>;
+    }
+
+
+    /** @brief Check if the function holds a callable */
+    [[nodiscard]] operator bool(void) const noexcept { return _invoke; }
+
+    /** @brief Invoke the callable, the function must not be empty (asserted in debug) */
+    Return operator()(Args ...args) const
+    {
+        coreAssert(_invoke,
+            coreDebugThrow(std::logic_error("Core::TrivialFunction::operator(): Function is empty")));
+        return _invoke(_storage, std::forward<Args>(args)...);
+    }
+
+    /** @brief The function becomes empty */
+    void reset(void) noexcept { _invoke = nullptr; }
+
+private:
+    using Invoker = Return(*)(void *, Args &&...);
+
+    alignas(FunctionAlignment) mutable std::byte _storage[Capacity];
+    Invoker _invoke { nullptr };
+
+    /** @brief Invoke a callable of a given type */
+    template<typename Functor>
+    static Return Invoke(void * const storage, Args &&...args)
+        { return std::invoke(*std::launder(reinterpret_cast<Functor *>(storage)), std::forward<Args>(args)...); }
+};
+
+#include "InplaceFunction.ipp"
@@ -0,0 +1,99 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Allocation-free function wrappers with an inline buffer
+ */
+
+template<typename Return, typename ...Args, std::size_t Capacity, bool MoveOnly>
+inline Core::InplaceFunction<Return(Args...), Capacity, MoveOnly> &
+    Core::InplaceFunction<Return(Args...), Capacity, MoveOnly>::operator=(const InplaceFunction &other) requires (!MoveOnly)
+{
+    if (this != &other) {
+        reset();
+        copy(other);
+    }
+    return *this;
+}
+
+template<typename Return, typename ...Args, std::size_t Capacity, bool MoveOnly>
+inline Core::InplaceFunction<Return(Args...), Capacity, MoveOnly> &
+    Core::InplaceFunction<Return(Args...), Capacity, MoveOnly>::operator=(InplaceFunction &&other) noexcept
+{
+    if (this != &other) {
+        reset();
+        move(other);
+    }
+    return *this;
+}
+
+template<typename Return, typename ...Args, std::size_t Capacity, bool MoveOnly>
+inline void Core::InplaceFunction<Return(Args...), Capacity, MoveOnly>::reset(void) noexcept
+{
+    if (_manage) {
+        _manage(Operation::Destroy, _storage, nullptr);
+        _manage = nullptr;
+    }
+    _invoke = nullptr;
+}
+
+template<typename Return, typename ...Args, std::size_t Capacity, bool MoveOnly>
+template<typename Functor, typename Argument>
+inline void Core::InplaceFunction<Return(Args...), Capacity, MoveOnly>::construct(Argument &&functor)
+    noexcept_constructible(Functor, Argument)
+{
+    static_assert(IsStorable<Functor>, "InplaceFunction: callable does not fit the inline buffer, increase Capacity");
+    static_assert(MoveOnly || std::is_copy_constructible_v<Functor>, "InplaceFunction: callable must be copyable, use MoveOnlyFunction");
+    static_assert(std::is_nothrow_move_constructible_v<Functor>, "InplaceFunction: callable must be nothrow move constructible");
+
+    if constexpr (std::is_pointer_v<Functor> || std::is_member_pointer_v<Functor>) {
+        if (!functor)
+            return;
+    }
+    new (_storage) Functor(std::forward<Argument>(functor));
+    _invoke = &Invoke<Functor>;
+    if constexpr (!std::is_trivially_copyable_v<Functor>)
+        _manage = &Manage<Functor>;
+}
+
+template<typename Return, typename ...Args, std::size_t Capacity, bool MoveOnly>
+inline void Core::InplaceFunction<Return(Args...), Capacity, MoveOnly>::copy(const InplaceFunction &other)
+{
+    if (other._manage)
+        other._manage(Operation::Copy, _storage, other._storage);
+    else if (other._invoke)
+        std::memcpy(_storage, other._storage, Capacity);
+    _invoke = other._invoke;
+    _manage = other._manage;
+}
+
+template<typename Return, typename ...Args, std::size_t Capacity, bool MoveOnly>
+inline void Core::InplaceFunction<Return(Args...), Capacity, MoveOnly>::move(InplaceFunction &other) noexcept
+{
+    if (other._manage)
+        other._manage(Operation::Relocate, _storage, other._storage);
+    else if (other._invoke)
+        std::memcpy(_storage, other._storage, Capacity);
+    _invoke = std::exchange(other._invoke, nullptr);
+    _manage = std::exchange(other._manage, nullptr);
+}
+
+template<typename Return, typename ...Args, std::size_t Capacity, bool MoveOnly>
+template<typename Functor>
+inline void Core::InplaceFunction<Return(Args...), Capacity, MoveOnly>::Manage(const Operation operation, void * const destination, void * const source)
+{
+    switch (operation) {
+    case Operation::Relocate:
+    {
+        const auto functor = std::launder(reinterpret_cast<Functor *>(source));
+        new (destination) Functor(std::move(*functor));
+        functor->~Functor();
+        break;
+    }
+    case Operation::Copy:
+        if constexpr (!MoveOnly)
+            new (destination) Functor(*std::launder(reinterpret_cast<const Functor *>(source)));
+        break;
+    case Operation::Destroy:
+        std::launder(reinterpret_cast<Functor *>(destination))->~Functor();
+        break;
+    }
+}
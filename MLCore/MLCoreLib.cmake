@@ -5,13 +5,65 @@ get_filename_component(MLCoreLibDir ${CMAKE_CURRENT_LIST_FILE} PATH)
 set(MLCoreLibSources
     ${MLCoreLibDir}/Assert.hpp
     ${MLCoreLibDir}/Utils.hpp
+    ${MLCoreLibDir}/GrowthPolicy.hpp
+    ${MLCoreLibDir}/Allocator.hpp
+    ${MLCoreLibDir}/Memory.hpp
+    ${MLCoreLibDir}/Memory.cpp
+    ${MLCoreLibDir}/HugePageAllocator.hpp
+    ${MLCoreLibDir}/PoolAllocator.hpp
+    ${MLCoreLibDir}/PoolAllocator.cpp
     ${MLCoreLibDir}/VectorDetails.hpp
     ${MLCoreLibDir}/VectorDetails.ipp
     ${MLCoreLibDir}/Vector.hpp
     ${MLCoreLibDir}/Vector.ipp
     ${MLCoreLibDir}/FlatVector.hpp
+    ${MLCoreLibDir}/SharedFlatVector.hpp
+    ${MLCoreLibDir}/SharedFlatVector.ipp
     ${MLCoreLibDir}/FlatString.hpp
     ${MLCoreLibDir}/FlatString.ipp
+    ${MLCoreLibDir}/CompressedVector.hpp
+    ${MLCoreLibDir}/CompressedVector.ipp
+    ${MLCoreLibDir}/StaticVector.hpp
+    ${MLCoreLibDir}/StaticVector.ipp
+    ${MLCoreLibDir}/StaticString.hpp
+    ${MLCoreLibDir}/StringBuilder.hpp
+    ${MLCoreLibDir}/StringBuilder.ipp
+    ${MLCoreLibDir}/InplaceFunction.hpp
+    ${MLCoreLibDir}/InplaceFunction.ipp
+    ${MLCoreLibDir}/Mutex.hpp
+    ${MLCoreLibDir}/Mutex.cpp
+    ${MLCoreLibDir}/ThreadPool.hpp
+    ${MLCoreLibDir}/ThreadPool.cpp
+    ${MLCoreLibDir}/Thread.hpp
+    ${MLCoreLibDir}/Thread.cpp
+    ${MLCoreLibDir}/Parallel.hpp
+    ${MLCoreLibDir}/Parallel.ipp
+    ${MLCoreLibDir}/RadixSort.hpp
+    ${MLCoreLibDir}/RadixSort.ipp
+    ${MLCoreLibDir}/BitVector.hpp
+    ${MLCoreLibDir}/BitVector.cpp
+    ${MLCoreLibDir}/SlotMap.hpp
+    ${MLCoreLibDir}/SlotMap.ipp
+    ${MLCoreLibDir}/CircularBuffer.hpp
+    ${MLCoreLibDir}/CircularBuffer.ipp
+    ${MLCoreLibDir}/SPSCQueue.hpp
+    ${MLCoreLibDir}/Streamer.hpp
+    ${MLCoreLibDir}/Streamer.cpp
+    ${MLCoreLibDir}/EventBuffer.hpp
+    ${MLCoreLibDir}/EventBuffer.ipp
+    ${MLCoreLibDir}/MPSCQueue.hpp
+    ${MLCoreLibDir}/NodePool.hpp
+    ${MLCoreLibDir}/NodePool.ipp
+    ${MLCoreLibDir}/Executor.hpp
+    ${MLCoreLibDir}/Executor.cpp
+    ${MLCoreLibDir}/Task.hpp
+    ${MLCoreLibDir}/Task.ipp
+    ${MLCoreLibDir}/Task.cpp
+    ${MLCoreLibDir}/Snapshot.hpp
+    ${MLCoreLibDir}/Snapshot.ipp
+    ${MLCoreLibDir}/ContainerMetrics.hpp
+    ${MLCoreLibDir}/Metrics.hpp
+    ${MLCoreLibDir}/Metrics.cpp
     ${MLCoreLibDir}/Core.cpp
 )
 
@@ -19,6 +71,27 @@ add_library(${PROJECT_NAME} ${MLCoreLibSources})
 
 target_include_directories(${PROJECT_NAME} PUBLIC ${MLCoreDir})
 
-# target_link_libraries(${PROJECT_NAME}
-# PUBLIC
-# )
+if (${ML_CONTAINER_METRICS})
+    target_compile_definitions(${PROJECT_NAME} PUBLIC CORE_CONTAINER_METRICS)
+endif ()
+
+if (${ML_CONTAINER_ACCOUNTING})
+    target_compile_definitions(${PROJECT_NAME} PUBLIC CORE_CONTAINER_ACCOUNTING)
+endif ()
+
+# Enables the AVX2 code paths (BitVector bulk operations), the resulting binaries require an AVX2 CPU
+if (${ML_AVX2})
+    target_compile_options(${PROJECT_NAME} PUBLIC -mavx2)
+endif ()
+
+if (${ML_TSAN})
+    target_compile_options(${PROJECT_NAME} PUBLIC -fsanitize=thread)
+    target_link_options(${PROJECT_NAME} PUBLIC -fsanitize=thread)
+endif ()
+
+find_package(Threads REQUIRED)
+
+target_link_libraries(${PROJECT_NAME}
+PUBLIC
+    Threads::Threads
+)
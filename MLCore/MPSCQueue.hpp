@@ -0,0 +1,98 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: MPSCQueue
+ */
+
+#pragma once
+
+#include <atomic>
+#include <type_traits>
+
+#include "Utils.hpp"
+
+namespace Core
+{
+    struct MPSCQueueNode;
+
+    template<typename Type>
+    class MPSCQueue;
+}
+
+/** @brief Intrusive hook of MPSCQueue elements */
+struct Core::MPSCQueueNode
+{
+    std::atomic<MPSCQueueNode *> next { nullptr };
+};
+
+/** @brief Intrusive unbounded multiple producers / single consumer queue (Vyukov)
+ *  Elements derive from MPSCQueueNode, the queue never allocates and never owns its elements
+ *  Producers push with a single atomic exchange (wait-free), the consumer pops with plain loads on the fast path
+ *  A pop may transiently return nullptr while a producer is between its exchange and its link, the element shows up on a later pop */
+template<typename Type>
+class alignas_cacheline Core::MPSCQueue
+{
+public:
+    static_assert(std::is_base_of_v<MPSCQueueNode, Type>, "MPSCQueue: elements must derive from MPSCQueueNode");
+
+    /** @brief Construct an empty queue */
+    MPSCQueue(void) noexcept : _head(&_stub), _tail(&_stub) {}
+
+    /** @brief A queue is neither copyable nor movable since its stub node is referenced */
+    MPSCQueue(const MPSCQueue &other) = delete;
+    MPSCQueue &operator=(const MPSCQueue &other) = delete;
+
+
+    /** @brief Push an element (any thread), the element must not be in a queue */
+    void push(Type * const element) noexcept { pushNode(element); }
+
+    /** @brief Pop an element (consumer only), returns nullptr if the queue is empty */
+    [[nodiscard]] Type *pop(void) noexcept;
+
+    /** @brief Approximative empty check (consumer only) */
+    [[nodiscard]] bool empty(void) const noexcept
+        { return _tail == &_stub && !_stub.next.load(std::memory_order_acquire); }
+
+private:
+    alignas_cacheline std::atomic<MPSCQueueNode *> _head;
+    alignas_cacheline MPSCQueueNode *_tail;
+    MPSCQueueNode _stub {};
+
+    /** @brief Link a node at the head of the queue */
+    void pushNode(MPSCQueueNode * const node) noexcept
+    {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        const auto previous = _head.exchange(node, std::memory_order_acq_rel);
+        previous->next.store(node, std::memory_order_release);
+    }
+};
+
+template<typename Type>
+inline Type *Core::MPSCQueue<Type>::pop(void) noexcept
+{
+    auto tail = _tail;
+    auto next = tail->next.load(std::memory_order_acquire);
+
+    // Skip the stub node
+    if (tail == &_stub) {
+        if (!next)
+            return nullptr;
+        _tail = next;
+        tail = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+    if (next) {
+        _tail = next;
+        return static_cast<Type *>(tail);
+    }
+    // 'tail' is the last linked node, if the head moved a producer is linking a new node
+    if (tail != _head.load(std::memory_order_acquire))
+        return nullptr;
+    // Re-insert the stub behind the last node so that it can be popped
+    pushNode(&_stub);
+    next = tail->next.load(std::memory_order_acquire);
+    if (next) {
+        _tail = next;
+        return static_cast<Type *>(tail);
+    }
+    return nullptr;
+}
@@ -0,0 +1,230 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Memory
+ */
+
+#include <cstdlib>
+#include <cstdint>
+
+#ifdef __linux__
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+# include <sched.h>
+# include <dirent.h>
+# include <cstring>
+#endif
+
+#include "Memory.hpp"
+
+using namespace Core;
+
+namespace
+{
+    thread_local int ThreadNode = -1;
+
+#ifdef __linux__
+    /** @brief Values of <numaif.h>, redefined so libnuma headers are not required */
+    constexpr int MpolPreferred = 1;
+    constexpr unsigned MpolMoveFlag = 1u << 1;
+#endif
+}
+
+std::size_t Memory::PageSize(void) noexcept
+{
+#ifdef __linux__
+    static const std::size_t Size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return Size;
+#else
+    return 4096;
+#endif
+}
+
+void *Memory::MapHuge(const std::size_t bytes) noexcept
+{
+#ifdef __linux__
+    constexpr int Protection = PROT_READ | PROT_WRITE;
+    constexpr int Flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    void *data = MAP_FAILED;
+
+# ifdef MAP_HUGETLB
+    data = ::mmap(nullptr, bytes, Protection, Flags | MAP_HUGETLB, -1, 0);
+# endif
+    if (data == MAP_FAILED) {
+        data = ::mmap(nullptr, bytes, Protection, Flags, -1, 0);
+        if (data == MAP_FAILED)
+            return nullptr;
+# ifdef MADV_HUGEPAGE
+        ::madvise(data, bytes, MADV_HUGEPAGE);
+# endif
+    }
+    if (const auto node = ThreadNode; node >= 0)
+        BindToNumaNode(data, bytes, node);
+    return data;
+#else
+    return std::malloc(bytes);
+#endif
+}
+
+void Memory::UnmapHuge(void * const data, const std::size_t bytes) noexcept
+{
+#ifdef __linux__
+    ::munmap(data, bytes);
+#else
+    static_cast<void>(bytes);
+    std::free(data);
+#endif
+}
+
+void *Memory::MapMirrored(const std::size_t bytes) noexcept
+{
+#if defined(__linux__) && defined(SYS_memfd_create)
+    constexpr unsigned MemfdCloseOnExec = 1u;
+    constexpr int Protection = PROT_READ | PROT_WRITE;
+
+    if (!bytes || bytes % PageSize())
+        return nullptr;
+    const auto fd = static_cast<int>(::syscall(SYS_memfd_create, "CoreMirror", MemfdCloseOnExec));
+    if (fd < 0)
+        return nullptr;
+    void *data = nullptr;
+    // Reserve the whole range first so both views are adjacent, then map the same file over each half
+    if (!::ftruncate(fd, static_cast<off_t>(bytes))) {
+        const auto base = ::mmap(nullptr, bytes * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base != MAP_FAILED) {
+            const auto first = ::mmap(base, bytes, Protection, MAP_SHARED | MAP_FIXED, fd, 0);
+            const auto second = ::mmap(reinterpret_cast<std::uint8_t *>(base) + bytes, bytes, Protection, MAP_SHARED | MAP_FIXED, fd, 0);
+            if (first != MAP_FAILED && second != MAP_FAILED)
+                data = base;
+            else
+                ::munmap(base, bytes * 2);
+        }
+    }
+    ::close(fd);
+    return data;
+#else
+    static_cast<void>(bytes);
+    return nullptr;
+#endif
+}
+
+void Memory::UnmapMirrored(void * const data, const std::size_t bytes) noexcept
+{
+#ifdef __linux__
+    ::munmap(data, bytes * 2);
+#else
+    static_cast<void>(data);
+    static_cast<void>(bytes);
+#endif
+}
+
+int Memory::NumaNodeCount(void) noexcept
+{
+#ifdef __linux__
+    static const int Count = [] {
+        int count = 0;
+        if (const auto dir = ::opendir("/sys/devices/system/node"); dir) {
+            while (const auto entry = ::readdir(dir)) {
+                if (!std::strncmp(entry->d_name, "node", 4) && entry->d_name[4] >= '0' && entry->d_name[4] <= '9')
+                    ++count;
+            }
+            ::closedir(dir);
+        }
+        return count ? count : 1;
+    }();
+    return Count;
+#else
+    return 1;
+#endif
+}
+
+int Memory::CurrentNumaNode(void) noexcept
+{
+#if defined(__linux__) && defined(SYS_getcpu)
+    unsigned cpu = 0;
+    unsigned node = 0;
+
+    if (::syscall(SYS_getcpu, &cpu, &node, nullptr))
+        return 0;
+    return static_cast<int>(node);
+#else
+    return 0;
+#endif
+}
+
+void Memory::SetThreadNumaNode(const int node) noexcept
+{
+    ThreadNode = node;
+}
+
+int Memory::ThreadNumaNode(void) noexcept
+{
+    return ThreadNode;
+}
+
+bool Memory::BindToNumaNode(void * const data, const std::size_t bytes, const int node) noexcept
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    constexpr auto MaskBits = sizeof(unsigned long) * 8;
+
+    if (node < 0 || static_cast<std::size_t>(node) >= MaskBits || node >= NumaNodeCount())
+        return false;
+    const unsigned long mask = 1ul << node;
+    return !::syscall(SYS_mbind, data, bytes, MpolPreferred, &mask, MaskBits, MpolMoveFlag);
+#else
+    static_cast<void>(data);
+    static_cast<void>(bytes);
+    static_cast<void>(node);
+    return false;
+#endif
+}
+
+void Memory::FirstTouch(void * const data, const std::size_t bytes) noexcept
+{
+    const auto pageSize = PageSize();
+    auto * const begin = reinterpret_cast<volatile std::uint8_t *>(data);
+
+    for (std::size_t offset = 0; offset < bytes; offset += pageSize)
+        begin[offset] = begin[offset];
+}
+
+bool Memory::Lock(const void * const data, const std::size_t bytes) noexcept
+{
+#ifdef __linux__
+    return !::mlock(data, bytes);
+#else
+    static_cast<void>(data);
+    static_cast<void>(bytes);
+    return false;
+#endif
+}
+
+bool Memory::Unlock(const void * const data, const std::size_t bytes) noexcept
+{
+#ifdef __linux__
+    return !::munlock(data, bytes);
+#else
+    static_cast<void>(data);
+    static_cast<void>(bytes);
+    return false;
+#endif
+}
+
+bool Memory::LockAll(const bool future) noexcept
+{
+#ifdef __linux__
+    return !::mlockall(MCL_CURRENT | (future ? MCL_FUTURE : 0));
+#else
+    static_cast<void>(future);
+    return false;
+#endif
+}
+
+bool Memory::UnlockAll(void) noexcept
+{
+#ifdef __linux__
+    return !::munlockall();
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,77 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Memory
+ */
+
+#pragma once
+
+#include <cstddef>
+
+/** @brief Low-level virtual memory helpers
+ *  On platforms without mmap / NUMA support every function degrades to a portable fallback */
+namespace Core::Memory
+{
+    /** @brief Size of a transparent huge page */
+    constexpr std::size_t HugePageSize = 2ul * 1024ul * 1024ul;
+
+    /** @brief Size of a regular page */
+    [[nodiscard]] std::size_t PageSize(void) noexcept;
+
+
+    /** @brief Round a size up to a whole number of huge pages */
+    [[nodiscard]] constexpr std::size_t RoundToHugePage(const std::size_t bytes) noexcept
+        { return (bytes + HugePageSize - 1) & ~(HugePageSize - 1); }
+
+    /** @brief Map 'bytes' of anonymous memory backed by huge pages when possible
+     *  Tries explicit huge pages (MAP_HUGETLB) first then falls back to transparent huge pages (MADV_HUGEPAGE)
+     *  If the calling thread has a preferred NUMA node, the mapping is bound to it
+     *  'bytes' must be a multiple of HugePageSize, returns nullptr on failure */
+    [[nodiscard]] void *MapHuge(const std::size_t bytes) noexcept;
+
+    /** @brief Unmap memory returned by MapHuge */
+    void UnmapHuge(void * const data, const std::size_t bytes) noexcept;
+
+
+    /** @brief Map 'bytes' of memory twice in a row, so that [data + bytes, data + 2 * bytes) aliases [data, data + bytes)
+     *  Any window of at most 'bytes' starting inside the first mapping is contiguous (used by ring buffers)
+     *  'bytes' must be a multiple of PageSize(), returns nullptr if the platform does not support it */
+    [[nodiscard]] void *MapMirrored(const std::size_t bytes) noexcept;
+
+    /** @brief Unmap memory returned by MapMirrored */
+    void UnmapMirrored(void * const data, const std::size_t bytes) noexcept;
+
+
+    /** @brief Get the number of NUMA nodes of the machine (1 if NUMA is not supported) */
+    [[nodiscard]] int NumaNodeCount(void) noexcept;
+
+    /** @brief Get the NUMA node of the CPU the calling thread is running on (0 if NUMA is not supported) */
+    [[nodiscard]] int CurrentNumaNode(void) noexcept;
+
+    /** @brief Set / get the NUMA node the calling thread's large allocations are bound to (-1 means no binding) */
+    void SetThreadNumaNode(const int node) noexcept;
+    [[nodiscard]] int ThreadNumaNode(void) noexcept;
+
+    /** @brief Bind a page-aligned memory range to a NUMA node, pages already touched are migrated
+     *  @return False if the binding is not supported or failed, the memory stays usable */
+    bool BindToNumaNode(void * const data, const std::size_t bytes, const int node) noexcept;
+
+
+    /** @brief Touch every page of a memory range so it is physically allocated by the calling thread
+     *  Calling this from the worker that consumes the memory places pages on its NUMA node (first-touch policy) */
+    void FirstTouch(void * const data, const std::size_t bytes) noexcept;
+
+
+    /** @brief Lock a memory range in RAM so real-time threads never page fault on it
+     *  @return False if locking is not supported or not allowed (RLIMIT_MEMLOCK), the memory stays usable */
+    bool Lock(const void * const data, const std::size_t bytes) noexcept;
+
+    /** @brief Unlock a memory range locked by Lock */
+    bool Unlock(const void * const data, const std::size_t bytes) noexcept;
+
+    /** @brief Lock every page currently mapped by the process, and every page mapped later if 'future' is true
+     *  @return False if locking is not supported or not allowed, the process keeps running unlocked */
+    bool LockAll(const bool future = true) noexcept;
+
+    /** @brief Unlock every page of the process */
+    bool UnlockAll(void) noexcept;
+}
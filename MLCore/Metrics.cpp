@@ -0,0 +1,340 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Metrics
+ */
+
+#include <algorithm>
+#include <charconv>
+#include <utility>
+
+#include "Metrics.hpp"
+#include "ContainerMetrics.hpp"
+
+using namespace Core;
+
+namespace
+{
+    /** @brief Head of the container accounts list, accounts are never unlinked */
+    std::atomic<ContainerMetrics::Account *> AccountsHead { nullptr };
+
+    template<typename Value>
+    void AppendNumber(std::string &out, const Value value) noexcept
+    {
+        char buffer[32];
+        const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        out.append(buffer, result.ptr);
+    }
+}
+
+ShardedCounter::ShardedCounter(const std::string_view name) noexcept
+    : _name(name)
+{
+    MetricsRegistry::Get().add(*this);
+}
+
+ShardedCounter::~ShardedCounter(void) noexcept
+{
+    if (!_name.empty())
+        MetricsRegistry::Get().remove(*this);
+}
+
+std::int64_t ShardedCounter::load(void) const noexcept
+{
+    std::int64_t total = 0;
+
+    for (const auto &shard : _shards)
+        total += shard.value.load(std::memory_order_relaxed);
+    return total;
+}
+
+void ShardedCounter::reset(void) noexcept
+{
+    for (auto &shard : _shards)
+        shard.value.store(0, std::memory_order_relaxed);
+}
+
+std::uint64_t Histogram::Snapshot::percentile(const double percent) const noexcept
+{
+    if (!count)
+        return 0;
+    const auto clamped = std::clamp(percent, 0.0, 100.0);
+    const auto target = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(clamped / 100.0 * static_cast<double>(count) + 0.5));
+    std::uint64_t accumulated = 0;
+
+    for (auto i = 0ul; i < BucketCount; ++i) {
+        accumulated += buckets[i];
+        if (accumulated >= target)
+            return std::min(BucketUpperBound(i), max);
+    }
+    return max;
+}
+
+Histogram::Histogram(const std::string_view name) noexcept
+    : _name(name)
+{
+    MetricsRegistry::Get().add(*this);
+}
+
+Histogram::~Histogram(void) noexcept
+{
+    if (!_name.empty())
+        MetricsRegistry::Get().remove(*this);
+}
+
+void Histogram::record(const std::uint64_t value) noexcept
+{
+    _buckets[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(value, std::memory_order_relaxed);
+    auto currentMax = _max.load(std::memory_order_relaxed);
+    while (currentMax < value && !_max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed));
+}
+
+Histogram::Snapshot Histogram::snapshot(void) const noexcept
+{
+    Snapshot snapshot;
+
+    for (auto i = 0ul; i < BucketCount; ++i) {
+        snapshot.buckets[i] = _buckets[i].load(std::memory_order_relaxed);
+        snapshot.count += snapshot.buckets[i];
+    }
+    snapshot.sum = _sum.load(std::memory_order_relaxed);
+    snapshot.max = _max.load(std::memory_order_relaxed);
+    return snapshot;
+}
+
+void Histogram::reset(void) noexcept
+{
+    for (auto &bucket : _buckets)
+        bucket.store(0, std::memory_order_relaxed);
+    _sum.store(0, std::memory_order_relaxed);
+    _max.store(0, std::memory_order_relaxed);
+}
+
+template<typename Type>
+void MetricsRegistry::Link(Type *&head, Type &metric) noexcept
+{
+    metric._nextMetric = head;
+    head = &metric;
+}
+
+template<typename Type>
+void MetricsRegistry::Unlink(Type *&head, Type &metric) noexcept
+{
+    for (auto *link = &head; *link; link = &(*link)->_nextMetric) {
+        if (*link == &metric) {
+            *link = metric._nextMetric;
+            metric._nextMetric = nullptr;
+            return;
+        }
+    }
+}
+
+MetricsRegistry::MetricsRegistry(void) noexcept
+{
+    _containerAllocations._name = "core.containers.allocations";
+    _containerAllocatedBytes._name = "core.containers.allocated_bytes";
+    _containerGrowths._name = "core.containers.growths";
+    Link(_counters, _containerGrowths);
+    Link(_counters, _containerAllocatedBytes);
+    Link(_counters, _containerAllocations);
+}
+
+MetricsRegistry &MetricsRegistry::Get(void) noexcept
+{
+    static MetricsRegistry Registry;
+
+    return Registry;
+}
+
+void MetricsRegistry::add(ShardedCounter &counter) noexcept
+{
+    std::lock_guard lock(_mutex);
+
+    Link(_counters, counter);
+}
+
+void MetricsRegistry::remove(ShardedCounter &counter) noexcept
+{
+    std::lock_guard lock(_mutex);
+
+    Unlink(_counters, counter);
+}
+
+void MetricsRegistry::add(Histogram &histogram) noexcept
+{
+    std::lock_guard lock(_mutex);
+
+    Link(_histograms, histogram);
+}
+
+void MetricsRegistry::remove(Histogram &histogram) noexcept
+{
+    std::lock_guard lock(_mutex);
+
+    Unlink(_histograms, histogram);
+}
+
+MetricsRegistry::Snapshot MetricsRegistry::snapshot(void) const noexcept
+{
+    std::lock_guard lock(_mutex);
+    Snapshot snapshot;
+
+    for (const auto *counter = _counters; counter; counter = counter->_nextMetric)
+        snapshot.counters.push(CounterSample { counter->name(), counter->load() });
+    for (const auto *histogram = _histograms; histogram; histogram = histogram->_nextMetric)
+        snapshot.histograms.push(HistogramSample { histogram->name(), histogram->snapshot() });
+    return snapshot;
+}
+
+std::string MetricsRegistry::dumpText(void) const noexcept
+{
+    const auto metrics = snapshot();
+    std::string out;
+
+    for (const auto &counter : metrics.counters) {
+        out.append(counter.name);
+        out.push_back(' ');
+        AppendNumber(out, counter.value);
+        out.push_back('\n');
+    }
+    for (const auto &histogram : metrics.histograms) {
+        constexpr std::pair<std::string_view, double> Percentiles[] = {
+            { ".p50 ", 50.0 }, { ".p99 ", 99.0 }, { ".p999 ", 99.9 }
+        };
+        out.append(histogram.name);
+        out.append(".count ");
+        AppendNumber(out, histogram.snapshot.count);
+        out.push_back('\n');
+        for (const auto &[suffix, percent] : Percentiles) {
+            out.append(histogram.name);
+            out.append(suffix);
+            AppendNumber(out, histogram.snapshot.percentile(percent));
+            out.push_back('\n');
+        }
+        out.append(histogram.name);
+        out.append(".max ");
+        AppendNumber(out, histogram.snapshot.max);
+        out.push_back('\n');
+    }
+    return out;
+}
+
+Vector<MetricsRegistry::ContainerAccountSample> MetricsRegistry::containerAccounts(void) const noexcept
+{
+    Vector<ContainerAccountSample> accounts;
+
+    for (auto account = ContainerMetrics::FirstAccount(); account; account = account->next) {
+        accounts.push(ContainerAccountSample {
+            account->name,
+            account->buffers.load(std::memory_order_relaxed),
+            account->capacityBytes.load(std::memory_order_relaxed),
+            account->sizeBytes.load(std::memory_order_relaxed),
+            account->peakCapacityBytes.load(std::memory_order_relaxed)
+        });
+    }
+    std::sort(accounts.begin(), accounts.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.slackBytes() > rhs.slackBytes();
+    });
+    return accounts;
+}
+
+std::string MetricsRegistry::dumpContainerAccounts(void) const noexcept
+{
+    const auto accounts = containerAccounts();
+    std::string out;
+
+    for (const auto &account : accounts) {
+        out.append(account.name);
+        out.append(" buffers ");
+        AppendNumber(out, account.buffers);
+        out.append(" capacity ");
+        AppendNumber(out, account.capacityBytes);
+        out.append(" size ");
+        AppendNumber(out, account.sizeBytes);
+        out.append(" slack ");
+        AppendNumber(out, account.slackBytes());
+        out.append(" peak ");
+        AppendNumber(out, account.peakCapacityBytes);
+        out.push_back('\n');
+    }
+    return out;
+}
+
+std::string MetricsRegistry::dumpJson(void) const noexcept
+{
+    const auto metrics = snapshot();
+    std::string out;
+    bool first = true;
+
+    out.append("{\"counters\":{");
+    for (const auto &counter : metrics.counters) {
+        if (!std::exchange(first, false))
+            out.push_back(',');
+        out.push_back('"');
+        out.append(counter.name);
+        out.append("\":");
+        AppendNumber(out, counter.value);
+    }
+    out.append("},\"histograms\":{");
+    first = true;
+    for (const auto &histogram : metrics.histograms) {
+        const auto &data = histogram.snapshot;
+        if (!std::exchange(first, false))
+            out.push_back(',');
+        out.push_back('"');
+        out.append(histogram.name);
+        out.append("\":{\"count\":");
+        AppendNumber(out, data.count);
+        out.append(",\"sum\":");
+        AppendNumber(out, data.sum);
+        out.append(",\"max\":");
+        AppendNumber(out, data.max);
+        out.append(",\"p50\":");
+        AppendNumber(out, data.percentile(50.0));
+        out.append(",\"p99\":");
+        AppendNumber(out, data.percentile(99.0));
+        out.append(",\"p999\":");
+        AppendNumber(out, data.percentile(99.9));
+        out.append(",\"buckets\":[");
+        bool firstBucket = true;
+        for (auto i = 0ul; i < Histogram::BucketCount; ++i) {
+            if (!data.buckets[i])
+                continue;
+            if (!std::exchange(firstBucket, false))
+                out.push_back(',');
+            out.push_back('[');
+            AppendNumber(out, Histogram::BucketUpperBound(i));
+            out.push_back(',');
+            AppendNumber(out, data.buckets[i]);
+            out.push_back(']');
+        }
+        out.append("]}");
+    }
+    out.append("}}");
+    return out;
+}
+
+void ContainerMetrics::OnAllocation(const std::size_t bytes) noexcept
+{
+    auto &registry = MetricsRegistry::Get();
+
+    registry.containerAllocations().increment();
+    registry.containerAllocatedBytes().add(static_cast<std::int64_t>(bytes));
+}
+
+void ContainerMetrics::OnGrowth(void) noexcept
+{
+    MetricsRegistry::Get().containerGrowths().increment();
+}
+
+ContainerMetrics::Account::Account(const std::string_view accountName) noexcept
+    : name(accountName)
+{
+    next = AccountsHead.load(std::memory_order_relaxed);
+    while (!AccountsHead.compare_exchange_weak(next, this, std::memory_order_release, std::memory_order_relaxed));
+}
+
+const ContainerMetrics::Account *ContainerMetrics::FirstAccount(void) noexcept
+{
+    return AccountsHead.load(std::memory_order_acquire);
+}
@@ -0,0 +1,280 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Metrics
+ */
+
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <bit>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+#include "Vector.hpp"
+
+namespace Core
+{
+    class ShardedCounter;
+    class Histogram;
+    class MetricsRegistry;
+}
+
+/** @brief Counter split into cacheline-sized shards
+ *  Each thread always increments the same shard so concurrent writers never share a cacheline
+ *  Reading the counter sums every shard, so reads are slower than writes */
+class Core::ShardedCounter
+{
+public:
+    /** @brief Number of shards, threads are distributed over shards in a round-robin fashion */
+    static constexpr std::size_t ShardCount = 32;
+
+    /** @brief A single shard, fits exactly a cacheline */
+    struct alignas_cacheline Shard
+    {
+        std::atomic<std::int64_t> value { 0 };
+    };
+
+
+    /** @brief Default constructor, the counter is not registered */
+    ShardedCounter(void) noexcept = default;
+
+    /** @brief Construct and register the counter into the global registry
+     *  The name is not copied, it must outlive the counter (use string literals) */
+    explicit ShardedCounter(const std::string_view name) noexcept;
+
+    /** @brief A counter is not copyable nor movable since the registry references it */
+    ShardedCounter(const ShardedCounter &other) = delete;
+    ShardedCounter &operator=(const ShardedCounter &other) = delete;
+
+    /** @brief Unregister the counter if needed */
+    ~ShardedCounter(void) noexcept;
+
+
+    /** @brief Add a value to the calling thread's shard */
+    void add(const std::int64_t value) noexcept { _shards[ThreadShardIndex()].value.fetch_add(value, std::memory_order_relaxed); }
+
+    /** @brief Increment / decrement helpers */
+    void increment(void) noexcept { add(1); }
+    void decrement(void) noexcept { add(-1); }
+
+
+    /** @brief Sum all shards */
+    [[nodiscard]] std::int64_t load(void) const noexcept;
+
+    /** @brief Reset all shards to zero */
+    void reset(void) noexcept;
+
+
+    /** @brief Get the registered name of the counter (empty if not registered) */
+    [[nodiscard]] std::string_view name(void) const noexcept { return _name; }
+
+
+    /** @brief Get the shard index of the calling thread */
+    [[nodiscard]] static std::size_t ThreadShardIndex(void) noexcept
+    {
+        static std::atomic<std::size_t> NextIndex { 0 };
+        thread_local const std::size_t Index = NextIndex.fetch_add(1, std::memory_order_relaxed) % ShardCount;
+        return Index;
+    }
+
+private:
+    std::array<Shard, ShardCount> _shards {};
+    std::string_view _name {};
+    ShardedCounter *_nextMetric { nullptr };
+
+    friend MetricsRegistry;
+};
+
+static_assert_fit_cacheline(Core::ShardedCounter::Shard);
+
+/** @brief Lock-free histogram of unsigned values
+ *  Buckets are log2 scaled and linearly divided into SubBucketCount sub-buckets (relative error <= 1 / SubBucketCount) */
+class Core::Histogram
+{
+public:
+    /** @brief Bucket layout */
+    static constexpr std::size_t SubBucketBits = 3;
+    static constexpr std::size_t SubBucketCount = 1ul << SubBucketBits;
+    static constexpr std::size_t BucketCount = (64 - SubBucketBits + 1) * SubBucketCount;
+
+    /** @brief Copy of a histogram state at a given time */
+    struct Snapshot
+    {
+        std::array<std::uint64_t, BucketCount> buckets {};
+        std::uint64_t count {};
+        std::uint64_t sum {};
+        std::uint64_t max {};
+
+        /** @brief Get the mean of recorded values */
+        [[nodiscard]] double mean(void) const noexcept { return count ? static_cast<double>(sum) / static_cast<double>(count) : 0.0; }
+
+        /** @brief Get the upper bound of the bucket containing the given percentile ([0, 100]) */
+        [[nodiscard]] std::uint64_t percentile(const double percent) const noexcept;
+    };
+
+
+    /** @brief Default constructor, the histogram is not registered */
+    Histogram(void) noexcept = default;
+
+    /** @brief Construct and register the histogram into the global registry
+     *  The name is not copied, it must outlive the histogram (use string literals) */
+    explicit Histogram(const std::string_view name) noexcept;
+
+    /** @brief A histogram is not copyable nor movable since the registry references it */
+    Histogram(const Histogram &other) = delete;
+    Histogram &operator=(const Histogram &other) = delete;
+
+    /** @brief Unregister the histogram if needed */
+    ~Histogram(void) noexcept;
+
+
+    /** @brief Record a single value */
+    void record(const std::uint64_t value) noexcept;
+
+    /** @brief Take a snapshot of the histogram */
+    [[nodiscard]] Snapshot snapshot(void) const noexcept;
+
+    /** @brief Reset all buckets to zero */
+    void reset(void) noexcept;
+
+
+    /** @brief Get the registered name of the histogram (empty if not registered) */
+    [[nodiscard]] std::string_view name(void) const noexcept { return _name; }
+
+
+    /** @brief Get the bucket index of a value */
+    [[nodiscard]] static constexpr std::size_t BucketIndex(const std::uint64_t value) noexcept
+    {
+        if (value < SubBucketCount)
+            return value;
+        const std::size_t exponent = std::bit_width(value) - 1;
+        const std::size_t subBucket = (value >> (exponent - SubBucketBits)) & (SubBucketCount - 1);
+        return (exponent - SubBucketBits + 1) * SubBucketCount + subBucket;
+    }
+
+    /** @brief Get the lowest value stored in a bucket */
+    [[nodiscard]] static constexpr std::uint64_t BucketLowerBound(const std::size_t index) noexcept
+    {
+        if (index < SubBucketCount)
+            return index;
+        const std::size_t exponent = index / SubBucketCount + SubBucketBits - 1;
+        return (SubBucketCount + index % SubBucketCount) << (exponent - SubBucketBits);
+    }
+
+    /** @brief Get the highest value stored in a bucket */
+    [[nodiscard]] static constexpr std::uint64_t BucketUpperBound(const std::size_t index) noexcept
+    {
+        if (index < SubBucketCount)
+            return index;
+        const std::size_t exponent = index / SubBucketCount + SubBucketBits - 1;
+        return BucketLowerBound(index) + (1ul << (exponent - SubBucketBits)) - 1;
+    }
+
+private:
+    std::array<std::atomic<std::uint64_t>, BucketCount> _buckets {};
+    std::atomic<std::uint64_t> _sum { 0 };
+    std::atomic<std::uint64_t> _max { 0 };
+    std::string_view _name {};
+    Histogram *_nextMetric { nullptr };
+
+    friend MetricsRegistry;
+};
+
+static_assert(Core::Histogram::BucketIndex(~0ul) == Core::Histogram::BucketCount - 1, "Histogram bucket layout is invalid");
+static_assert(Core::Histogram::BucketUpperBound(Core::Histogram::BucketCount - 1) == ~0ul, "Histogram bucket layout is invalid");
+
+/** @brief Global registry referencing every named counter and histogram
+ *  Metrics are linked intrusively so registering never allocates */
+class Core::MetricsRegistry
+{
+public:
+    /** @brief Value of a counter at a given time */
+    struct CounterSample
+    {
+        std::string_view name {};
+        std::int64_t value {};
+    };
+
+    /** @brief Value of a histogram at a given time */
+    struct HistogramSample
+    {
+        std::string_view name {};
+        Histogram::Snapshot snapshot {};
+    };
+
+    /** @brief Memory held by the containers of a storage type at a given time (see CORE_CONTAINER_ACCOUNTING) */
+    struct ContainerAccountSample
+    {
+        std::string_view name {};
+        std::int64_t buffers {};
+        std::int64_t capacityBytes {};
+        std::int64_t sizeBytes {};
+        std::int64_t peakCapacityBytes {};
+
+        /** @brief Get the bytes allocated but not used by any element */
+        [[nodiscard]] std::int64_t slackBytes(void) const noexcept { return capacityBytes - sizeBytes; }
+    };
+
+    /** @brief Values of all registered metrics at a given time */
+    struct Snapshot
+    {
+        Vector<CounterSample> counters {};
+        Vector<HistogramSample> histograms {};
+    };
+
+
+    /** @brief Get the global registry instance */
+    [[nodiscard]] static MetricsRegistry &Get(void) noexcept;
+
+
+    /** @brief Register / unregister a counter */
+    void add(ShardedCounter &counter) noexcept;
+    void remove(ShardedCounter &counter) noexcept;
+
+    /** @brief Register / unregister a histogram */
+    void add(Histogram &histogram) noexcept;
+    void remove(Histogram &histogram) noexcept;
+
+
+    /** @brief Take a snapshot of every registered metric */
+    [[nodiscard]] Snapshot snapshot(void) const noexcept;
+
+    /** @brief Dump every registered metric as text lines ('name value') */
+    [[nodiscard]] std::string dumpText(void) const noexcept;
+
+    /** @brief Dump every registered metric as a JSON object */
+    [[nodiscard]] std::string dumpJson(void) const noexcept;
+
+
+    /** @brief Take a snapshot of every container account, sorted by decreasing slack
+     *  Accounts are only updated when CORE_CONTAINER_ACCOUNTING is defined */
+    [[nodiscard]] Vector<ContainerAccountSample> containerAccounts(void) const noexcept;
+
+    /** @brief Dump every container account as text lines ('name buffers capacity size slack peak') */
+    [[nodiscard]] std::string dumpContainerAccounts(void) const noexcept;
+
+
+    /** @brief Built-in counters incremented by containers when CORE_CONTAINER_METRICS is defined */
+    [[nodiscard]] ShardedCounter &containerAllocations(void) noexcept { return _containerAllocations; }
+    [[nodiscard]] ShardedCounter &containerAllocatedBytes(void) noexcept { return _containerAllocatedBytes; }
+    [[nodiscard]] ShardedCounter &containerGrowths(void) noexcept { return _containerGrowths; }
+
+private:
+    mutable std::mutex _mutex {};
+    ShardedCounter *_counters { nullptr };
+    Histogram *_histograms { nullptr };
+    ShardedCounter _containerAllocations {};
+    ShardedCounter _containerAllocatedBytes {};
+    ShardedCounter _containerGrowths {};
+
+    /** @brief Register the built-in counters */
+    MetricsRegistry(void) noexcept;
+
+    /** @brief Intrusive list helpers */
+    template<typename Type>
+    static void Link(Type *&head, Type &metric) noexcept;
+    template<typename Type>
+    static void Unlink(Type *&head, Type &metric) noexcept;
+};
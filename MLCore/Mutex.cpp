@@ -0,0 +1,95 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Low-latency mutexes and wake-up primitives
+ */
+
+#include <algorithm>
+#include <climits>
+
+#ifdef __linux__
+# include <linux/futex.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+#include "Mutex.hpp"
+
+using namespace Core;
+
+namespace
+{
+    /** @brief Spinning only pays off if the thread we wait on runs on another CPU */
+    [[nodiscard]] std::uint32_t SpinLimit(const std::uint32_t spinCount) noexcept
+    {
+        static const bool Multicore = std::thread::hardware_concurrency() > 1;
+        return Multicore ? spinCount : 0;
+    }
+}
+
+void Internal::FutexWait(std::atomic<std::uint32_t> &word, const std::uint32_t expected) noexcept
+{
+#ifdef __linux__
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+#else
+    word.wait(expected, std::memory_order_relaxed);
+#endif
+}
+
+void Internal::FutexWake(std::atomic<std::uint32_t> &word, const std::uint32_t count) noexcept
+{
+#ifdef __linux__
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAKE_PRIVATE, static_cast<int>(std::min<std::uint32_t>(count, INT_MAX)), nullptr, nullptr, 0);
+#else
+    if (count == 1)
+        word.notify_one();
+    else
+        word.notify_all();
+#endif
+}
+
+void Internal::FutexWakeAll(std::atomic<std::uint32_t> &word) noexcept
+{
+#ifdef __linux__
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&word), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+#else
+    word.notify_all();
+#endif
+}
+
+void AdaptiveMutex::lockSlow(void) noexcept
+{
+    // Spin while the owner is likely to release the lock soon, sleepers mean it will not
+    for (auto i = 0u, count = SpinLimit(SpinCount); i < count; ++i) {
+        auto state = _state.load(std::memory_order_relaxed);
+        if (state == Contended)
+            break;
+        if (state == Unlocked && _state.compare_exchange_weak(state, Locked, std::memory_order_acquire, std::memory_order_relaxed))
+            return;
+        Utils::CpuRelax();
+    }
+    // Mark the lock as contended, so its owner wakes us on unlock
+    while (_state.exchange(Contended, std::memory_order_acquire) != Unlocked)
+        Internal::FutexWait(_state, Contended);
+}
+
+void Event::wait(void) noexcept
+{
+    for (auto state = _state.load(std::memory_order_acquire); state != Set; state = _state.load(std::memory_order_acquire)) {
+        if (state == Unset && !_state.compare_exchange_weak(state, Waiting, std::memory_order_relaxed, std::memory_order_relaxed))
+            continue;
+        Internal::FutexWait(_state, Waiting);
+    }
+}
+
+void Semaphore::acquireSlow(void) noexcept
+{
+    for (auto i = 0u, count = SpinLimit(SpinCount); i < count; ++i) {
+        if (tryAcquire())
+            return;
+        Utils::CpuRelax();
+    }
+    _waiters.fetch_add(1, std::memory_order_seq_cst);
+    while (!tryAcquire())
+        Internal::FutexWait(_count, 0);
+    _waiters.fetch_sub(1, std::memory_order_relaxed);
+}
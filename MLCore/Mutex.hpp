@@ -0,0 +1,242 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Low-latency mutexes and wake-up primitives
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+# include <immintrin.h>
+#endif
+
+#include "Utils.hpp"
+
+namespace Core
+{
+    class SpinMutex;
+    class AdaptiveMutex;
+    class Event;
+    class Semaphore;
+
+    namespace Utils
+    {
+        /** @brief Hint the CPU that the calling thread is spin-waiting (pause / yield instruction) */
+        inline void CpuRelax(void) noexcept
+        {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            _mm_pause();
+#elif defined(__x86_64__) || defined(__i386__)
+            __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+            asm volatile("yield");
+#endif
+        }
+    }
+
+    namespace Internal
+    {
+        /** @brief Block the calling thread while 'word' equals 'expected' (Linux futex, std::atomic::wait elsewhere)
+         *  May return spuriously, callers must re-check their condition */
+        void FutexWait(std::atomic<std::uint32_t> &word, const std::uint32_t expected) noexcept;
+
+        /** @brief Wake at most 'count' threads blocked on 'word' */
+        void FutexWake(std::atomic<std::uint32_t> &word, const std::uint32_t count) noexcept;
+
+        /** @brief Wake every thread blocked on 'word' */
+        void FutexWakeAll(std::atomic<std::uint32_t> &word) noexcept;
+    }
+}
+
+/** @brief Test-and-test-and-set spin lock with exponential backoff
+ *  Waiters spin on a relaxed load so the cacheline stays shared until the owner releases it
+ *  Past MaxBackoff pauses the waiter yields its time slice, use it only for very short critical sections */
+class alignas_cacheline Core::SpinMutex
+{
+public:
+    /** @brief Maximum number of pause instructions between two lock attempts */
+    static constexpr std::uint32_t MaxBackoff = 1024;
+
+    /** @brief A mutex is neither copyable nor movable */
+    SpinMutex(void) noexcept = default;
+    SpinMutex(const SpinMutex &other) = delete;
+    SpinMutex &operator=(const SpinMutex &other) = delete;
+
+
+    /** @brief Lock the mutex, spinning until it is available */
+    void lock(void) noexcept
+    {
+        for (std::uint32_t backoff = 1; !try_lock();) {
+            while (_locked.load(std::memory_order_relaxed)) {
+                if (backoff <= MaxBackoff) {
+                    for (auto i = 0u; i < backoff; ++i)
+                        Utils::CpuRelax();
+                    backoff <<= 1;
+                } else
+                    std::this_thread::yield();
+            }
+        }
+    }
+
+    /** @brief Try to lock the mutex without waiting */
+    [[nodiscard]] bool try_lock(void) noexcept
+        { return !_locked.load(std::memory_order_relaxed) && !_locked.exchange(true, std::memory_order_acquire); }
+
+    /** @brief Unlock the mutex */
+    void unlock(void) noexcept { _locked.store(false, std::memory_order_release); }
+
+private:
+    std::atomic<bool> _locked { false };
+};
+
+static_assert_fit_cacheline(Core::SpinMutex);
+
+/** @brief Mutex that spins for a short while then parks on a futex
+ *  The futex word is 0 (unlocked), 1 (locked) or 2 (locked with potential sleepers) so an uncontended unlock never syscalls */
+class alignas_cacheline Core::AdaptiveMutex
+{
+public:
+    /** @brief Number of lock attempts before parking (no spinning on single-core machines) */
+    static constexpr std::uint32_t SpinCount = 128;
+
+    /** @brief A mutex is neither copyable nor movable */
+    AdaptiveMutex(void) noexcept = default;
+    AdaptiveMutex(const AdaptiveMutex &other) = delete;
+    AdaptiveMutex &operator=(const AdaptiveMutex &other) = delete;
+
+
+    /** @brief Lock the mutex, parking the thread if it stays locked */
+    void lock(void) noexcept
+    {
+        std::uint32_t expected = Unlocked;
+        if (!_state.compare_exchange_strong(expected, Locked, std::memory_order_acquire, std::memory_order_relaxed))
+            lockSlow();
+    }
+
+    /** @brief Try to lock the mutex without waiting */
+    [[nodiscard]] bool try_lock(void) noexcept
+    {
+        std::uint32_t expected = Unlocked;
+        return _state.compare_exchange_strong(expected, Locked, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    /** @brief Unlock the mutex, waking one sleeper if any */
+    void unlock(void) noexcept
+    {
+        if (_state.exchange(Unlocked, std::memory_order_release) == Contended)
+            Internal::FutexWake(_state, 1);
+    }
+
+private:
+    static constexpr std::uint32_t Unlocked = 0;
+    static constexpr std::uint32_t Locked = 1;
+    static constexpr std::uint32_t Contended = 2;
+
+    std::atomic<std::uint32_t> _state { Unlocked };
+
+    /** @brief Spin then park until the mutex is acquired */
+    void lockSlow(void) noexcept;
+};
+
+static_assert_fit_cacheline(Core::AdaptiveMutex);
+
+/** @brief Manual-reset event, 'wait' blocks until another thread calls 'set'
+ *  Setting an event nobody waits on never syscalls */
+class alignas_cacheline Core::Event
+{
+public:
+    /** @brief Construct the event in a given state */
+    explicit Event(const bool set = false) noexcept : _state(set ? Set : Unset) {}
+
+    /** @brief An event is neither copyable nor movable */
+    Event(const Event &other) = delete;
+    Event &operator=(const Event &other) = delete;
+
+
+    /** @brief Check if the event is set */
+    [[nodiscard]] bool isSet(void) const noexcept { return _state.load(std::memory_order_acquire) == Set; }
+
+    /** @brief Set the event and wake every waiter */
+    void set(void) noexcept
+    {
+        if (_state.exchange(Set, std::memory_order_release) == Waiting)
+            Internal::FutexWakeAll(_state);
+    }
+
+    /** @brief Reset the event, later calls to 'wait' block again */
+    void reset(void) noexcept
+    {
+        std::uint32_t expected = Set;
+        _state.compare_exchange_strong(expected, Unset, std::memory_order_relaxed);
+    }
+
+    /** @brief Block until the event is set */
+    void wait(void) noexcept;
+
+private:
+    static constexpr std::uint32_t Unset = 0;
+    static constexpr std::uint32_t Set = 1;
+    static constexpr std::uint32_t Waiting = 2;
+
+    std::atomic<std::uint32_t> _state;
+};
+
+static_assert_fit_cacheline(Core::Event);
+
+/** @brief Counting semaphore, 'acquire' spins briefly then parks on a futex until a token is available
+ *  Releasing when nobody waits never syscalls */
+class alignas_cacheline Core::Semaphore
+{
+public:
+    /** @brief Number of acquire attempts before parking (no spinning on single-core machines) */
+    static constexpr std::uint32_t SpinCount = 128;
+
+    /** @brief Construct the semaphore with an initial token count */
+    explicit Semaphore(const std::uint32_t count = 0) noexcept : _count(count) {}
+
+    /** @brief A semaphore is neither copyable nor movable */
+    Semaphore(const Semaphore &other) = delete;
+    Semaphore &operator=(const Semaphore &other) = delete;
+
+
+    /** @brief Get the approximative number of available tokens */
+    [[nodiscard]] std::uint32_t count(void) const noexcept { return _count.load(std::memory_order_relaxed); }
+
+    /** @brief Take a token if one is available */
+    [[nodiscard]] bool tryAcquire(void) noexcept
+    {
+        auto count = _count.load(std::memory_order_relaxed);
+        while (count) {
+            if (_count.compare_exchange_weak(count, count - 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+
+    /** @brief Take a token, blocking until one is available */
+    void acquire(void) noexcept
+    {
+        if (!tryAcquire())
+            acquireSlow();
+    }
+
+    /** @brief Add 'count' tokens and wake as many waiters */
+    void release(const std::uint32_t count = 1) noexcept
+    {
+        _count.fetch_add(count, std::memory_order_seq_cst);
+        if (_waiters.load(std::memory_order_seq_cst))
+            Internal::FutexWake(_count, count);
+    }
+
+private:
+    std::atomic<std::uint32_t> _count;
+    std::atomic<std::uint32_t> _waiters { 0 };
+
+    /** @brief Spin then park until a token is acquired */
+    void acquireSlow(void) noexcept;
+};
+
+static_assert_fit_cacheline(Core::Semaphore);
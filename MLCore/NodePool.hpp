@@ -0,0 +1,66 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: NodePool
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include "Vector.hpp"
+
+namespace Core
+{
+    template<typename Type>
+    class NodePool;
+}
+
+/** @brief Fixed-capacity pool of pre-constructed nodes with a lock-free free list
+ *  Nodes are allocated once at construction (they don't need to be movable) and recycled through acquire / release from any thread, without the allocator
+ *  The free list head packs a node index with a tag incremented on each pop, which prevents the ABA problem
+ *  Released nodes are not destroyed, acquire returns them in the state they were released */
+template<typename Type>
+class Core::NodePool
+{
+public:
+    /** @brief Construct 'capacity' nodes, all of them free */
+    explicit NodePool(const std::size_t capacity) noexcept;
+
+    /** @brief A pool is neither copyable nor movable since nodes are referenced */
+    NodePool(const NodePool &other) = delete;
+    NodePool &operator=(const NodePool &other) = delete;
+
+
+    /** @brief Get the number of nodes */
+    [[nodiscard]] std::size_t capacity(void) const noexcept { return _capacity; }
+
+    /** @brief Check if a node belongs to the pool */
+    [[nodiscard]] bool owns(const Type * const node) const noexcept
+        { return node >= _nodes.get() && node < _nodes.get() + _capacity; }
+
+
+    /** @brief Take a free node, returns nullptr if the pool is exhausted */
+    [[nodiscard]] Type *acquire(void) noexcept;
+
+    /** @brief Give a node back to the pool */
+    void release(Type * const node) noexcept_ndebug;
+
+private:
+    /** @brief End of the free list */
+    static constexpr std::uint32_t NullIndex = ~static_cast<std::uint32_t>(0);
+
+    std::unique_ptr<Type[]> _nodes {};
+    std::size_t _capacity {};
+    Vector<std::uint32_t> _nextFree {};
+    alignas_cacheline std::atomic<std::uint64_t> _head { NullIndex };
+
+    /** @brief Pack / unpack the free list head */
+    [[nodiscard]] static constexpr std::uint64_t Pack(const std::uint32_t index, const std::uint32_t tag) noexcept
+        { return (static_cast<std::uint64_t>(tag) << 32) | index; }
+    [[nodiscard]] static constexpr std::uint32_t IndexOf(const std::uint64_t head) noexcept { return static_cast<std::uint32_t>(head); }
+    [[nodiscard]] static constexpr std::uint32_t TagOf(const std::uint64_t head) noexcept { return static_cast<std::uint32_t>(head >> 32); }
+};
+
+#include "NodePool.ipp"
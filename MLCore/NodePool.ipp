@@ -0,0 +1,41 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: NodePool
+ */
+
+template<typename Type>
+inline Core::NodePool<Type>::NodePool(const std::size_t capacity) noexcept
+    : _nodes(std::make_unique<Type[]>(capacity)), _capacity(capacity)
+{
+    _nextFree.resizeUninitialized(capacity);
+    for (auto i = 0ul; i < capacity; ++i)
+        _nextFree[i] = i + 1 < capacity ? static_cast<std::uint32_t>(i + 1) : NullIndex;
+    _head.store(Pack(capacity ? 0 : NullIndex, 0), std::memory_order_release);
+}
+
+template<typename Type>
+inline Type *Core::NodePool<Type>::acquire(void) noexcept
+{
+    auto head = _head.load(std::memory_order_acquire);
+
+    while (IndexOf(head) != NullIndex) {
+        // The node stays owned by the pool, reading its link is safe even if another thread popped it meanwhile
+        const auto next = std::atomic_ref<std::uint32_t>(_nextFree[IndexOf(head)]).load(std::memory_order_relaxed);
+        if (_head.compare_exchange_weak(head, Pack(next, TagOf(head) + 1), std::memory_order_acq_rel, std::memory_order_acquire))
+            return _nodes.get() + IndexOf(head);
+    }
+    return nullptr;
+}
+
+template<typename Type>
+inline void Core::NodePool<Type>::release(Type * const node) noexcept_ndebug
+{
+    coreAssert(owns(node),
+        coreDebugThrow(std::logic_error("Core::NodePool::release: Node does not belong to the pool")));
+    const auto index = static_cast<std::uint32_t>(node - _nodes.get());
+    auto head = _head.load(std::memory_order_relaxed);
+
+    do
+        std::atomic_ref<std::uint32_t>(_nextFree[index]).store(IndexOf(head), std::memory_order_relaxed);
+    while (!_head.compare_exchange_weak(head, Pack(index, TagOf(head)), std::memory_order_release, std::memory_order_relaxed));
+}
@@ -0,0 +1,89 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Parallel algorithms
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+
+#include "ThreadPool.hpp"
+
+/** @brief Parallel algorithms over random access ranges (Vector, FlatVector, ...)
+ *  Ranges are split in one chunk per thread, chunk boundaries are aligned to cachelines for contiguous ranges
+ *  so that two threads never write to the same cacheline
+ *  Ranges smaller than 'Threshold' elements (or pools of a single thread) run sequentially */
+namespace Core::Parallel
+{
+    /** @brief Default number of elements under which an algorithm runs sequentially */
+    constexpr std::size_t DefaultThreshold = 16384;
+
+    /** @brief A contiguous sub range [begin, end) of indexes */
+    struct Chunk
+    {
+        std::size_t begin {};
+        std::size_t end {};
+    };
+
+    /** @brief Split a range into chunks whose boundaries are aligned to cachelines */
+    template<typename Iterator>
+    class Partition
+    {
+    public:
+        /** @brief Split [first, last) in at most 'chunkCount' chunks */
+        Partition(const Iterator first, const Iterator last, const std::size_t chunkCount) noexcept;
+
+        /** @brief Get the number of chunks */
+        [[nodiscard]] std::size_t count(void) const noexcept { return _count; }
+
+        /** @brief Get a chunk */
+        [[nodiscard]] Chunk operator[](const std::size_t index) const noexcept
+            { return Chunk { boundary(index), boundary(index + 1) }; }
+
+    private:
+        std::size_t _size {};
+        std::size_t _chunkSize {};
+        std::size_t _head {};
+        std::size_t _count {};
+
+        /** @brief Get the first index of a chunk */
+        [[nodiscard]] std::size_t boundary(const std::size_t index) const noexcept
+            { return index ? std::min(_size, _head + _chunkSize * index) : 0; }
+    };
+
+
+    /** @brief Call 'function(chunkFirst, chunkLast)' over sub ranges of [first, last) */
+    template<typename Iterator, typename Function>
+    void For(const Iterator first, const Iterator last, Function &&function,
+            ThreadPool &pool = ThreadPool::Default(), const std::size_t threshold = DefaultThreshold);
+
+    /** @brief Call 'function(index)' for each index in [0, count) */
+    template<typename Function>
+    void ForIndex(const std::size_t count, Function &&function,
+            ThreadPool &pool = ThreadPool::Default(), const std::size_t threshold = DefaultThreshold);
+
+    /** @brief Store 'function(*it)' for each element of [first, last) into output */
+    template<typename Iterator, typename OutputIterator, typename Function>
+    OutputIterator Transform(const Iterator first, const Iterator last, const OutputIterator output, Function &&function,
+            ThreadPool &pool = ThreadPool::Default(), const std::size_t threshold = DefaultThreshold);
+
+    /** @brief Reduce [first, last) with an associative and commutative operation */
+    template<typename Iterator, typename Type, typename Operation = std::plus<>>
+    [[nodiscard]] Type Reduce(const Iterator first, const Iterator last, Type init, Operation &&operation = Operation(),
+            ThreadPool &pool = ThreadPool::Default(), const std::size_t threshold = DefaultThreshold);
+
+    /** @brief Inclusive prefix scan of [first, last) into output with an associative operation, output may alias first */
+    template<typename Iterator, typename OutputIterator, typename Operation = std::plus<>>
+    OutputIterator InclusiveScan(const Iterator first, const Iterator last, const OutputIterator output, Operation &&operation = Operation(),
+            ThreadPool &pool = ThreadPool::Default(), const std::size_t threshold = DefaultThreshold);
+
+    /** @brief Sort [first, last), not stable */
+    template<typename Iterator, typename Compare = std::less<>>
+    void Sort(const Iterator first, const Iterator last, Compare &&compare = Compare(),
+            ThreadPool &pool = ThreadPool::Default(), const std::size_t threshold = DefaultThreshold);
+}
+
+#include "Parallel.ipp"
@@ -0,0 +1,165 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Parallel algorithms
+ */
+
+template<typename Iterator>
+inline Core::Parallel::Partition<Iterator>::Partition(const Iterator first, const Iterator last, const std::size_t chunkCount) noexcept
+    : _size(static_cast<std::size_t>(std::distance(first, last)))
+{
+    using ValueType = std::iter_value_t<Iterator>;
+
+    if (!_size)
+        return;
+    std::size_t elementsPerLine = 1;
+    if constexpr (std::contiguous_iterator<Iterator>) {
+        // Boundaries can only be aligned when an element never straddles two cachelines
+        if constexpr (CacheLineSize % sizeof(ValueType) == 0) {
+            const auto misalignment = reinterpret_cast<std::uintptr_t>(std::to_address(first)) % CacheLineSize;
+            if (misalignment % sizeof(ValueType) == 0) {
+                elementsPerLine = CacheLineSize / sizeof(ValueType);
+                _head = (CacheLineSize - misalignment) % CacheLineSize / sizeof(ValueType);
+            }
+        }
+    }
+    const auto perChunk = (_size + std::max<std::size_t>(chunkCount, 1) - 1) / std::max<std::size_t>(chunkCount, 1);
+    _chunkSize = (perChunk + elementsPerLine - 1) / elementsPerLine * elementsPerLine;
+    if (_size <= _head + _chunkSize)
+        _count = 1;
+    else
+        _count = (_size - _head + _chunkSize - 1) / _chunkSize;
+}
+
+template<typename Iterator, typename Function>
+inline void Core::Parallel::For(const Iterator first, const Iterator last, Function &&function,
+        ThreadPool &pool, const std::size_t threshold)
+{
+    const auto count = static_cast<std::size_t>(std::distance(first, last));
+
+    if (count < threshold || pool.threadCount() == 1) {
+        if (count)
+            function(first, last);
+        return;
+    }
+    const Partition<Iterator> partition(first, last, pool.threadCount());
+    pool.dispatch(partition.count(), [first, &partition, &function](const std::size_t index) {
+        const auto chunk = partition[index];
+        function(first + chunk.begin, first + chunk.end);
+    });
+}
+
+template<typename Function>
+inline void Core::Parallel::ForIndex(const std::size_t count, Function &&function,
+        ThreadPool &pool, const std::size_t threshold)
+{
+    if (count < threshold || pool.threadCount() == 1) {
+        for (auto i = 0ul; i < count; ++i)
+            function(i);
+        return;
+    }
+    const auto chunkCount = std::min(count, pool.threadCount());
+    pool.dispatch(chunkCount, [count, chunkCount, &function](const std::size_t index) {
+        const auto end = count * (index + 1) / chunkCount;
+        for (auto i = count * index / chunkCount; i < end; ++i)
+            function(i);
+    });
+}
+
+template<typename Iterator, typename OutputIterator, typename Function>
+inline OutputIterator Core::Parallel::Transform(const Iterator first, const Iterator last, const OutputIterator output, Function &&function,
+        ThreadPool &pool, const std::size_t threshold)
+{
+    const auto count = static_cast<std::size_t>(std::distance(first, last));
+
+    if (count < threshold || pool.threadCount() == 1)
+        return std::transform(first, last, output, function);
+    // Partition over the output so that writes never share a cacheline
+    const Partition<OutputIterator> partition(output, output + count, pool.threadCount());
+    pool.dispatch(partition.count(), [first, output, &partition, &function](const std::size_t index) {
+        const auto chunk = partition[index];
+        std::transform(first + chunk.begin, first + chunk.end, output + chunk.begin, function);
+    });
+    return output + count;
+}
+
+template<typename Iterator, typename Type, typename Operation>
+inline Type Core::Parallel::Reduce(const Iterator first, const Iterator last, Type init, Operation &&operation,
+        ThreadPool &pool, const std::size_t threshold)
+{
+    const auto count = static_cast<std::size_t>(std::distance(first, last));
+
+    if (count < threshold || pool.threadCount() == 1)
+        return std::reduce(first, last, std::move(init), operation);
+    const Partition<Iterator> partition(first, last, pool.threadCount());
+    Vector<Type> partials;
+    partials.reserve(partition.count());
+    for (auto i = 0ul; i < partition.count(); ++i)
+        partials.push(init);
+    pool.dispatch(partition.count(), [first, &partition, &partials, &operation](const std::size_t index) {
+        const auto chunk = partition[index];
+        partials[index] = std::reduce(first + chunk.begin + 1, first + chunk.end, Type(first[chunk.begin]), operation);
+    });
+    for (const auto &partial : partials)
+        init = operation(std::move(init), partial);
+    return init;
+}
+
+template<typename Iterator, typename OutputIterator, typename Operation>
+inline OutputIterator Core::Parallel::InclusiveScan(const Iterator first, const Iterator last, const OutputIterator output, Operation &&operation,
+        ThreadPool &pool, const std::size_t threshold)
+{
+    using ValueType = std::iter_value_t<Iterator>;
+
+    const auto count = static_cast<std::size_t>(std::distance(first, last));
+
+    if (count < threshold || pool.threadCount() == 1)
+        return std::inclusive_scan(first, last, output, operation);
+    // Reduce each chunk, scan the chunk totals, then scan each chunk again starting from its offset
+    const Partition<OutputIterator> partition(output, output + count, pool.threadCount());
+    Vector<ValueType> offsets;
+    offsets.reserve(partition.count());
+    for (auto i = 0ul; i < partition.count(); ++i)
+        offsets.push(first[0]);
+    pool.dispatch(partition.count(), [first, &partition, &offsets, &operation](const std::size_t index) {
+        const auto chunk = partition[index];
+        offsets[index] = std::reduce(first + chunk.begin + 1, first + chunk.end, ValueType(first[chunk.begin]), operation);
+    });
+    for (auto i = 1ul; i < offsets.size(); ++i)
+        offsets[i] = operation(offsets[i - 1], offsets[i]);
+    pool.dispatch(partition.count(), [first, output, &partition, &offsets, &operation](const std::size_t index) {
+        const auto chunk = partition[index];
+        if (!index)
+            std::inclusive_scan(first + chunk.begin, first + chunk.end, output + chunk.begin, operation);
+        else
+            std::inclusive_scan(first + chunk.begin, first + chunk.end, output + chunk.begin, operation, offsets[index - 1]);
+    });
+    return output + count;
+}
+
+template<typename Iterator, typename Compare>
+inline void Core::Parallel::Sort(const Iterator first, const Iterator last, Compare &&compare,
+        ThreadPool &pool, const std::size_t threshold)
+{
+    const auto count = static_cast<std::size_t>(std::distance(first, last));
+
+    if (count < threshold || pool.threadCount() == 1)
+        return std::sort(first, last, compare);
+    // Sort each chunk, then merge pairs of sorted runs until a single one is left
+    const Partition<Iterator> partition(first, last, pool.threadCount());
+    const auto chunkCount = partition.count();
+    pool.dispatch(chunkCount, [first, &partition, &compare](const std::size_t index) {
+        const auto chunk = partition[index];
+        std::sort(first + chunk.begin, first + chunk.end, compare);
+    });
+    for (std::size_t width = 1; width < chunkCount; width *= 2) {
+        const auto mergeCount = (chunkCount + width * 2 - 1) / (width * 2);
+        pool.dispatch(mergeCount, [first, width, chunkCount, &partition, &compare](const std::size_t index) {
+            const auto left = index * width * 2;
+            const auto middle = left + width;
+            if (middle >= chunkCount)
+                return;
+            const auto right = std::min(middle + width, chunkCount) - 1;
+            std::inplace_merge(first + partition[left].begin, first + partition[middle].begin, first + partition[right].end, compare);
+        });
+    }
+}
@@ -0,0 +1,354 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: PoolAllocator
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+
+#include "PoolAllocator.hpp"
+
+using namespace Core;
+
+namespace
+{
+    struct Heap;
+
+    /** @brief A freed block, the link is stored in the block itself */
+    struct FreeBlock
+    {
+        FreeBlock *next;
+    };
+
+    /** @brief Header stored at the beginning of every span, followed by its blocks
+     *  Every field but 'owner' and 'nextFree' is only accessed by the owning heap */
+    struct alignas_cacheline Span
+    {
+        std::atomic<Heap *> owner { nullptr };
+        std::atomic<Span *> nextFree { nullptr };
+        Span *previous { nullptr };
+        Span *next { nullptr };
+        FreeBlock *freeList { nullptr };
+        std::uint32_t carved { 0 };
+        std::uint32_t blockCount { 0 };
+        std::uint32_t blockSize { 0 };
+        std::uint32_t used { 0 };
+        std::uint32_t classIndex { 0 };
+        bool linked { false };
+
+        /** @brief Get the address of a block */
+        [[nodiscard]] std::uint8_t *blocks(void) noexcept { return reinterpret_cast<std::uint8_t *>(this) + HeaderSize; }
+
+        /** @brief Check if the span has a block left */
+        [[nodiscard]] bool available(void) const noexcept { return freeList || carved < blockCount; }
+
+        /** @brief Take a block, the span must be available */
+        [[nodiscard]] void *take(void) noexcept
+        {
+            ++used;
+            if (const auto block = freeList; block) {
+                freeList = block->next;
+                return block;
+            }
+            return blocks() + blockSize * carved++;
+        }
+
+        /** @brief Size reserved for the header at the beginning of the span */
+        static constexpr std::size_t HeaderSize = 128;
+    };
+
+    static_assert(sizeof(Span) <= Span::HeaderSize, "PoolAllocator span header is too large");
+
+    /** @brief Get the span of a pooled block */
+    [[nodiscard]] Span *SpanOf(void * const data) noexcept
+        { return reinterpret_cast<Span *>(reinterpret_cast<std::uintptr_t>(data) & ~(PoolAllocator::SpanSize - 1)); }
+
+
+    /** @brief Central lock-free pool of empty spans
+     *  Spans are aligned to SpanSize so the low bits of the head pointer hold a tag preventing the ABA problem */
+    class SpanPool
+    {
+    public:
+        /** @brief Take an empty span, returns nullptr if the pool is empty */
+        [[nodiscard]] Span *pop(void) noexcept
+        {
+            auto head = _head.load(std::memory_order_acquire);
+
+            while (const auto span = SpanFrom(head)) {
+                // Span headers are never handed to users, reading a span popped meanwhile is safe
+                const auto next = span->nextFree.load(std::memory_order_relaxed);
+                if (_head.compare_exchange_weak(head, Pack(next, TagFrom(head) + 1), std::memory_order_acq_rel, std::memory_order_acquire))
+                    return span;
+            }
+            return nullptr;
+        }
+
+        /** @brief Give back an empty span */
+        void push(Span * const span) noexcept
+        {
+            auto head = _head.load(std::memory_order_relaxed);
+
+            do
+                span->nextFree.store(SpanFrom(head), std::memory_order_relaxed);
+            while (!_head.compare_exchange_weak(head, Pack(span, TagFrom(head)), std::memory_order_release, std::memory_order_relaxed));
+        }
+
+    private:
+        static constexpr std::uintptr_t TagMask = PoolAllocator::SpanSize - 1;
+
+        alignas_cacheline std::atomic<std::uintptr_t> _head { 0 };
+
+        [[nodiscard]] static Span *SpanFrom(const std::uintptr_t head) noexcept { return reinterpret_cast<Span *>(head & ~TagMask); }
+        [[nodiscard]] static std::uintptr_t TagFrom(const std::uintptr_t head) noexcept { return head & TagMask; }
+        [[nodiscard]] static std::uintptr_t Pack(Span * const span, const std::uintptr_t tag) noexcept
+            { return reinterpret_cast<std::uintptr_t>(span) | (tag & TagMask); }
+    };
+
+    [[nodiscard]] SpanPool &CentralPool(void) noexcept
+    {
+        static SpanPool Pool;
+
+        return Pool;
+    }
+
+
+    /** @brief Per-thread set of spans, one list of available spans per size class */
+    struct Heap
+    {
+        /** @brief Spans of a size class */
+        struct Bin
+        {
+            Span *available { nullptr };
+            std::size_t availableCount { 0 };
+        };
+
+        alignas_cacheline std::atomic<FreeBlock *> remoteFrees { nullptr };
+        alignas_cacheline Bin bins[PoolAllocator::ClassCount] {};
+        Heap *nextAbandoned { nullptr };
+
+        /** @brief Allocate a block of a size class */
+        [[nodiscard]] void *allocate(const std::size_t index) noexcept
+        {
+            auto &bin = bins[index];
+
+            while (!bin.available) {
+                if (drainRemoteFrees())
+                    continue;
+                const auto span = acquireSpan(index);
+                if (!span)
+                    return nullptr;
+                link(bin, *span);
+            }
+            const auto span = bin.available;
+            const auto block = span->take();
+            if (!span->available())
+                unlink(bin, *span);
+            return block;
+        }
+
+        /** @brief Free a block of a span owned by this heap */
+        void deallocate(Span &span, void * const data) noexcept
+        {
+            auto &bin = bins[span.classIndex];
+            const auto block = reinterpret_cast<FreeBlock *>(data);
+
+            block->next = span.freeList;
+            span.freeList = block;
+            if (!--span.used && bin.availableCount > 1) {
+                // Keep a single empty span per class, the others go back to the central pool
+                if (span.linked)
+                    unlink(bin, span);
+                span.owner.store(nullptr, std::memory_order_relaxed);
+                CentralPool().push(&span);
+            } else if (!span.linked)
+                link(bin, span);
+        }
+
+        /** @brief Push a block freed by another thread */
+        void deallocateRemote(void * const data) noexcept
+        {
+            const auto block = reinterpret_cast<FreeBlock *>(data);
+            auto head = remoteFrees.load(std::memory_order_relaxed);
+
+            do
+                block->next = head;
+            while (!remoteFrees.compare_exchange_weak(head, block, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        /** @brief Free every block pushed by other threads, returns false if there was none */
+        bool drainRemoteFrees(void) noexcept
+        {
+            auto block = remoteFrees.exchange(nullptr, std::memory_order_acquire);
+
+            if (!block)
+                return false;
+            while (block) {
+                const auto next = block->next;
+                deallocate(*SpanOf(block), block);
+                block = next;
+            }
+            return true;
+        }
+
+    private:
+        /** @brief Get an empty span from the central pool or the system */
+        [[nodiscard]] Span *acquireSpan(const std::size_t index) noexcept
+        {
+            auto span = CentralPool().pop();
+
+            if (!span) {
+#if defined(_WIN32)
+                const auto data = ::_aligned_malloc(PoolAllocator::SpanSize, PoolAllocator::SpanSize);
+#else
+                const auto data = std::aligned_alloc(PoolAllocator::SpanSize, PoolAllocator::SpanSize);
+#endif
+                if (!data)
+                    return nullptr;
+                span = new (data) Span;
+            }
+            const auto blockSize = PoolAllocator::ClassSize(index);
+            span->previous = nullptr;
+            span->next = nullptr;
+            span->freeList = nullptr;
+            span->carved = 0;
+            span->blockCount = static_cast<std::uint32_t>((PoolAllocator::SpanSize - Span::HeaderSize) / blockSize);
+            span->blockSize = static_cast<std::uint32_t>(blockSize);
+            span->used = 0;
+            span->classIndex = static_cast<std::uint32_t>(index);
+            span->linked = false;
+            span->owner.store(this, std::memory_order_relaxed);
+            return span;
+        }
+
+        /** @brief Bin list helpers */
+        static void link(Bin &bin, Span &span) noexcept
+        {
+            span.previous = nullptr;
+            span.next = bin.available;
+            if (bin.available)
+                bin.available->previous = &span;
+            bin.available = &span;
+            span.linked = true;
+            ++bin.availableCount;
+        }
+
+        static void unlink(Bin &bin, Span &span) noexcept
+        {
+            if (span.previous)
+                span.previous->next = span.next;
+            else
+                bin.available = span.next;
+            if (span.next)
+                span.next->previous = span.previous;
+            span.linked = false;
+            --bin.availableCount;
+        }
+    };
+
+
+    /** @brief Heaps of exited threads, waiting for a new thread (heaps are never destroyed) */
+    std::mutex HeapsMutex;
+    Heap *AbandonedHeaps = nullptr;
+
+    /** @brief Heap used by threads allocating after their own heap has been abandoned (thread_local destructors) */
+    std::mutex OrphanMutex;
+
+    [[nodiscard]] Heap &OrphanHeap(void) noexcept
+    {
+        static Heap &Orphan = *new Heap;
+
+        return Orphan;
+    }
+
+    /** @brief Heap of the calling thread */
+    thread_local Heap *LocalHeap = nullptr;
+
+    /** @brief Set once the calling thread abandoned its heap */
+    thread_local bool LocalHeapAbandoned = false;
+
+    /** @brief Abandon the heap of a thread when it exits */
+    struct HeapOwner
+    {
+        ~HeapOwner(void) noexcept
+        {
+            LocalHeapAbandoned = true;
+            if (!LocalHeap)
+                return;
+            std::lock_guard lock(HeapsMutex);
+            LocalHeap->nextAbandoned = AbandonedHeaps;
+            AbandonedHeaps = std::exchange(LocalHeap, nullptr);
+        }
+    };
+
+    thread_local HeapOwner LocalHeapOwner;
+
+    /** @brief Adopt an abandoned heap or create a new one for the calling thread */
+    [[nodiscard]] Heap *AdoptHeap(void) noexcept
+    {
+        if (LocalHeapAbandoned)
+            return nullptr;
+        // Touch the owner so that it gets destroyed when the thread exits
+        static_cast<void>(&LocalHeapOwner);
+        {
+            std::lock_guard lock(HeapsMutex);
+            if (AbandonedHeaps) {
+                LocalHeap = AbandonedHeaps;
+                AbandonedHeaps = LocalHeap->nextAbandoned;
+            }
+        }
+        if (!LocalHeap)
+            LocalHeap = new (std::nothrow) Heap;
+        return LocalHeap;
+    }
+}
+
+void *PoolAllocator::AllocatePooled(const std::size_t index) noexcept
+{
+    auto heap = LocalHeap;
+
+    if (!heap && !(heap = AdoptHeap())) [[unlikely]] {
+        std::lock_guard lock(OrphanMutex);
+        return OrphanHeap().allocate(index);
+    }
+    return heap->allocate(index);
+}
+
+void PoolAllocator::DeallocatePooled(void * const data) noexcept
+{
+    const auto span = SpanOf(data);
+    const auto owner = span->owner.load(std::memory_order_relaxed);
+
+    if (owner == LocalHeap)
+        owner->deallocate(*span, data);
+    else
+        owner->deallocateRemote(data);
+}
+
+PoolResource &PoolResource::Default(void) noexcept
+{
+    static PoolResource Resource;
+
+    return Resource;
+}
+
+void *PoolResource::do_allocate(const std::size_t bytes, const std::size_t alignment)
+{
+    void *data;
+
+    if (alignment > alignof(std::max_align_t))
+        return ::operator new(bytes, std::align_val_t(alignment));
+    if (!(data = PoolAllocator::Allocate(bytes)))
+        throw std::bad_alloc();
+    return data;
+}
+
+void PoolResource::do_deallocate(void * const data, const std::size_t bytes, const std::size_t alignment)
+{
+    if (alignment > alignof(std::max_align_t))
+        ::operator delete(data, bytes, std::align_val_t(alignment));
+    else
+        PoolAllocator::Deallocate(data, bytes);
+}
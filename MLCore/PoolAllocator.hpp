@@ -0,0 +1,96 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: PoolAllocator
+ */
+
+#pragma once
+
+#include <bit>
+#include <memory_resource>
+
+#include "Allocator.hpp"
+
+namespace Core
+{
+    struct PoolAllocator;
+
+    class PoolResource;
+}
+
+/** @brief Thread-caching size-class allocator, usable by every container (Vector<Type, Range, Growth, PoolAllocator>, ...)
+ *  Each thread owns a heap of 64KiB spans, a span holds blocks of a single size class and is carved lazily
+ *  Allocating and freeing blocks of the calling thread's heap never synchronizes
+ *  Blocks freed by another thread are pushed on a lock-free remote list of the owning heap, drained when the owner runs out of blocks
+ *  Empty spans go back to a central lock-free pool shared by every thread, the heap of an exiting thread is adopted by the next new thread
+ *  Requests larger than MaxPooledSize directly use std::malloc, every block is aligned like std::malloc */
+struct Core::PoolAllocator
+{
+    /** @brief Size of a span, spans are aligned to their size */
+    static constexpr std::size_t SpanSize = 64ul * 1024ul;
+
+    /** @brief Number of size classes: 16 bytes steps up to 128, then 4 classes per power of 2 */
+    static constexpr std::size_t ClassCount = 32;
+
+    /** @brief Largest pooled size */
+    static constexpr std::size_t MaxPooledSize = 8192;
+
+
+    /** @brief Get the size class of a pooled size */
+    [[nodiscard]] static constexpr std::size_t ClassIndex(const std::size_t bytes) noexcept
+    {
+        if (bytes <= 128)
+            return (std::max<std::size_t>(bytes, 1) + 15) / 16 - 1;
+        const std::size_t exponent = std::bit_width(bytes - 1) - 1;
+        return 8 + (exponent - 7) * 4 + ((bytes - 1 - (1ul << exponent)) >> (exponent - 2));
+    }
+
+    /** @brief Get the block size of a size class */
+    [[nodiscard]] static constexpr std::size_t ClassSize(const std::size_t index) noexcept
+    {
+        if (index < 8)
+            return (index + 1) * 16;
+        const std::size_t exponent = 7 + (index - 8) / 4;
+        return (1ul << exponent) + ((index - 8) % 4 + 1) * (1ul << (exponent - 2));
+    }
+
+
+    /** @brief Allocates a block of memory */
+    [[nodiscard]] static void *Allocate(const std::size_t bytes) noexcept
+        { return bytes <= MaxPooledSize ? AllocatePooled(ClassIndex(bytes)) : std::malloc(bytes); }
+
+    /** @brief Deallocates a block of memory, 'bytes' must be the size given to Allocate */
+    static void Deallocate(void * const data, const std::size_t bytes) noexcept
+    {
+        if (bytes <= MaxPooledSize)
+            DeallocatePooled(data);
+        else
+            std::free(data);
+    }
+
+    /** @brief Get the real size of a block */
+    [[nodiscard]] static std::size_t UsableSize(void * const data, const std::size_t bytes) noexcept
+        { return bytes <= MaxPooledSize ? ClassSize(ClassIndex(bytes)) : Utils::MallocUsableSize(data, bytes); }
+
+private:
+    /** @brief Pooled paths */
+    [[nodiscard]] static void *AllocatePooled(const std::size_t index) noexcept;
+    static void DeallocatePooled(void * const data) noexcept;
+};
+
+static_assert(Core::PoolAllocator::ClassIndex(Core::PoolAllocator::MaxPooledSize) == Core::PoolAllocator::ClassCount - 1, "PoolAllocator size classes are invalid");
+static_assert(Core::PoolAllocator::ClassSize(Core::PoolAllocator::ClassCount - 1) == Core::PoolAllocator::MaxPooledSize, "PoolAllocator size classes are invalid");
+
+/** @brief Polymorphic memory resource over PoolAllocator (UniqueAlloc<Type, PoolResource>, std::pmr containers, ...)
+ *  Alignments above the one of std::malloc fall back to the aligned global operator new */
+class Core::PoolResource final : public std::pmr::memory_resource
+{
+public:
+    /** @brief Get a global instance, every instance shares the same pools */
+    [[nodiscard]] static PoolResource &Default(void) noexcept;
+
+private:
+    [[nodiscard]] void *do_allocate(const std::size_t bytes, const std::size_t alignment) override;
+    void do_deallocate(void * const data, const std::size_t bytes, const std::size_t alignment) override;
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+        { return dynamic_cast<const PoolResource *>(&other); }
+};
@@ -0,0 +1,37 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Radix sort
+ */
+
+#pragma once
+
+#include <array>
+#include <bit>
+
+#include "Parallel.hpp"
+
+namespace Core
+{
+    /** @brief Default radix sort key extractor, the element is the key */
+    struct RadixIdentity
+    {
+        template<typename Type>
+        [[nodiscard]] constexpr const Type &operator()(const Type &value) const noexcept { return value; }
+    };
+
+    /** @brief Stable LSD radix sort (8 bits per pass) of a contiguous range of trivially copyable elements
+     *  The key returned by 'key(element)' may be an integral, enumeration or floating point (negative zero sorts before zero, NaN are not supported)
+     *  A single scratch buffer of the range size is allocated, passes where all keys share the same digit are skipped
+     *  When a pool is given, the digit histograms are computed in parallel */
+    template<typename Iterator, typename KeyFunction = RadixIdentity>
+    void RadixSort(const Iterator first, const Iterator last, KeyFunction &&key = KeyFunction(), ThreadPool * const pool = nullptr);
+
+    namespace Internal
+    {
+        /** @brief Transform a key into an unsigned integer preserving its order */
+        template<typename Key>
+        [[nodiscard]] constexpr auto RadixEncode(const Key key) noexcept;
+    }
+}
+
+#include "RadixSort.ipp"
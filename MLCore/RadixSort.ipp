@@ -0,0 +1,100 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Radix sort
+ */
+
+template<typename Key>
+inline constexpr auto Core::Internal::RadixEncode(const Key key) noexcept
+{
+    if constexpr (std::is_enum_v<Key>)
+        return RadixEncode(static_cast<std::underlying_type_t<Key>>(key));
+    else if constexpr (std::is_same_v<Key, bool>)
+        return static_cast<std::uint8_t>(key);
+    else if constexpr (std::is_integral_v<Key>) {
+        using Unsigned = std::make_unsigned_t<Key>;
+        // Flip the sign bit so that negative values come first
+        if constexpr (std::is_signed_v<Key>)
+            return static_cast<Unsigned>(static_cast<Unsigned>(key) ^ (Unsigned(1) << (sizeof(Unsigned) * 8 - 1)));
+        else
+            return key;
+    } else {
+        static_assert(std::is_floating_point_v<Key> && (sizeof(Key) == 4 || sizeof(Key) == 8), "RadixSort: unsupported key type");
+        using Unsigned = std::conditional_t<sizeof(Key) == 4, std::uint32_t, std::uint64_t>;
+        // Positive values get their sign bit set, negative values are fully inverted to reverse their order
+        const auto bits = std::bit_cast<Unsigned>(key);
+        constexpr auto SignBit = Unsigned(1) << (sizeof(Unsigned) * 8 - 1);
+        return static_cast<Unsigned>(bits & SignBit ? ~bits : bits | SignBit);
+    }
+}
+
+template<typename Iterator, typename KeyFunction>
+inline void Core::RadixSort(const Iterator first, const Iterator last, KeyFunction &&key, ThreadPool * const pool)
+{
+    using Type = std::iter_value_t<Iterator>;
+    using Encoded = decltype(Internal::RadixEncode(key(std::declval<const Type &>())));
+    using Histogram = std::array<std::array<std::size_t, 256>, sizeof(Encoded)>;
+
+    static_assert(std::contiguous_iterator<Iterator>, "RadixSort: range must be contiguous");
+    static_assert(std::is_trivially_copyable_v<Type>, "RadixSort: elements must be trivially copyable");
+
+    constexpr std::size_t InsertionThreshold = 64;
+    constexpr std::size_t PassCount = sizeof(Encoded);
+
+    const auto count = static_cast<std::size_t>(std::distance(first, last));
+    const auto encode = [&key](const Type &value) { return Internal::RadixEncode(key(value)); };
+
+    if (count < InsertionThreshold) {
+        std::stable_sort(first, last, [&encode](const Type &lhs, const Type &rhs) { return encode(lhs) < encode(rhs); });
+        return;
+    }
+
+    // Count every digit of every pass in a single read of the range
+    Histogram histogram {};
+    const auto countDigits = [&encode](const Type *from, const Type * const to, Histogram &target) {
+        for (; from != to; ++from) {
+            const auto encoded = encode(*from);
+            for (auto pass = 0ul; pass < PassCount; ++pass)
+                ++target[pass][(encoded >> (pass * 8)) & 0xFF];
+        }
+    };
+    const auto data = std::to_address(first);
+    if (pool && pool->threadCount() > 1 && count >= Parallel::DefaultThreshold) {
+        const Parallel::Partition<const Type *> partition(data, data + count, pool->threadCount());
+        Vector<Histogram> partials(partition.count(), Histogram {});
+        pool->dispatch(partition.count(), [data, &partition, &partials, &countDigits](const std::size_t index) {
+            const auto chunk = partition[index];
+            countDigits(data + chunk.begin, data + chunk.end, partials[index]);
+        });
+        for (const auto &partial : partials) {
+            for (auto pass = 0ul; pass < PassCount; ++pass) {
+                for (auto digit = 0ul; digit < 256; ++digit)
+                    histogram[pass][digit] += partial[pass][digit];
+            }
+        }
+    } else
+        countDigits(data, data + count, histogram);
+
+    // Scatter back and forth between the range and the scratch buffer
+    // The scratch buffer is raw storage: elements are only ever copied in with memcpy, never constructed
+    Vector<std::byte, std::size_t, GrowthPolicy::Default, AlignedAllocator<alignof(Type)>> scratch;
+    Type *source = data;
+    Type *destination = nullptr;
+    for (auto pass = 0ul; pass < PassCount; ++pass) {
+        auto &digits = histogram[pass];
+        const auto shift = pass * 8;
+        if (digits[(encode(*source) >> shift) & 0xFF] == count)
+            continue;
+        if (!destination) {
+            scratch.resizeUninitialized(count * sizeof(Type));
+            destination = reinterpret_cast<Type *>(scratch.data());
+        }
+        std::size_t offset = 0;
+        for (auto &digit : digits)
+            offset += std::exchange(digit, offset);
+        for (auto it = source, end = source + count; it != end; ++it)
+            std::memcpy(destination + digits[(encode(*it) >> shift) & 0xFF]++, it, sizeof(Type));
+        std::swap(source, destination);
+    }
+    if (source != data)
+        std::memcpy(data, source, sizeof(Type) * count);
+}
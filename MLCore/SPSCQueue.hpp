@@ -0,0 +1,87 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SPSCQueue
+ */
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+
+#include "Vector.hpp"
+
+namespace Core
+{
+    template<typename Type>
+    class SPSCQueue;
+}
+
+/** @brief Bounded wait-free single producer / single consumer queue
+ *  The capacity is rounded to a power of 2, push and pop never block nor allocate
+ *  Producer and consumer indexes live on separate cachelines and each side caches the other's index to limit cache misses */
+template<typename Type>
+class Core::SPSCQueue
+{
+public:
+    static_assert(std::is_nothrow_move_assignable_v<Type> && std::is_nothrow_default_constructible_v<Type>,
+        "SPSCQueue: elements must be nothrow default constructible and move assignable");
+
+    /** @brief Allocate a queue of at least 'capacity' elements */
+    explicit SPSCQueue(const std::size_t capacity) noexcept
+        : _buffer(std::bit_ceil(std::max<std::size_t>(capacity, 2))), _mask(_buffer.size() - 1) {}
+
+    /** @brief A queue is neither copyable nor movable */
+    SPSCQueue(const SPSCQueue &other) = delete;
+    SPSCQueue &operator=(const SPSCQueue &other) = delete;
+
+
+    /** @brief Get the capacity */
+    [[nodiscard]] std::size_t capacity(void) const noexcept { return _buffer.size(); }
+
+    /** @brief Get the approximative number of elements */
+    [[nodiscard]] std::size_t size(void) const noexcept
+        { return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire); }
+
+    /** @brief Approximative empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return !size(); }
+
+
+    /** @brief Push an element (producer only), returns false if the queue is full */
+    template<typename ...Args>
+    [[nodiscard]] bool push(Args &&...args) noexcept
+    {
+        const auto tail = _tail.load(std::memory_order_relaxed);
+
+        if (tail - _cachedHead == _buffer.size()) {
+            _cachedHead = _head.load(std::memory_order_acquire);
+            if (tail - _cachedHead == _buffer.size())
+                return false;
+        }
+        _buffer[tail & _mask] = Type(std::forward<Args>(args)...);
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** @brief Pop an element (consumer only), returns false if the queue is empty */
+    [[nodiscard]] bool pop(Type &value) noexcept
+    {
+        const auto head = _head.load(std::memory_order_relaxed);
+
+        if (head == _cachedTail) {
+            _cachedTail = _tail.load(std::memory_order_acquire);
+            if (head == _cachedTail)
+                return false;
+        }
+        value = std::move(_buffer[head & _mask]);
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    Vector<Type> _buffer;
+    std::size_t _mask;
+    alignas_cacheline std::atomic<std::size_t> _head { 0 };
+    std::size_t _cachedTail { 0 };
+    alignas_cacheline std::atomic<std::size_t> _tail { 0 };
+    std::size_t _cachedHead { 0 };
+};
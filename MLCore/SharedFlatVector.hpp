@@ -0,0 +1,214 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SharedFlatVector
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include "Allocator.hpp"
+#include "VectorDetails.hpp"
+
+namespace Core
+{
+    namespace Internal
+    {
+        template<typename Type, typename Range, typename Allocator>
+        class SharedFlatVectorBase;
+    }
+
+    template<typename Type, typename Range = std::size_t, typename Growth = GrowthPolicy::Default, typename Allocator = DefaultAllocator>
+    class SharedFlatVector;
+}
+
+/** @brief Base implementation of a copy-on-write vector with size, capacity and reference count allocated with data
+ *  Const accessors never copy, mutable accessors clone the buffer first if it is shared with another instance */
+template<typename Type, typename Range, typename Allocator>
+class Core::Internal::SharedFlatVectorBase
+{
+public:
+    /** @brief Output iterator */
+    using Iterator = Type *;
+
+    /** @brief Input iterator */
+    using ConstIterator = const Type *;
+
+
+    /** @brief Vector header, automatically aligned to the best size fit */
+    struct alignas(alignof(Type) <= sizeof(Range) * 2 ? sizeof(Range) * 2 : alignof(Type)) Header
+    {
+        std::atomic<Range> references {};
+        Range size {};
+        Range capacity {};
+    };
+
+
+    /** @brief Fast empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return !_ptr || !sizeUnsafe(); }
+
+
+    /** @brief Get internal data pointer, the mutable overloads detach the buffer */
+    [[nodiscard]] Type *data(void) noexcept { return _ptr ? dataUnsafe() : nullptr; }
+    [[nodiscard]] const Type *data(void) const noexcept { return _ptr ? dataUnsafe() : nullptr; }
+    [[nodiscard]] Type *dataUnsafe(void) noexcept { detach(); return reinterpret_cast<Type *>(_ptr + 1); }
+    [[nodiscard]] const Type *dataUnsafe(void) const noexcept { return reinterpret_cast<const Type *>(_ptr + 1); }
+
+    /** @brief Get the size of the vector */
+    [[nodiscard]] Range size(void) const noexcept { return _ptr ? sizeUnsafe() : Range(); }
+    [[nodiscard]] Range sizeUnsafe(void) const noexcept { return _ptr->size; }
+
+    /** @brief Get the capacity of the vector */
+    [[nodiscard]] Range capacity(void) const noexcept { return _ptr ? capacityUnsafe() : Range(); }
+    [[nodiscard]] Range capacityUnsafe(void) const noexcept { return _ptr->capacity; }
+
+
+    /** @brief Begin / end overloads, the mutable overloads detach the buffer */
+    [[nodiscard]] Iterator begin(void) noexcept { return _ptr ? beginUnsafe() : Iterator(); }
+    [[nodiscard]] Iterator end(void) noexcept { return _ptr ? endUnsafe() : Iterator(); }
+    [[nodiscard]] ConstIterator begin(void) const noexcept { return _ptr ? beginUnsafe() : ConstIterator(); }
+    [[nodiscard]] ConstIterator end(void) const noexcept { return _ptr ? endUnsafe() : ConstIterator(); }
+
+
+    /** @brief Swap two instances */
+    void swap(SharedFlatVectorBase &other) noexcept { std::swap(_ptr, other._ptr); }
+
+
+    /** @brief Check if the buffer is shared with another instance */
+    [[nodiscard]] bool isShared(void) const noexcept { return _ptr && _ptr->references.load(std::memory_order_acquire) != 1; }
+
+    /** @brief Get the number of instances sharing the buffer (0 if there is no buffer) */
+    [[nodiscard]] Range useCount(void) const noexcept { return _ptr ? _ptr->references.load(std::memory_order_acquire) : Range(); }
+
+protected:
+    /** @brief Check if the instance is safe to access */
+    [[nodiscard]] bool isSafe(void) const noexcept { return _ptr; }
+
+    /** @brief Protected data setter */
+    void setData(Type * const data) noexcept { _ptr = data ? reinterpret_cast<Header *>(data) - 1 : nullptr; }
+
+    /** @brief Protected size setter */
+    void setSize(const Range size) noexcept { _ptr->size = size; }
+
+    /** @brief Protected capacity setter */
+    void setCapacity(const Range capacity) noexcept { _ptr->capacity = capacity; }
+
+
+    /** @brief Unsafe begin / end overloads */
+    [[nodiscard]] Iterator beginUnsafe(void) noexcept { return dataUnsafe(); }
+    [[nodiscard]] Iterator endUnsafe(void) noexcept { return dataUnsafe() + sizeUnsafe(); }
+    [[nodiscard]] ConstIterator beginUnsafe(void) const noexcept { return dataUnsafe(); }
+    [[nodiscard]] ConstIterator endUnsafe(void) const noexcept { return dataUnsafe() + sizeUnsafe(); }
+
+
+    /** @brief Number of bytes allocated alongside the elements of each buffer */
+    static constexpr std::size_t AllocationOverhead = sizeof(Header);
+
+    /** @brief Allocates a new buffer, owned by a single instance */
+    [[nodiscard]] Type *allocate(const Range capacity) noexcept
+    {
+        const auto header = new (Allocator::Allocate(sizeof(Header) + sizeof(Type) * capacity)) Header;
+        header->references.store(1, std::memory_order_relaxed);
+        return reinterpret_cast<Type *>(header + 1);
+    }
+
+    /** @brief Get the real capacity of an allocated buffer */
+    [[nodiscard]] Range usableCapacity(Type * const data, const Range capacity) const noexcept
+    {
+        const auto bytes = Allocator::UsableSize(reinterpret_cast<Header *>(data) - 1, sizeof(Header) + sizeof(Type) * capacity);
+        return static_cast<Range>((bytes - sizeof(Header)) / sizeof(Type));
+    }
+
+    /** @brief Deallocates a buffer of a given capacity, the buffer must not be shared */
+    void deallocate(Type *data, const Range capacity) noexcept
+    {
+        const auto header = reinterpret_cast<Header *>(data) - 1;
+        header->~Header();
+        Allocator::Deallocate(header, sizeof(Header) + sizeof(Type) * capacity);
+    }
+
+
+    /** @brief Share the buffer of another instance, the current instance must be empty */
+    void share(const SharedFlatVectorBase &other) noexcept;
+
+    /** @brief Drop the reference to a shared buffer, after this call the instance either owns its buffer or is empty */
+    void unshare(void) noexcept;
+
+    /** @brief Clone the buffer if it is shared */
+    void detach(void) noexcept_copy_constructible(Type) { detach(_ptr->capacity); }
+
+    /** @brief Clone the buffer into a new one of 'capacity' elements (at least the size) if it is shared */
+    void detach(const Range capacity) noexcept_copy_constructible(Type);
+
+private:
+    Header *_ptr { nullptr };
+};
+
+/** @brief Copy-on-write flat vector, copies are O(1) and share the same buffer until one of them is modified
+ *  The vector stays pointer-sized, the reference count is stored in the heap header
+ *  Prefer const access (cbegin, std::as_const) when reading a shared vector as mutable accessors clone it
+ *  Overwriting functions (resize, clear, release) drop a shared buffer instead of cloning it
+ *  References and iterators taken from a mutable accessor stay aliased to the buffer, writing through them after
+ *  the vector has been copied again also modifies the copies */
+template<typename Type, typename Range, typename Growth, typename Allocator>
+class Core::SharedFlatVector : public Internal::VectorDetails<Internal::SharedFlatVectorBase<Type, Range, Allocator>, Type, Range, Growth>
+{
+public:
+    /** @brief Implementation */
+    using Details = Internal::VectorDetails<Internal::SharedFlatVectorBase<Type, Range, Allocator>, Type, Range, Growth>;
+
+    using Details::Details;
+    using Details::isShared;
+    using Details::useCount;
+
+    /** @brief Default constructor */
+    SharedFlatVector(void) noexcept = default;
+
+    /** @brief Copy constructor, shares the buffer */
+    SharedFlatVector(const SharedFlatVector &other) noexcept : Details() { this->share(other); }
+
+    /** @brief Move constructor */
+    SharedFlatVector(SharedFlatVector &&other) noexcept = default;
+
+    /** @brief Drop the reference to the buffer, the last instance releases it */
+    ~SharedFlatVector(void) noexcept_destructible(Type) { this->unshare(); }
+
+    /** @brief Copy assignment, shares the buffer */
+    SharedFlatVector &operator=(const SharedFlatVector &other) noexcept_destructible(Type);
+
+    /** @brief Move assignment */
+    SharedFlatVector &operator=(SharedFlatVector &&other) noexcept = default;
+
+
+    /** @brief Resize the vector using default constructor to initialize each element, a shared buffer is only dropped */
+    void resize(const std::size_t count) noexcept(std::is_nothrow_constructible_v<Type> && nothrow_destructible(Type))
+        { this->unshare(); Details::resize(count); }
+
+    /** @brief Resize the vector by copying given element, a shared buffer is only dropped */
+    void resize(const std::size_t count, const Type &value) noexcept(nothrow_copy_constructible(Type) && nothrow_destructible(Type))
+        { this->unshare(); Details::resize(count, value); }
+
+    /** @brief Resize the vector with input iterators, a shared buffer is only dropped */
+    template<typename InputIterator>
+    std::enable_if_t<std::is_constructible_v<Type, decltype(*std::declval<InputIterator>())>, void>
+        resize(const InputIterator from, const InputIterator to)
+        noexcept(nothrow_destructible(Type) && nothrow_forward_iterator_constructible(InputIterator))
+        { this->unshare(); Details::resize(from, to); }
+
+    /** @brief Reserve memory only if asked capacity is higher than current capacity, a shared buffer is cloned straight into it */
+    bool reserve(const Range capacity) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
+    /** @brief Move the elements into a buffer of exactly 'size' elements, a shared buffer is cloned straight into it
+     *  @return True if the buffer has been reallocated or released */
+    bool shrinkToFit(void) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
+    /** @brief Destroy all elements, a shared buffer is only dropped */
+    void clear(void) noexcept_destructible(Type) { this->unshare(); Details::clear(); }
+
+    /** @brief Destroy all elements and release the buffer, a shared buffer is only dropped */
+    void release(void) noexcept_destructible(Type) { this->unshare(); Details::release(); }
+};
+
+static_assert(sizeof(Core::SharedFlatVector<int>) == sizeof(void *), "SharedFlatVector must be pointer-sized");
+
+#include "SharedFlatVector.ipp"
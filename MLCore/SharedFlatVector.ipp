@@ -0,0 +1,89 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SharedFlatVector
+ */
+
+template<typename Type, typename Range, typename Allocator>
+inline void Core::Internal::SharedFlatVectorBase<Type, Range, Allocator>::share(const SharedFlatVectorBase &other) noexcept
+{
+    if (other._ptr)
+        other._ptr->references.fetch_add(1, std::memory_order_relaxed);
+    _ptr = other._ptr;
+}
+
+template<typename Type, typename Range, typename Allocator>
+inline void Core::Internal::SharedFlatVectorBase<Type, Range, Allocator>::unshare(void) noexcept
+{
+    if (!_ptr || _ptr->references.load(std::memory_order_acquire) == 1)
+        return;
+    // If every other instance dropped the buffer in the meantime, this one becomes its owner
+    if (_ptr->references.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        _ptr = nullptr;
+    else
+        _ptr->references.store(1, std::memory_order_relaxed);
+}
+
+template<typename Type, typename Range, typename Allocator>
+inline void Core::Internal::SharedFlatVectorBase<Type, Range, Allocator>::detach(const Range capacity) noexcept_copy_constructible(Type)
+{
+    if (_ptr->references.load(std::memory_order_acquire) == 1)
+        return;
+    const auto currentPtr = _ptr;
+    const auto currentSize = currentPtr->size;
+    const auto currentCapacity = currentPtr->capacity;
+    const auto currentData = reinterpret_cast<const Type *>(currentPtr + 1);
+    const auto tmpData = allocate(capacity);
+
+    std::uninitialized_copy_n(currentData, currentSize, tmpData);
+    _ptr = reinterpret_cast<Header *>(tmpData) - 1;
+    _ptr->size = currentSize;
+    _ptr->capacity = capacity;
+    coreContainerAccount(OnAccountAllocation<SharedFlatVectorBase>(sizeof(Type) * capacity));
+    coreContainerAccount(OnAccountResize<SharedFlatVectorBase>(0, sizeof(Type) * currentSize));
+    // The other instances may have dropped the buffer while it was copied
+    if (currentPtr->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::destroy_n(reinterpret_cast<Type *>(currentPtr + 1), currentSize);
+        coreContainerAccount(OnAccountResize<SharedFlatVectorBase>(sizeof(Type) * currentSize, 0));
+        coreContainerAccount(OnAccountDeallocation<SharedFlatVectorBase>(sizeof(Type) * currentCapacity));
+        deallocate(reinterpret_cast<Type *>(currentPtr + 1), currentCapacity);
+    }
+}
+
+template<typename Type, typename Range, typename Growth, typename Allocator>
+inline Core::SharedFlatVector<Type, Range, Growth, Allocator> &Core::SharedFlatVector<Type, Range, Growth, Allocator>::operator=(const SharedFlatVector &other)
+    noexcept_destructible(Type)
+{
+    if (this != &other) {
+        release();
+        this->share(other);
+    }
+    return *this;
+}
+
+template<typename Type, typename Range, typename Growth, typename Allocator>
+inline bool Core::SharedFlatVector<Type, Range, Growth, Allocator>::reserve(const Range capacity)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    if (!isShared())
+        return Details::reserve(capacity);
+    else if (capacity <= this->capacity())
+        return false;
+    this->detach(capacity);
+    return true;
+}
+
+template<typename Type, typename Range, typename Growth, typename Allocator>
+inline bool Core::SharedFlatVector<Type, Range, Growth, Allocator>::shrinkToFit(void)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    if (!isShared())
+        return Details::shrinkToFit();
+    const auto currentSize = this->size();
+    if (!currentSize) {
+        release();
+        return true;
+    } else if (currentSize == this->capacity())
+        return false;
+    this->detach(currentSize);
+    return true;
+}
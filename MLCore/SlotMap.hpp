@@ -0,0 +1,137 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SlotMap
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "Vector.hpp"
+
+namespace Core
+{
+    template<typename Type>
+    class SlotMap;
+}
+
+/** @brief Densely stored container addressed by stable 64 bits generational handles
+ *  Values are contiguous (iteration is a plain Vector iteration) and erased with swap-and-pop,
+ *  an indirection table maps handles to their current dense index
+ *  Each slot has a generation, odd while alive, which is bumped on insert and erase so stale handles are detected */
+template<typename Type>
+class Core::SlotMap
+{
+public:
+    /** @brief Handle to a value, stays valid until the value is erased */
+    struct Handle
+    {
+        std::uint32_t index { ~static_cast<std::uint32_t>(0) };
+        std::uint32_t generation { 0 };
+
+        /** @brief Check if the handle is null (never returned by insert) */
+        [[nodiscard]] constexpr bool isNull(void) const noexcept { return !(generation & 1); }
+
+        /** @brief Pack / unpack the handle into a single 64 bits integer */
+        [[nodiscard]] constexpr std::uint64_t value(void) const noexcept
+            { return (static_cast<std::uint64_t>(generation) << 32) | index; }
+        [[nodiscard]] static constexpr Handle FromValue(const std::uint64_t value) noexcept
+            { return Handle { static_cast<std::uint32_t>(value), static_cast<std::uint32_t>(value >> 32) }; }
+
+        /** @brief Comparison operators */
+        [[nodiscard]] constexpr bool operator==(const Handle &other) const noexcept = default;
+    };
+
+    static_assert(sizeof(Handle) == sizeof(std::uint64_t), "SlotMap handle must be 64 bits");
+
+    /** @brief Output iterator */
+    using Iterator = Type *;
+
+    /** @brief Input iterator */
+    using ConstIterator = const Type *;
+
+
+    /** @brief Default constructor */
+    SlotMap(void) noexcept = default;
+
+    /** @brief Copy / move constructors and assignments */
+    SlotMap(const SlotMap &other) noexcept_copy_constructible(Type) = default;
+    SlotMap(SlotMap &&other) noexcept = default;
+    SlotMap &operator=(const SlotMap &other) noexcept_copy_constructible(Type) = default;
+    SlotMap &operator=(SlotMap &&other) noexcept = default;
+
+
+    /** @brief Get the number of values */
+    [[nodiscard]] std::size_t size(void) const noexcept { return _values.size(); }
+
+    /** @brief Fast empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return _values.empty(); }
+
+    /** @brief Get the dense values */
+    [[nodiscard]] Type *data(void) noexcept { return _values.data(); }
+    [[nodiscard]] const Type *data(void) const noexcept { return _values.data(); }
+
+    /** @brief Begin / end overloads over the dense values */
+    [[nodiscard]] Iterator begin(void) noexcept { return _values.begin(); }
+    [[nodiscard]] Iterator end(void) noexcept { return _values.end(); }
+    [[nodiscard]] ConstIterator begin(void) const noexcept { return _values.begin(); }
+    [[nodiscard]] ConstIterator end(void) const noexcept { return _values.end(); }
+
+
+    /** @brief Reserve memory for 'capacity' values */
+    void reserve(const std::size_t capacity) noexcept;
+
+
+    /** @brief Construct a value and get its handle */
+    template<typename ...Args>
+    Handle insert(Args &&...args) noexcept(std::is_nothrow_constructible_v<Type, Args...> && nothrow_destructible(Type));
+
+    /** @brief Erase the value of a handle, returns false if the handle is stale */
+    bool erase(const Handle handle) noexcept(nothrow_forward_assignable(Type) && nothrow_destructible(Type));
+
+    /** @brief Erase all values, every handle becomes stale */
+    void clear(void) noexcept_destructible(Type);
+
+
+    /** @brief Check if a handle refers to a live value */
+    [[nodiscard]] bool contains(const Handle handle) const noexcept
+        { return (handle.generation & 1) && handle.index < _slots.size() && _slots[handle.index].generation == handle.generation; }
+
+    /** @brief Get the value of a handle, nullptr if the handle is stale */
+    [[nodiscard]] Type *get(const Handle handle) noexcept
+        { return contains(handle) ? _values.data() + _slots[handle.index].denseIndex : nullptr; }
+    [[nodiscard]] const Type *get(const Handle handle) const noexcept
+        { return contains(handle) ? _values.data() + _slots[handle.index].denseIndex : nullptr; }
+
+    /** @brief Get the value of a handle, the handle must be valid (asserted in debug) */
+    [[nodiscard]] Type &at(const Handle handle) noexcept_ndebug;
+    [[nodiscard]] const Type &at(const Handle handle) const noexcept_ndebug;
+    [[nodiscard]] Type &operator[](const Handle handle) noexcept_ndebug { return at(handle); }
+    [[nodiscard]] const Type &operator[](const Handle handle) const noexcept_ndebug { return at(handle); }
+
+
+    /** @brief Get the handle of a dense value */
+    [[nodiscard]] Handle handleAt(const std::size_t denseIndex) const noexcept
+    {
+        const auto index = _denseToSlot[denseIndex];
+        return Handle { index, _slots[index].generation };
+    }
+
+private:
+    /** @brief Indirection slot, 'denseIndex' links to the next free slot when the slot is free */
+    struct Slot
+    {
+        std::uint32_t denseIndex {};
+        std::uint32_t generation {};
+    };
+
+    /** @brief End of the free list */
+    static constexpr std::uint32_t NullIndex = ~static_cast<std::uint32_t>(0);
+
+    Vector<Type> _values {};
+    Vector<std::uint32_t> _denseToSlot {};
+    Vector<Slot> _slots {};
+    std::uint32_t _freeHead { NullIndex };
+};
+
+#include "SlotMap.ipp"
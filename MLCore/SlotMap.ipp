@@ -0,0 +1,88 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SlotMap
+ */
+
+template<typename Type>
+inline void Core::SlotMap<Type>::reserve(const std::size_t capacity) noexcept
+{
+    _values.reserve(capacity);
+    _denseToSlot.reserve(capacity);
+    _slots.reserve(capacity);
+}
+
+template<typename Type>
+template<typename ...Args>
+inline typename Core::SlotMap<Type>::Handle Core::SlotMap<Type>::insert(Args &&...args)
+    noexcept(std::is_nothrow_constructible_v<Type, Args...> && nothrow_destructible(Type))
+{
+    std::uint32_t index;
+
+    if (_freeHead != NullIndex) {
+        index = _freeHead;
+        _freeHead = _slots[index].denseIndex;
+    } else {
+        index = static_cast<std::uint32_t>(_slots.size());
+        _slots.push();
+    }
+    auto &slot = _slots[index];
+    slot.denseIndex = static_cast<std::uint32_t>(_values.size());
+    // Generations are odd while alive and even while free
+    ++slot.generation;
+    _values.push(std::forward<Args>(args)...);
+    _denseToSlot.push(index);
+    return Handle { index, slot.generation };
+}
+
+template<typename Type>
+inline bool Core::SlotMap<Type>::erase(const Handle handle)
+    noexcept(nothrow_forward_assignable(Type) && nothrow_destructible(Type))
+{
+    if (!contains(handle))
+        return false;
+    auto &slot = _slots[handle.index];
+    const auto denseIndex = slot.denseIndex;
+    const auto lastIndex = static_cast<std::uint32_t>(_values.size() - 1);
+
+    if (denseIndex != lastIndex) {
+        _values[denseIndex] = std::move(_values[lastIndex]);
+        const auto movedSlot = _denseToSlot[lastIndex];
+        _denseToSlot[denseIndex] = movedSlot;
+        _slots[movedSlot].denseIndex = denseIndex;
+    }
+    _values.pop();
+    _denseToSlot.pop();
+    ++slot.generation;
+    slot.denseIndex = _freeHead;
+    _freeHead = handle.index;
+    return true;
+}
+
+template<typename Type>
+inline void Core::SlotMap<Type>::clear(void) noexcept_destructible(Type)
+{
+    for (const auto index : _denseToSlot) {
+        auto &slot = _slots[index];
+        ++slot.generation;
+        slot.denseIndex = _freeHead;
+        _freeHead = index;
+    }
+    _values.clear();
+    _denseToSlot.clear();
+}
+
+template<typename Type>
+inline Type &Core::SlotMap<Type>::at(const Handle handle) noexcept_ndebug
+{
+    coreAssert(contains(handle),
+        coreDebugThrow(std::logic_error("Core::SlotMap::at: Stale handle")));
+    return _values[_slots[handle.index].denseIndex];
+}
+
+template<typename Type>
+inline const Type &Core::SlotMap<Type>::at(const Handle handle) const noexcept_ndebug
+{
+    coreAssert(contains(handle),
+        coreDebugThrow(std::logic_error("Core::SlotMap::at: Stale handle")));
+    return _values[_slots[handle.index].denseIndex];
+}
@@ -0,0 +1,160 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: RCU-style snapshot pointer for read-mostly shared state
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "Vector.hpp"
+
+namespace Core
+{
+    template<typename Type, std::size_t MaxReaders = 16>
+    class Snapshot;
+}
+
+/** @brief Read-mostly state published by writers and read without any synchronization cost by registered readers
+ *  Reclamation follows quiescent-state-based RCU (QSBR) :
+ *  - A reader gets the current version with a single atomic load, no reference count is touched
+ *  - A reader periodically announces a quiescent state (typically at the end of each audio block),
+ *    versions it obtained before that point must not be used anymore
+ *  - A writer publishes a new version with an atomic exchange, the previous one is retired
+ *  - Retired versions are deleted by writers (in publish / reclaim) once every online reader has been quiescent since
+ *  Readers that stop reading for a while (thread paused, audio stopped) must go offline so they don't block reclamation
+ *  The reader path is wait-free and never allocates, writers are serialized by a mutex */
+template<typename Type, std::size_t MaxReaders>
+class Core::Snapshot
+{
+    struct ReaderSlot;
+
+public:
+    /** @brief A registered reader, owned by a single thread */
+    class Reader
+    {
+    public:
+        /** @brief Default constructor, the reader is invalid */
+        Reader(void) noexcept = default;
+
+        /** @brief Move constructor */
+        Reader(Reader &&other) noexcept
+            : _snapshot(std::exchange(other._snapshot, nullptr)), _slot(std::exchange(other._slot, nullptr)) {}
+
+        /** @brief Unregister the reader */
+        ~Reader(void) noexcept { release(); }
+
+        /** @brief Move assignment */
+        Reader &operator=(Reader &&other) noexcept;
+
+
+        /** @brief Check if the reader is registered */
+        [[nodiscard]] bool valid(void) const noexcept { return _slot; }
+        [[nodiscard]] operator bool(void) const noexcept { return valid(); }
+
+
+        /** @brief Get the current version (single atomic load)
+         *  The pointer stays valid until the next call to 'quiescent' or 'offline' */
+        [[nodiscard]] const Type *get(void) const noexcept { return _snapshot->_current.load(std::memory_order_acquire); }
+        [[nodiscard]] const Type *operator->(void) const noexcept { return get(); }
+        [[nodiscard]] const Type &operator*(void) const noexcept { return *get(); }
+
+
+        /** @brief Announce that no version previously obtained by this reader is in use anymore */
+        void quiescent(void) noexcept
+            { _slot->epoch.store(_snapshot->_epoch.load(std::memory_order_acquire), std::memory_order_release); }
+
+        /** @brief Stop reading, the reader does not block reclamation until it goes online again */
+        void offline(void) noexcept { _slot->epoch.store(Offline, std::memory_order_release); }
+
+        /** @brief Resume reading after 'offline' */
+        void online(void) noexcept;
+
+    private:
+        Snapshot *_snapshot { nullptr };
+        ReaderSlot *_slot { nullptr };
+
+        /** @brief Private constructor used by the snapshot */
+        Reader(Snapshot * const snapshot, ReaderSlot * const slot) noexcept
+            : _snapshot(snapshot), _slot(slot) {}
+
+        /** @brief Release the reader slot */
+        void release(void) noexcept;
+
+        friend Snapshot;
+    };
+
+
+    /** @brief Construct the snapshot without any version */
+    Snapshot(void) noexcept = default;
+
+    /** @brief Construct the snapshot with an initial version */
+    explicit Snapshot(std::unique_ptr<Type> &&initial) noexcept : _current(initial.release()) {}
+
+    /** @brief A snapshot is neither copyable nor movable */
+    Snapshot(const Snapshot &other) = delete;
+    Snapshot &operator=(const Snapshot &other) = delete;
+
+    /** @brief Delete every version, no reader may be registered anymore */
+    ~Snapshot(void) noexcept;
+
+
+    /** @brief Register a reader, the returned reader is invalid if MaxReaders readers are already registered
+     *  The reader starts online */
+    [[nodiscard]] Reader registerReader(void) noexcept;
+
+
+    /** @brief Publish a new version, the previous one is retired then retired versions are reclaimed when possible */
+    void publish(std::unique_ptr<Type> &&next) noexcept;
+
+    /** @brief Construct and publish a new version */
+    template<typename ...Args>
+    void emplace(Args &&...args) { publish(std::make_unique<Type>(std::forward<Args>(args)...)); }
+
+    /** @brief Delete the retired versions that no reader can observe anymore
+     *  @return The number of deleted versions */
+    std::size_t reclaim(void) noexcept;
+
+
+    /** @brief Get the current version, only safe on writer threads (a concurrent writer may delete it) */
+    [[nodiscard]] const Type *current(void) const noexcept { return _current.load(std::memory_order_acquire); }
+
+    /** @brief Get the number of retired versions not reclaimed yet */
+    [[nodiscard]] std::size_t retiredCount(void) const noexcept;
+
+private:
+    /** @brief Slot epoch values, any other value is the last global epoch observed by an online reader */
+    static constexpr std::uint64_t Free = 0;
+    static constexpr std::uint64_t Offline = std::numeric_limits<std::uint64_t>::max();
+
+    /** @brief Per-reader state, on its own cacheline so readers never share one */
+    struct alignas_cacheline ReaderSlot
+    {
+        std::atomic<std::uint64_t> epoch { Free };
+    };
+
+    static_assert_fit_cacheline(ReaderSlot);
+
+    /** @brief A replaced version and the epoch readers must reach before it can be deleted */
+    struct Retired
+    {
+        Type *data {};
+        std::uint64_t epoch {};
+    };
+
+    alignas_cacheline std::atomic<const Type *> _current { nullptr };
+    alignas_cacheline std::atomic<std::uint64_t> _epoch { 1 };
+    std::array<ReaderSlot, MaxReaders> _slots {};
+    mutable std::mutex _mutex {};
+    Vector<Retired> _retired {};
+
+    /** @brief Reclaim without locking */
+    std::size_t reclaimUnsafe(void) noexcept;
+};
+
+#include "Snapshot.ipp"
@@ -0,0 +1,106 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: RCU-style snapshot pointer for read-mostly shared state
+ */
+
+template<typename Type, std::size_t MaxReaders>
+inline typename Core::Snapshot<Type, MaxReaders>::Reader &Core::Snapshot<Type, MaxReaders>::Reader::operator=(Reader &&other) noexcept
+{
+    if (this != &other) {
+        release();
+        _snapshot = std::exchange(other._snapshot, nullptr);
+        _slot = std::exchange(other._slot, nullptr);
+    }
+    return *this;
+}
+
+template<typename Type, std::size_t MaxReaders>
+inline void Core::Snapshot<Type, MaxReaders>::Reader::online(void) noexcept
+{
+    _slot->epoch.store(_snapshot->_epoch.load(std::memory_order_acquire), std::memory_order_relaxed);
+    // Pairs with the fence of reclaim: either the writer sees this reader online, or this reader sees the latest version
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+template<typename Type, std::size_t MaxReaders>
+inline void Core::Snapshot<Type, MaxReaders>::Reader::release(void) noexcept
+{
+    if (_slot) {
+        _slot->epoch.store(Free, std::memory_order_release);
+        _snapshot = nullptr;
+        _slot = nullptr;
+    }
+}
+
+template<typename Type, std::size_t MaxReaders>
+inline Core::Snapshot<Type, MaxReaders>::~Snapshot(void) noexcept
+{
+    for (const auto &retired : _retired)
+        delete retired.data;
+    delete _current.load(std::memory_order_relaxed);
+}
+
+template<typename Type, std::size_t MaxReaders>
+inline typename Core::Snapshot<Type, MaxReaders>::Reader Core::Snapshot<Type, MaxReaders>::registerReader(void) noexcept
+{
+    for (auto &slot : _slots) {
+        auto expected = Free;
+        if (slot.epoch.compare_exchange_strong(expected, Offline, std::memory_order_acquire, std::memory_order_relaxed)) {
+            Reader reader(this, &slot);
+            reader.online();
+            return reader;
+        }
+    }
+    return Reader();
+}
+
+template<typename Type, std::size_t MaxReaders>
+inline void Core::Snapshot<Type, MaxReaders>::publish(std::unique_ptr<Type> &&next) noexcept
+{
+    std::lock_guard lock(_mutex);
+    const auto previous = _current.exchange(next.release(), std::memory_order_acq_rel);
+
+    if (previous) {
+        // Readers that observed this epoch or a later one loaded the new version
+        const auto epoch = _epoch.fetch_add(1, std::memory_order_acq_rel) + 1;
+        _retired.push(Retired { const_cast<Type *>(previous), epoch });
+    }
+    reclaimUnsafe();
+}
+
+template<typename Type, std::size_t MaxReaders>
+inline std::size_t Core::Snapshot<Type, MaxReaders>::reclaim(void) noexcept
+{
+    std::lock_guard lock(_mutex);
+
+    return reclaimUnsafe();
+}
+
+template<typename Type, std::size_t MaxReaders>
+inline std::size_t Core::Snapshot<Type, MaxReaders>::retiredCount(void) const noexcept
+{
+    std::lock_guard lock(_mutex);
+
+    return _retired.size();
+}
+
+template<typename Type, std::size_t MaxReaders>
+inline std::size_t Core::Snapshot<Type, MaxReaders>::reclaimUnsafe(void) noexcept
+{
+    if (_retired.empty())
+        return 0;
+    // Pairs with the fence of Reader::online
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto minimum = Offline;
+    for (const auto &slot : _slots) {
+        const auto epoch = slot.epoch.load(std::memory_order_acquire);
+        if (epoch != Free)
+            minimum = std::min(minimum, epoch);
+    }
+    return _retired.removeIf([minimum](const Retired &retired) {
+        if (retired.epoch > minimum)
+            return false;
+        delete retired.data;
+        return true;
+    });
+}
@@ -0,0 +1,108 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: StaticString
+ */
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include "StaticVector.hpp"
+
+namespace Core
+{
+    template<typename Type, std::size_t Capacity>
+    class StaticStringBase;
+
+    template<std::size_t Capacity>
+    using StaticString = StaticStringBase<char, Capacity>;
+}
+
+/** @brief Fixed-capacity string stored inline, every function is constexpr so it can be built at compile time
+ *  Like FlatString it is NOT NULL TERMINATED, use toStdView to pass it around
+ *  A string literal deduces its capacity: 'constexpr Core::StaticStringBase Name("Saw")' */
+template<typename Type, std::size_t Capacity>
+class Core::StaticStringBase : public StaticVector<Type, Capacity>
+{
+public:
+    using Vector = StaticVector<Type, Capacity>;
+
+    using Vector::Vector;
+    using Vector::data;
+    using Vector::size;
+    using Vector::begin;
+    using Vector::end;
+    using Vector::resize;
+    using Vector::insert;
+    using Vector::empty;
+    using Vector::operator bool;
+
+    /** @brief Default constructor */
+    constexpr StaticStringBase(void) noexcept = default;
+
+    /** @brief CString constructor */
+    constexpr StaticStringBase(const Type * const cstring) noexcept(nothrow_ndebug) { *this = ToView(cstring); }
+
+    /** @brief std::string_view constructor */
+    constexpr explicit StaticStringBase(const std::basic_string_view<Type> &other) noexcept(nothrow_ndebug) { *this = other; }
+
+    /** @brief cstring assignment */
+    constexpr StaticStringBase &operator=(const Type * const cstring) noexcept(nothrow_ndebug) { return *this = ToView(cstring); }
+
+    /** @brief std::string_view assignment */
+    constexpr StaticStringBase &operator=(const std::basic_string_view<Type> &other) noexcept(nothrow_ndebug)
+        { resize(other.begin(), other.end()); return *this; }
+
+    /** @brief Append another static string */
+    template<std::size_t OtherCapacity>
+    constexpr StaticStringBase &append(const StaticStringBase<Type, OtherCapacity> &other) noexcept(nothrow_ndebug)
+        { return append(other.toStdView()); }
+
+    /** @brief Append a cstring */
+    constexpr StaticStringBase &append(const Type * const cstring) noexcept(nothrow_ndebug) { return append(ToView(cstring)); }
+
+    /** @brief Append a std::string_view */
+    constexpr StaticStringBase &append(const std::basic_string_view<Type> &other) noexcept(nothrow_ndebug)
+        { Vector::append(other.begin(), other.end()); return *this; }
+
+    /** @brief Append a single character */
+    constexpr StaticStringBase &append(const Type character) noexcept(nothrow_ndebug) { Vector::push(character); return *this; }
+
+    /** @brief Append operators */
+    template<std::size_t OtherCapacity>
+    constexpr StaticStringBase &operator+=(const StaticStringBase<Type, OtherCapacity> &other) noexcept(nothrow_ndebug) { return append(other); }
+    constexpr StaticStringBase &operator+=(const Type * const cstring) noexcept(nothrow_ndebug) { return append(cstring); }
+    constexpr StaticStringBase &operator+=(const std::basic_string_view<Type> &other) noexcept(nothrow_ndebug) { return append(other); }
+    constexpr StaticStringBase &operator+=(const Type character) noexcept(nothrow_ndebug) { return append(character); }
+
+    /** @brief Comparison operators */
+    template<std::size_t OtherCapacity>
+    [[nodiscard]] constexpr bool operator==(const StaticStringBase<Type, OtherCapacity> &other) const noexcept
+        { return toStdView() == other.toStdView(); }
+    [[nodiscard]] constexpr bool operator==(const Type * const cstring) const noexcept { return toStdView() == ToView(cstring); }
+    [[nodiscard]] constexpr bool operator==(const std::basic_string_view<Type> &other) const noexcept { return toStdView() == other; }
+
+    /** @brief Get a std::string_view of the object */
+    [[nodiscard]] constexpr std::basic_string_view<Type> toStdView(void) const noexcept
+        { return std::basic_string_view<Type>(data(), size()); }
+
+    /** @brief Get a std::string from the object */
+    [[nodiscard]] std::basic_string<Type> toStdString(void) const noexcept { return std::basic_string<Type>(data(), size()); }
+
+private:
+    [[nodiscard]] static constexpr std::basic_string_view<Type> ToView(const Type * const cstring) noexcept
+    {
+        if (!cstring)
+            return std::basic_string_view<Type>();
+        else
+            return std::basic_string_view<Type>(cstring);
+    }
+};
+
+namespace Core
+{
+    /** @brief A string literal deduces the capacity of the string (without the null terminator) */
+    template<typename Type, std::size_t Size>
+    StaticStringBase(const Type (&)[Size]) -> StaticStringBase<Type, Size - 1>;
+}
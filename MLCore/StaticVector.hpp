@@ -0,0 +1,218 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: StaticVector
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <stdexcept>
+
+#include "Utils.hpp"
+#include "Assert.hpp"
+
+namespace Core
+{
+    template<typename Type, std::size_t Capacity>
+    class StaticVector;
+
+    namespace Internal
+    {
+        /** @brief Smallest unsigned integer able to store a size in [0, Capacity] */
+        template<std::size_t Capacity>
+        using StaticRange = std::conditional_t<Capacity <= std::numeric_limits<std::uint8_t>::max(), std::uint8_t,
+            std::conditional_t<Capacity <= std::numeric_limits<std::uint16_t>::max(), std::uint16_t,
+            std::conditional_t<Capacity <= std::numeric_limits<std::uint32_t>::max(), std::uint32_t, std::size_t>>>;
+    }
+}
+
+/** @brief Fixed-capacity vector storing its elements inline, every function is constexpr
+ *  A constexpr StaticVector is built at compile time and lives in read-only data, use it for lookup tables
+ *  Unused slots hold default constructed elements, erased elements are reset to their default value
+ *  Exceeding the capacity is asserted in debug (and is a compile error in constant evaluation) */
+template<typename Type, std::size_t Capacity>
+class Core::StaticVector
+{
+public:
+    static_assert(Capacity, "StaticVector: capacity must not be zero");
+    static_assert(std::is_default_constructible_v<Type> && std::is_move_assignable_v<Type>,
+        "StaticVector: elements must be default constructible and move assignable");
+
+    /** @brief Size type */
+    using Range = Internal::StaticRange<Capacity>;
+
+    /** @brief Output iterator */
+    using Iterator = Type *;
+
+    /** @brief Input iterator */
+    using ConstIterator = const Type *;
+
+
+    /** @brief Default constructor */
+    constexpr StaticVector(void) noexcept = default;
+
+    /** @brief Resize with default constructor */
+    constexpr explicit StaticVector(const std::size_t count) noexcept(nothrow_ndebug) { resize(count); }
+
+    /** @brief Resize with copy constructor */
+    constexpr StaticVector(const std::size_t count, const Type &value) noexcept(nothrow_ndebug && nothrow_copy_assignable(Type))
+        { resize(count, value); }
+
+    /** @brief Insert constructor */
+    template<typename InputIterator>
+    constexpr StaticVector(const InputIterator from, const InputIterator to) noexcept(nothrow_ndebug && nothrow_forward_assignable(Type))
+        { resize(from, to); }
+
+    /** @brief Initializer list constructor */
+    constexpr StaticVector(std::initializer_list<Type> init) noexcept(nothrow_ndebug && nothrow_copy_assignable(Type))
+        { resize(init.begin(), init.end()); }
+
+    /** @brief Copy / move constructors and assignments */
+    constexpr StaticVector(const StaticVector &other) noexcept_copy_constructible(Type) = default;
+    constexpr StaticVector(StaticVector &&other) noexcept_move_constructible(Type) = default;
+    constexpr StaticVector &operator=(const StaticVector &other) noexcept_copy_assignable(Type) = default;
+    constexpr StaticVector &operator=(StaticVector &&other) noexcept_move_assignable(Type) = default;
+
+
+    /** @brief Fast empty check */
+    [[nodiscard]] constexpr bool empty(void) const noexcept { return !_size; }
+
+    /** @brief Fast non-empty check */
+    [[nodiscard]] constexpr operator bool(void) const noexcept { return !empty(); }
+
+    /** @brief Fast full check */
+    [[nodiscard]] constexpr bool full(void) const noexcept { return _size == Capacity; }
+
+
+    /** @brief Get internal data pointer */
+    [[nodiscard]] constexpr Type *data(void) noexcept { return _data; }
+    [[nodiscard]] constexpr const Type *data(void) const noexcept { return _data; }
+
+    /** @brief Get the size of the vector */
+    [[nodiscard]] constexpr Range size(void) const noexcept { return _size; }
+
+    /** @brief Get the capacity of the vector */
+    [[nodiscard]] static constexpr std::size_t capacity(void) noexcept { return Capacity; }
+
+
+    /** @brief Begin / end overloads */
+    [[nodiscard]] constexpr Iterator begin(void) noexcept { return _data; }
+    [[nodiscard]] constexpr Iterator end(void) noexcept { return _data + _size; }
+    [[nodiscard]] constexpr ConstIterator begin(void) const noexcept { return _data; }
+    [[nodiscard]] constexpr ConstIterator end(void) const noexcept { return _data + _size; }
+    [[nodiscard]] constexpr ConstIterator cbegin(void) const noexcept { return begin(); }
+    [[nodiscard]] constexpr ConstIterator cend(void) const noexcept { return end(); }
+
+
+    /** @brief Access element at positon */
+    [[nodiscard]] constexpr Type &at(const Range pos) noexcept { return _data[pos]; }
+    [[nodiscard]] constexpr const Type &at(const Range pos) const noexcept { return _data[pos]; }
+
+    /** @brief Access element at positon */
+    [[nodiscard]] constexpr Type &operator[](const Range pos) noexcept { return _data[pos]; }
+    [[nodiscard]] constexpr const Type &operator[](const Range pos) const noexcept { return _data[pos]; }
+
+    /** @brief Get first element */
+    [[nodiscard]] constexpr Type &front(void) noexcept { return _data[0]; }
+    [[nodiscard]] constexpr const Type &front(void) const noexcept { return _data[0]; }
+
+    /** @brief Get last element */
+    [[nodiscard]] constexpr Type &back(void) noexcept { return _data[_size - 1]; }
+    [[nodiscard]] constexpr const Type &back(void) const noexcept { return _data[_size - 1]; }
+
+
+    /** @brief Get a span over the elements */
+    [[nodiscard]] constexpr std::span<Type> toSpan(void) noexcept { return std::span<Type>(_data, _size); }
+    [[nodiscard]] constexpr std::span<const Type> toSpan(void) const noexcept { return std::span<const Type>(_data, _size); }
+
+
+    /** @brief Push an element into the vector */
+    template<typename ...Args>
+    constexpr Type &push(Args &&...args) noexcept(nothrow_ndebug && std::is_nothrow_constructible_v<Type, Args...> && nothrow_move_assignable(Type));
+
+    /** @brief Pop the last element of the vector */
+    constexpr void pop(void) noexcept_move_assignable(Type);
+
+
+    /** @brief Append a range of elements at the end of the vector
+     *  @return Iterator to the first appended element */
+    template<typename InputIterator>
+    constexpr std::enable_if_t<std::is_assignable_v<Type &, decltype(*std::declval<InputIterator>())>, Iterator>
+        append(const InputIterator from, const InputIterator to) noexcept(nothrow_ndebug && nothrow_forward_assignable(Type));
+
+    /** @brief Append a contiguous range of elements at the end of the vector */
+    constexpr Iterator append(const std::span<const Type> values) noexcept(nothrow_ndebug && nothrow_copy_assignable(Type))
+        { return append(values.begin(), values.end()); }
+
+    /** @brief Append an initializer list at the end of the vector */
+    constexpr Iterator append(std::initializer_list<Type> &&init) noexcept(nothrow_ndebug && nothrow_copy_assignable(Type))
+        { return append(init.begin(), init.end()); }
+
+
+    /** @brief Insert an initializer list */
+    constexpr Iterator insert(const Iterator pos, std::initializer_list<Type> &&init) noexcept(nothrow_ndebug && nothrow_forward_assignable(Type))
+        { return insert(pos, init.begin(), init.end()); }
+
+    /** @brief Insert a range of element by iterating over iterators */
+    template<typename InputIterator>
+    constexpr std::enable_if_t<std::is_assignable_v<Type &, decltype(*std::declval<InputIterator>())>, Iterator>
+        insert(const Iterator pos, const InputIterator from, const InputIterator to) noexcept(nothrow_ndebug && nothrow_forward_assignable(Type));
+
+    /** @brief Insert a range of copies */
+    constexpr Iterator insert(const Iterator pos, const std::size_t count, const Type &value) noexcept(nothrow_ndebug && nothrow_forward_assignable(Type));
+
+
+    /** @brief Remove a range of elements */
+    constexpr void erase(const Iterator from, const Iterator to) noexcept_move_assignable(Type);
+
+    /** @brief Remove a range of elements */
+    constexpr void erase(const Iterator from, const std::size_t count) noexcept_move_assignable(Type)
+        { erase(from, from + count); }
+
+    /** @brief Remove a specific element */
+    constexpr void erase(const Iterator pos) noexcept_move_assignable(Type) { erase(pos, pos + 1); }
+
+    /** @brief Remove a specific element in O(1) by moving the last element in its place, the order is not preserved */
+    constexpr void eraseUnordered(const Iterator pos) noexcept_move_assignable(Type);
+
+    /** @brief Remove every element matching 'predicate' in a single compacting pass, the order of the survivors is preserved
+     *  @return The number of removed elements */
+    template<typename Predicate>
+    constexpr Range removeIf(Predicate &&predicate) noexcept(nothrow_invokable(Predicate, Type &) && nothrow_move_assignable(Type));
+
+
+    /** @brief Resize the vector, every element is reset to its default value */
+    constexpr void resize(const std::size_t count) noexcept(nothrow_ndebug && nothrow_move_assignable(Type));
+
+    /** @brief Resize the vector by copying given element */
+    constexpr void resize(const std::size_t count, const Type &value) noexcept(nothrow_ndebug && nothrow_copy_assignable(Type));
+
+    /** @brief Resize the vector with input iterators */
+    template<typename InputIterator>
+    constexpr std::enable_if_t<std::is_assignable_v<Type &, decltype(*std::declval<InputIterator>())>, void>
+        resize(const InputIterator from, const InputIterator to) noexcept(nothrow_ndebug && nothrow_forward_assignable(Type));
+
+
+    /** @brief Reset all elements to their default value */
+    constexpr void clear(void) noexcept_move_assignable(Type) { resetTail(0); }
+
+
+    /** @brief Comparison operators */
+    template<std::size_t OtherCapacity>
+    [[nodiscard]] constexpr bool operator==(const StaticVector<Type, OtherCapacity> &other) const noexcept
+        { return std::equal(begin(), end(), other.begin(), other.end()); }
+
+private:
+    Type _data[Capacity] {};
+    Range _size {};
+
+    /** @brief Reset the elements past 'size' to their default value and update the size */
+    constexpr void resetTail(const std::size_t size) noexcept_move_assignable(Type);
+};
+
+#include "StaticVector.ipp"
@@ -0,0 +1,145 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: StaticVector
+ */
+
+template<typename Type, std::size_t Capacity>
+template<typename ...Args>
+constexpr Type &Core::StaticVector<Type, Capacity>::push(Args &&...args)
+    noexcept(nothrow_ndebug && std::is_nothrow_constructible_v<Type, Args...> && nothrow_move_assignable(Type))
+{
+    coreAssert(_size < Capacity,
+        coreDebugThrow(std::logic_error("Core::StaticVector::push: Capacity exceeded")));
+    auto &elem = _data[_size++];
+    elem = Type(std::forward<Args>(args)...);
+    return elem;
+}
+
+template<typename Type, std::size_t Capacity>
+constexpr void Core::StaticVector<Type, Capacity>::pop(void) noexcept_move_assignable(Type)
+{
+    _data[--_size] = Type();
+}
+
+template<typename Type, std::size_t Capacity>
+template<typename InputIterator>
+constexpr std::enable_if_t<std::is_assignable_v<Type &, decltype(*std::declval<InputIterator>())>, typename Core::StaticVector<Type, Capacity>::Iterator>
+    Core::StaticVector<Type, Capacity>::append(const InputIterator from, const InputIterator to)
+    noexcept(nothrow_ndebug && nothrow_forward_assignable(Type))
+{
+    const std::size_t count = std::distance(from, to);
+
+    coreAssert(_size + count <= Capacity,
+        coreDebugThrow(std::logic_error("Core::StaticVector::append: Capacity exceeded")));
+    const auto first = end();
+    std::copy(from, to, first);
+    _size = static_cast<Range>(_size + count);
+    return first;
+}
+
+template<typename Type, std::size_t Capacity>
+template<typename InputIterator>
+constexpr std::enable_if_t<std::is_assignable_v<Type &, decltype(*std::declval<InputIterator>())>, typename Core::StaticVector<Type, Capacity>::Iterator>
+    Core::StaticVector<Type, Capacity>::insert(const Iterator pos, const InputIterator from, const InputIterator to)
+    noexcept(nothrow_ndebug && nothrow_forward_assignable(Type))
+{
+    const std::size_t count = std::distance(from, to);
+
+    coreAssert(_size + count <= Capacity,
+        coreDebugThrow(std::logic_error("Core::StaticVector::insert: Capacity exceeded")));
+    const auto currentEnd = end();
+    std::move_backward(pos, currentEnd, currentEnd + count);
+    std::copy(from, to, pos);
+    _size = static_cast<Range>(_size + count);
+    return pos;
+}
+
+template<typename Type, std::size_t Capacity>
+constexpr typename Core::StaticVector<Type, Capacity>::Iterator
+    Core::StaticVector<Type, Capacity>::insert(const Iterator pos, const std::size_t count, const Type &value)
+    noexcept(nothrow_ndebug && nothrow_forward_assignable(Type))
+{
+    coreAssert(_size + count <= Capacity,
+        coreDebugThrow(std::logic_error("Core::StaticVector::insert: Capacity exceeded")));
+    const auto currentEnd = end();
+    std::move_backward(pos, currentEnd, currentEnd + count);
+    std::fill_n(pos, count, value);
+    _size = static_cast<Range>(_size + count);
+    return pos;
+}
+
+template<typename Type, std::size_t Capacity>
+constexpr void Core::StaticVector<Type, Capacity>::erase(const Iterator from, const Iterator to) noexcept_move_assignable(Type)
+{
+    if (from == to)
+        return;
+    const auto last = std::move(to, end(), from);
+    resetTail(static_cast<std::size_t>(last - _data));
+}
+
+template<typename Type, std::size_t Capacity>
+constexpr void Core::StaticVector<Type, Capacity>::eraseUnordered(const Iterator pos) noexcept_move_assignable(Type)
+{
+    const auto last = end() - 1;
+
+    if (pos != last)
+        *pos = std::move(*last);
+    pop();
+}
+
+template<typename Type, std::size_t Capacity>
+template<typename Predicate>
+constexpr typename Core::StaticVector<Type, Capacity>::Range Core::StaticVector<Type, Capacity>::removeIf(Predicate &&predicate)
+    noexcept(nothrow_invokable(Predicate, Type &) && nothrow_move_assignable(Type))
+{
+    const auto currentSize = _size;
+    const auto last = std::remove_if(begin(), end(), predicate);
+
+    resetTail(static_cast<std::size_t>(last - _data));
+    return static_cast<Range>(currentSize - _size);
+}
+
+template<typename Type, std::size_t Capacity>
+constexpr void Core::StaticVector<Type, Capacity>::resize(const std::size_t count)
+    noexcept(nothrow_ndebug && nothrow_move_assignable(Type))
+{
+    coreAssert(count <= Capacity,
+        coreDebugThrow(std::logic_error("Core::StaticVector::resize: Capacity exceeded")));
+    // Slots past the size already hold default constructed elements
+    resetTail(0);
+    _size = static_cast<Range>(count);
+}
+
+template<typename Type, std::size_t Capacity>
+constexpr void Core::StaticVector<Type, Capacity>::resize(const std::size_t count, const Type &value)
+    noexcept(nothrow_ndebug && nothrow_copy_assignable(Type))
+{
+    coreAssert(count <= Capacity,
+        coreDebugThrow(std::logic_error("Core::StaticVector::resize: Capacity exceeded")));
+    resetTail(std::min<std::size_t>(count, _size));
+    std::fill_n(_data, count, value);
+    _size = static_cast<Range>(count);
+}
+
+template<typename Type, std::size_t Capacity>
+template<typename InputIterator>
+constexpr std::enable_if_t<std::is_assignable_v<Type &, decltype(*std::declval<InputIterator>())>, void>
+    Core::StaticVector<Type, Capacity>::resize(const InputIterator from, const InputIterator to)
+    noexcept(nothrow_ndebug && nothrow_forward_assignable(Type))
+{
+    const std::size_t count = std::distance(from, to);
+
+    coreAssert(count <= Capacity,
+        coreDebugThrow(std::logic_error("Core::StaticVector::resize: Capacity exceeded")));
+    resetTail(std::min<std::size_t>(count, _size));
+    std::copy(from, to, _data);
+    _size = static_cast<Range>(count);
+}
+
+template<typename Type, std::size_t Capacity>
+constexpr void Core::StaticVector<Type, Capacity>::resetTail(const std::size_t size) noexcept_move_assignable(Type)
+{
+    for (auto it = _data + size, last = end(); it != last; ++it)
+        *it = Type();
+    _size = static_cast<Range>(size);
+}
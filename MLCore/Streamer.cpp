@@ -0,0 +1,193 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Streamer
+ */
+
+#include <cerrno>
+#include <fcntl.h>
+
+#if defined(_WIN32)
+# include <io.h>
+#else
+# include <unistd.h>
+# include <sys/stat.h>
+#endif
+
+#include "Streamer.hpp"
+
+using namespace Core;
+
+Streamer::Streamer(const Config &config) noexcept
+    : _config(Config {
+        AlignedAllocator<BlockAlignment>::RoundSize(std::max<std::size_t>(config.blockSize, 1)),
+        std::max<std::size_t>(config.readAhead, 1)
+    }),
+    _filled(_config.readAhead), _free(_config.readAhead)
+{
+    _buffers.resize(_config.readAhead);
+    _blocks.resize(_config.readAhead);
+    for (auto i = 0ul; i < _config.readAhead; ++i) {
+        _buffers[i].resizeUninitialized(_config.blockSize);
+        _blocks[i].data = _buffers[i].data();
+    }
+}
+
+bool Streamer::open(const char * const path, const std::uint64_t offset) noexcept
+{
+    close();
+#if defined(_WIN32)
+    _fd = ::_open(path, _O_RDONLY | _O_BINARY);
+#else
+    _fd = ::open(path, O_RDONLY | O_CLOEXEC);
+#endif
+    if (_fd < 0)
+        return false;
+#if defined(_WIN32)
+    _fileSize = static_cast<std::uint64_t>(::_lseeki64(_fd, 0, SEEK_END));
+#else
+    struct stat status {};
+    _fileSize = ::fstat(_fd, &status) ? 0 : static_cast<std::uint64_t>(status.st_size);
+# if defined(POSIX_FADV_SEQUENTIAL)
+    ::posix_fadvise(_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+# endif
+#endif
+    for (auto i = 0u; i < _config.readAhead; ++i)
+        static_cast<void>(_free.push(i));
+    _consumerGeneration = 0;
+    _seekGeneration.store(0, std::memory_order_relaxed);
+    _seekOffset.store(offset & ~static_cast<std::uint64_t>(BlockAlignment - 1), std::memory_order_relaxed);
+    _endGeneration.store(~static_cast<std::uint32_t>(0), std::memory_order_relaxed);
+    _failed.store(false, std::memory_order_relaxed);
+    _stop.store(false, std::memory_order_relaxed);
+    _thread = std::thread([this] { run(); });
+    return true;
+}
+
+void Streamer::close(void) noexcept
+{
+    if (_fd < 0)
+        return;
+    _stop.store(true, std::memory_order_release);
+    wake();
+    _thread.join();
+#if defined(_WIN32)
+    ::_close(_fd);
+#else
+    ::close(_fd);
+#endif
+    _fd = -1;
+    _fileSize = 0;
+    // Drain both queues so the pool can be reused by the next open
+    std::uint32_t index;
+    while (_filled.pop(index));
+    while (_free.pop(index));
+}
+
+const Streamer::Block *Streamer::acquire(void) noexcept
+{
+    std::uint32_t index;
+
+    while (_filled.pop(index)) {
+        const auto &block = _blocks[index];
+        if (block.generation == _consumerGeneration)
+            return &block;
+        // Block read before the last seek
+        release(&block);
+    }
+    return nullptr;
+}
+
+void Streamer::release(const Block * const block) noexcept
+{
+    static_cast<void>(_free.push(static_cast<std::uint32_t>(block - _blocks.data())));
+    wake();
+}
+
+void Streamer::seek(const std::uint64_t offset) noexcept
+{
+    _seekOffset.store(offset & ~static_cast<std::uint64_t>(BlockAlignment - 1), std::memory_order_relaxed);
+    _consumerGeneration = _seekGeneration.fetch_add(1, std::memory_order_release) + 1;
+    wake();
+}
+
+bool Streamer::endOfStream(void) const noexcept
+{
+    return _endGeneration.load(std::memory_order_acquire) == _consumerGeneration && _filled.empty();
+}
+
+void Streamer::wake(void) noexcept
+{
+    _wake.fetch_add(1, std::memory_order_release);
+    _wake.notify_one();
+}
+
+void Streamer::run(void) noexcept
+{
+    constexpr auto NoIndex = ~static_cast<std::uint32_t>(0);
+    std::uint32_t generation = ~static_cast<std::uint32_t>(0);
+    std::uint64_t position = 0;
+    // Block popped but not filled, the I/O thread keeps it instead of pushing it back to '_free' (consumer is its only producer)
+    std::uint32_t spare = NoIndex;
+    bool ended = false;
+
+    while (true) {
+        const auto seen = _wake.load(std::memory_order_acquire);
+        if (_stop.load(std::memory_order_acquire))
+            return;
+        if (const auto seekGeneration = _seekGeneration.load(std::memory_order_acquire); seekGeneration != generation) {
+            generation = seekGeneration;
+            position = _seekOffset.load(std::memory_order_relaxed);
+            ended = false;
+        }
+        if (!ended && position >= _fileSize) {
+            ended = true;
+            _endGeneration.store(generation, std::memory_order_release);
+        }
+        std::uint32_t index = spare;
+        if (ended || (index == NoIndex && !_free.pop(index))) {
+            // Nothing to do until the consumer releases a block, seeks or closes
+            _wake.wait(seen, std::memory_order_acquire);
+            continue;
+        }
+        spare = NoIndex;
+        auto &block = _blocks[index];
+        const auto count = readAt(_buffers[index].data(), _config.blockSize, position);
+        if (count <= 0) {
+            if (count < 0)
+                _failed.store(true, std::memory_order_release);
+            spare = index;
+            ended = true;
+            _endGeneration.store(generation, std::memory_order_release);
+            continue;
+        }
+        block.size = static_cast<std::size_t>(count);
+        block.offset = position;
+        block.generation = generation;
+        position += static_cast<std::uint64_t>(count);
+        static_cast<void>(_filled.push(index));
+    }
+}
+
+std::int64_t Streamer::readAt(std::uint8_t * const data, const std::size_t size, const std::uint64_t offset) noexcept
+{
+    std::size_t total = 0;
+
+    // Loop over short reads until the block is full or the end of the file is reached
+    while (total < size) {
+#if defined(_WIN32)
+        if (::_lseeki64(_fd, static_cast<long long>(offset + total), SEEK_SET) < 0)
+            return -1;
+        const auto count = ::_read(_fd, data + total, static_cast<unsigned>(size - total));
+#else
+        const auto count = ::pread(_fd, data + total, size - total, static_cast<off_t>(offset + total));
+#endif
+        if (count < 0) {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        } else if (!count)
+            break;
+        total += static_cast<std::size_t>(count);
+    }
+    return static_cast<std::int64_t>(total);
+}
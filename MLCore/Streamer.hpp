@@ -0,0 +1,123 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Streamer
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "Allocator.hpp"
+#include "SPSCQueue.hpp"
+
+namespace Core
+{
+    class Streamer;
+}
+
+/** @brief Asynchronous read-ahead file streamer
+ *  A background I/O thread reads the file sequentially in large aligned blocks (pread) into a pool of pre-allocated buffers
+ *  Filled blocks are handed to the consumer through a lock-free queue, the consumer gives them back once processed
+ *  The consumer side (acquire, release, seek) never blocks nor allocates, it can run on the audio thread */
+class Core::Streamer
+{
+public:
+    /** @brief Alignment of blocks in memory and in the file */
+    static constexpr std::size_t BlockAlignment = 4096;
+
+    /** @brief Buffer type of a block */
+    using Buffer = Vector<std::uint8_t, std::size_t, GrowthPolicy::Default, AlignedAllocator<BlockAlignment>>;
+
+    /** @brief Streaming configuration */
+    struct Config
+    {
+        std::size_t blockSize { 1024 * 1024 };  // Size of each read, rounded up to BlockAlignment
+        std::size_t readAhead { 4 };            // Number of blocks read in advance
+    };
+
+    /** @brief A filled block */
+    struct Block
+    {
+        const std::uint8_t *data { nullptr };
+        std::size_t size { 0 };
+        std::uint64_t offset { 0 };
+        std::uint32_t generation { 0 };
+    };
+
+
+    /** @brief Allocate the buffer pool with the default configuration, no file is opened */
+    Streamer(void) noexcept : Streamer(Config {}) {}
+
+    /** @brief Allocate the buffer pool, no file is opened */
+    explicit Streamer(const Config &config) noexcept;
+
+    /** @brief Close the file */
+    ~Streamer(void) noexcept { close(); }
+
+    /** @brief A streamer is neither copyable nor movable */
+    Streamer(const Streamer &other) = delete;
+    Streamer &operator=(const Streamer &other) = delete;
+
+
+    /** @brief Open a file and start reading it from 'offset' (rounded down to BlockAlignment) in the background
+     *  @return False if the file could not be opened */
+    [[nodiscard]] bool open(const char * const path, const std::uint64_t offset = 0) noexcept;
+
+    /** @brief Stop the I/O thread and close the file, blocks that were not released become invalid */
+    void close(void) noexcept;
+
+    /** @brief Check if a file is opened */
+    [[nodiscard]] bool isOpen(void) const noexcept { return _fd >= 0; }
+
+    /** @brief Get the size of the opened file */
+    [[nodiscard]] std::uint64_t fileSize(void) const noexcept { return _fileSize; }
+
+    /** @brief Get the configuration */
+    [[nodiscard]] const Config &config(void) const noexcept { return _config; }
+
+
+    /** @brief Get the next filled block or nullptr if none is ready, never blocks
+     *  Blocks are returned in file order and must be released in the same order */
+    [[nodiscard]] const Block *acquire(void) noexcept;
+
+    /** @brief Give a block back to the I/O thread */
+    void release(const Block * const block) noexcept;
+
+    /** @brief Restart streaming from another offset (rounded down to BlockAlignment), never blocks
+     *  Blocks read before the seek are dropped by acquire, blocks already acquired must still be released */
+    void seek(const std::uint64_t offset) noexcept;
+
+    /** @brief Check if every block until the end of the file was acquired since the last seek */
+    [[nodiscard]] bool endOfStream(void) const noexcept;
+
+    /** @brief Check if a read error occurred */
+    [[nodiscard]] bool failed(void) const noexcept { return _failed.load(std::memory_order_acquire); }
+
+private:
+    Config _config {};
+    Vector<Buffer> _buffers {};
+    Vector<Block> _blocks {};
+    SPSCQueue<std::uint32_t> _filled;
+    SPSCQueue<std::uint32_t> _free;
+    int _fd { -1 };
+    std::uint64_t _fileSize { 0 };
+    std::thread _thread {};
+    std::uint32_t _consumerGeneration { 0 };
+    alignas_cacheline std::atomic<std::uint32_t> _wake { 0 };
+    std::atomic<std::uint64_t> _seekOffset { 0 };
+    std::atomic<std::uint32_t> _seekGeneration { 0 };
+    std::atomic<std::uint32_t> _endGeneration { ~static_cast<std::uint32_t>(0) };
+    std::atomic<bool> _stop { false };
+    std::atomic<bool> _failed { false };
+
+    /** @brief I/O thread entry point */
+    void run(void) noexcept;
+
+    /** @brief Wake the I/O thread */
+    void wake(void) noexcept;
+
+    /** @brief Read up to 'size' bytes at 'offset', returns the number of bytes read or -1 on error */
+    [[nodiscard]] std::int64_t readAt(std::uint8_t * const data, const std::size_t size, const std::uint64_t offset) noexcept;
+};
@@ -0,0 +1,89 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: StringBuilder
+ */
+
+#pragma once
+
+#include <charconv>
+#include <functional>
+
+#include "FlatString.hpp"
+#include "Vector.hpp"
+
+namespace Core
+{
+    template<std::size_t InlineCapacity>
+    class StringBuilderBase;
+
+    using StringBuilder = StringBuilderBase<CacheLineSize * 4>;
+}
+
+/** @brief Builds a string into an inline buffer and only allocates once the result is finished
+ *  If the inline buffer is too small the builder spills into a heap buffer
+ *  Numbers are formatted with std::to_chars, without locale nor allocation */
+template<std::size_t InlineCapacity>
+class Core::StringBuilderBase
+{
+public:
+    /** @brief Default constructor */
+    StringBuilderBase(void) noexcept = default;
+
+    /** @brief The builder may point to its inline buffer, it is neither copyable nor movable */
+    StringBuilderBase(const StringBuilderBase &other) = delete;
+    StringBuilderBase &operator=(const StringBuilderBase &other) = delete;
+
+
+    /** @brief Append a string */
+    StringBuilderBase &append(const std::string_view &value) noexcept;
+    StringBuilderBase &append(const FlatString &value) noexcept { return append(value.toStdString()); }
+    StringBuilderBase &append(const char * const cstring) noexcept { return append(cstring ? std::string_view(cstring) : std::string_view()); }
+
+    /** @brief Append a single character */
+    StringBuilderBase &append(const char character) noexcept;
+
+    /** @brief Append an integer (bool is not a number, append a string instead) */
+    template<typename Integer>
+    std::enable_if_t<std::is_integral_v<Integer> && !std::is_same_v<Integer, bool>, StringBuilderBase &> appendNumber(const Integer value) noexcept;
+
+    /** @brief Append a floating point number
+     *  If precision is negative the shortest representation that round-trips is used, else a fixed notation */
+    template<typename Floating>
+    std::enable_if_t<std::is_floating_point_v<Floating>, StringBuilderBase &> appendNumber(const Floating value, const int precision = -1) noexcept;
+
+
+    /** @brief Append operators */
+    StringBuilderBase &operator+=(const std::string_view &value) noexcept { return append(value); }
+    StringBuilderBase &operator+=(const FlatString &value) noexcept { return append(value); }
+    StringBuilderBase &operator+=(const char * const cstring) noexcept { return append(cstring); }
+    StringBuilderBase &operator+=(const char character) noexcept { return append(character); }
+
+
+    /** @brief Get the current content */
+    [[nodiscard]] std::string_view view(void) const noexcept { return std::string_view(_data, _size); }
+
+    /** @brief Get the current size */
+    [[nodiscard]] std::size_t size(void) const noexcept { return _size; }
+
+    /** @brief Fast empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return !_size; }
+
+    /** @brief Clear the content, the heap buffer is kept if any */
+    void clear(void) noexcept { _size = 0; }
+
+
+    /** @brief Create a FlatString of the exact content size (single allocation) */
+    [[nodiscard]] FlatString finish(void) const noexcept { return FlatString(_data, _size); }
+
+private:
+    char *_data { _inline };
+    std::size_t _size { 0 };
+    std::size_t _capacity { InlineCapacity };
+    Vector<char> _heap {};
+    char _inline[InlineCapacity];
+
+    /** @brief Reserve space for 'count' more characters and return a pointer to the end of the content */
+    [[nodiscard]] char *reserveAppend(const std::size_t count) noexcept;
+};
+
+#include "StringBuilder.ipp"
@@ -0,0 +1,80 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: StringBuilder
+ */
+
+template<std::size_t InlineCapacity>
+inline char *Core::StringBuilderBase<InlineCapacity>::reserveAppend(const std::size_t count) noexcept
+{
+    if (const auto total = _size + count; total > _capacity) {
+        const auto capacity = std::max(total, _capacity * 2);
+        if (_data == _inline) {
+            _heap.resizeUninitialized(capacity);
+            std::memcpy(_heap.data(), _inline, _size);
+        } else
+            _heap.resizeUninitialized(capacity);
+        _data = _heap.data();
+        _capacity = capacity;
+    }
+    return _data + _size;
+}
+
+template<std::size_t InlineCapacity>
+inline Core::StringBuilderBase<InlineCapacity> &Core::StringBuilderBase<InlineCapacity>::append(const std::string_view &value) noexcept
+{
+    if (value.empty())
+        return *this;
+    // The view may point into the builder itself, it must be relocated if the buffer moves or grows
+    const char *source = value.data();
+    if (!std::less<const char *>()(source, _data) && std::less<const char *>()(source, _data + _size)) {
+        const auto offset = reinterpret_cast<std::uintptr_t>(source) - reinterpret_cast<std::uintptr_t>(_data);
+        const auto destination = reserveAppend(value.size());
+        std::memcpy(destination, _data + offset, value.size());
+    } else
+        std::memcpy(reserveAppend(value.size()), source, value.size());
+    _size += value.size();
+    return *this;
+}
+
+template<std::size_t InlineCapacity>
+inline Core::StringBuilderBase<InlineCapacity> &Core::StringBuilderBase<InlineCapacity>::append(const char character) noexcept
+{
+    *reserveAppend(1) = character;
+    ++_size;
+    return *this;
+}
+
+template<std::size_t InlineCapacity>
+template<typename Integer>
+inline std::enable_if_t<std::is_integral_v<Integer> && !std::is_same_v<Integer, bool>, Core::StringBuilderBase<InlineCapacity> &>
+    Core::StringBuilderBase<InlineCapacity>::appendNumber(const Integer value) noexcept
+{
+    // Sign + 64 bits decimal digits
+    constexpr std::size_t MaxDigits = 21;
+    const auto begin = reserveAppend(MaxDigits);
+    const auto result = std::to_chars(begin, begin + MaxDigits, value);
+
+    _size += static_cast<std::size_t>(result.ptr - begin);
+    return *this;
+}
+
+template<std::size_t InlineCapacity>
+template<typename Floating>
+inline std::enable_if_t<std::is_floating_point_v<Floating>, Core::StringBuilderBase<InlineCapacity> &>
+    Core::StringBuilderBase<InlineCapacity>::appendNumber(const Floating value, const int precision) noexcept
+{
+    // Enough for the shortest representation of any double, grows if a fixed notation needs more
+    std::size_t maxDigits = 32;
+
+    while (true) {
+        const auto begin = reserveAppend(maxDigits);
+        const auto result = precision < 0
+            ? std::to_chars(begin, begin + maxDigits, value)
+            : std::to_chars(begin, begin + maxDigits, value, std::chars_format::fixed, precision);
+        if (result.ec == std::errc()) {
+            _size += static_cast<std::size_t>(result.ptr - begin);
+            return *this;
+        }
+        maxDigits *= 4;
+    }
+}
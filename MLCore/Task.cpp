@@ -0,0 +1,98 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Task
+ */
+
+#include <new>
+
+#include "Task.hpp"
+
+using namespace Core;
+
+namespace
+{
+    /** @brief Per-thread cache of released frames */
+    struct FrameCache
+    {
+        struct FreeFrame
+        {
+            FreeFrame *next;
+        };
+
+        FreeFrame *heads[Internal::TaskFrameAllocator::ClassCount] {};
+        std::size_t counts[Internal::TaskFrameAllocator::ClassCount] {};
+
+        ~FrameCache(void) noexcept;
+    };
+
+    /** @brief Set once the cache of the thread is destroyed, later frames use the heap */
+    thread_local bool CacheDestroyed = false;
+
+    thread_local FrameCache Cache;
+
+    FrameCache::~FrameCache(void) noexcept
+    {
+        CacheDestroyed = true;
+        for (auto head : heads) {
+            while (head)
+                std::free(std::exchange(head, head->next));
+        }
+    }
+
+    [[nodiscard]] void *HeapAllocate(const std::size_t bytes)
+    {
+        if (const auto data = std::malloc(bytes); data)
+            return data;
+        throw std::bad_alloc();
+    }
+}
+
+void *Internal::TaskFrameAllocator::Allocate(const std::size_t bytes)
+{
+    const auto index = (std::max<std::size_t>(bytes, 1) - 1) / ClassSize;
+
+    if (index >= ClassCount)
+        return HeapAllocate(bytes);
+    // Pooled frames are allocated at their class size so that any frame of the class can reuse them
+    if (CacheDestroyed)
+        return HeapAllocate((index + 1) * ClassSize);
+    auto &cache = Cache;
+    if (const auto frame = cache.heads[index]; frame) {
+        cache.heads[index] = frame->next;
+        --cache.counts[index];
+        return frame;
+    }
+    return HeapAllocate((index + 1) * ClassSize);
+}
+
+void Internal::TaskFrameAllocator::Deallocate(void * const data, const std::size_t bytes) noexcept
+{
+    const auto index = (std::max<std::size_t>(bytes, 1) - 1) / ClassSize;
+
+    if (index >= ClassCount || CacheDestroyed) {
+        std::free(data);
+        return;
+    }
+    auto &cache = Cache;
+    if (cache.counts[index] == MaxCachedFrames) {
+        std::free(data);
+        return;
+    }
+    const auto frame = reinterpret_cast<FrameCache::FreeFrame *>(data);
+    frame->next = cache.heads[index];
+    cache.heads[index] = frame;
+    ++cache.counts[index];
+}
+
+Task<void> Core::WhenAll(Vector<Task<void>> tasks)
+{
+    Internal::WhenAllLatch latch(tasks.size());
+    Vector<Internal::WhenAllTask> waiters;
+
+    waiters.reserve(tasks.size());
+    for (auto &task : tasks)
+        waiters.push(Internal::MakeWhenAllTask(task));
+    co_await Internal::WhenAllAwaiter<decltype(waiters)> { latch, waiters };
+    for (auto &task : tasks)
+        task.result();
+}
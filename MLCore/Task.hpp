@@ -0,0 +1,230 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Task
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include <variant>
+
+#include "Executor.hpp"
+
+namespace Core
+{
+    template<typename Type = void>
+    class Task;
+
+    namespace Internal
+    {
+        struct TaskFrameAllocator;
+
+        class TaskPromiseBase;
+
+        template<typename Type>
+        class TaskPromise;
+
+        /** @brief Value produced by awaiting a task of WhenAll (void results become std::monostate) */
+        template<typename Type>
+        using WhenAllValue = std::conditional_t<std::is_void_v<Type>, std::monostate, Type>;
+    }
+
+    /** @brief Block the calling thread until a task completes and return its result */
+    template<typename Type>
+    Type SyncWait(Task<Type> &&task);
+
+    /** @brief Run tasks concurrently and complete once all of them completed
+     *  Tasks only run in parallel if they move themselves onto an executor (co_await executor.schedule()) */
+    template<typename ...Types>
+    [[nodiscard]] Task<std::tuple<Internal::WhenAllValue<Types>...>> WhenAll(Task<Types> ...tasks);
+
+    /** @brief Run a dynamic set of tasks concurrently and complete with their results in order */
+    template<typename Type> requires (!std::is_void_v<Type>)
+    [[nodiscard]] Task<Vector<Type>> WhenAll(Vector<Task<Type>> tasks);
+
+    /** @brief Run a dynamic set of void tasks concurrently */
+    [[nodiscard]] Task<void> WhenAll(Vector<Task<void>> tasks);
+}
+
+/** @brief Size-class pool of coroutine frames
+ *  Each thread caches released frames per size class, frames released by another thread join that thread's cache
+ *  Frames larger than the last class directly use the heap */
+struct Core::Internal::TaskFrameAllocator
+{
+    /** @brief Granularity of size classes */
+    static constexpr std::size_t ClassSize = 64;
+
+    /** @brief Number of size classes (largest pooled frame is ClassSize * ClassCount bytes) */
+    static constexpr std::size_t ClassCount = 16;
+
+    /** @brief Maximum number of frames cached per size class and per thread */
+    static constexpr std::size_t MaxCachedFrames = 256;
+
+    /** @brief Allocate a frame, throws std::bad_alloc on failure */
+    [[nodiscard]] static void *Allocate(const std::size_t bytes);
+
+    /** @brief Release a frame, 'bytes' must be the size given to Allocate */
+    static void Deallocate(void * const data, const std::size_t bytes) noexcept;
+};
+
+/** @brief Promise data independent of the result type */
+class Core::Internal::TaskPromiseBase
+{
+public:
+    /** @brief Transfer execution to the awaiting coroutine once the task completes */
+    struct FinalAwaiter
+    {
+        [[nodiscard]] bool await_ready(void) const noexcept { return false; }
+
+        template<typename Promise>
+        [[nodiscard]] std::coroutine_handle<> await_suspend(const std::coroutine_handle<Promise> handle) const noexcept
+        {
+            const auto continuation = handle.promise()._continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        void await_resume(void) const noexcept {}
+    };
+
+
+    /** @brief Frames come from the pooled frame allocator */
+    [[nodiscard]] static void *operator new(const std::size_t bytes) { return TaskFrameAllocator::Allocate(bytes); }
+    static void operator delete(void * const data, const std::size_t bytes) noexcept { TaskFrameAllocator::Deallocate(data, bytes); }
+
+
+    /** @brief Tasks are lazy, they start when awaited */
+    [[nodiscard]] std::suspend_always initial_suspend(void) const noexcept { return {}; }
+    [[nodiscard]] FinalAwaiter final_suspend(void) const noexcept { return {}; }
+
+    /** @brief Store an escaping exception, rethrown to the awaiting coroutine */
+    void unhandled_exception(void) noexcept { _exception = std::current_exception(); }
+
+    /** @brief Set the coroutine resumed once the task completes */
+    void setContinuation(const std::coroutine_handle<> continuation) noexcept { _continuation = continuation; }
+
+protected:
+    std::coroutine_handle<> _continuation {};
+    std::exception_ptr _exception {};
+
+    /** @brief Rethrow the stored exception if any */
+    void rethrow(void) const { if (_exception) std::rethrow_exception(_exception); }
+};
+
+/** @brief Promise of a task returning a value */
+template<typename Type>
+class Core::Internal::TaskPromise : public TaskPromiseBase
+{
+public:
+    [[nodiscard]] Task<Type> get_return_object(void) noexcept
+        { return Task<Type>(std::coroutine_handle<TaskPromise>::from_promise(*this)); }
+
+    template<typename Value>
+    void return_value(Value &&value) noexcept_forward_constructible(Type)
+        { _value.emplace(std::forward<Value>(value)); }
+
+    /** @brief Take the result, rethrows the exception of the task if any */
+    [[nodiscard]] Type result(void) { rethrow(); return std::move(*_value); }
+
+private:
+    std::optional<Type> _value {};
+};
+
+/** @brief Promise of a task returning nothing */
+template<>
+class Core::Internal::TaskPromise<void> : public TaskPromiseBase
+{
+public:
+    [[nodiscard]] Task<void> get_return_object(void) noexcept;
+
+    void return_void(void) const noexcept {}
+
+    /** @brief Rethrow the exception of the task if any */
+    void result(void) { rethrow(); }
+};
+
+/** @brief Lazy coroutine producing a value of type 'Type'
+ *  The task starts when awaited and resumes its awaiting coroutine with symmetric transfer when complete
+ *  Frames are allocated from the pooled frame allocator, exceptions propagate to the awaiting coroutine */
+template<typename Type>
+class [[nodiscard]] Core::Task
+{
+public:
+    /** @brief Coroutine types */
+    using promise_type = Internal::TaskPromise<Type>;
+    using Handle = std::coroutine_handle<promise_type>;
+
+
+    /** @brief Construct an empty task */
+    Task(void) noexcept = default;
+
+    /** @brief Construct a task owning a coroutine */
+    explicit Task(const Handle handle) noexcept : _handle(handle) {}
+
+    /** @brief Move constructor */
+    Task(Task &&other) noexcept : _handle(std::exchange(other._handle, Handle())) {}
+
+    /** @brief Destroy the coroutine */
+    ~Task(void) noexcept { if (_handle) _handle.destroy(); }
+
+    /** @brief Move assignment */
+    Task &operator=(Task &&other) noexcept { swap(other); return *this; }
+
+    /** @brief Swap two instances */
+    void swap(Task &other) noexcept { std::swap(_handle, other._handle); }
+
+
+    /** @brief Check if the task owns a coroutine */
+    [[nodiscard]] bool valid(void) const noexcept { return static_cast<bool>(_handle); }
+
+    /** @brief Check if the task completed */
+    [[nodiscard]] bool done(void) const noexcept { return _handle && _handle.done(); }
+
+
+    /** @brief Start the task and get its result once complete */
+    [[nodiscard]] auto operator co_await(void) noexcept_ndebug
+    {
+        struct Awaiter : Completion
+        {
+            [[nodiscard]] Type await_resume(void) { return this->handle.promise().result(); }
+        };
+        return Awaiter { completion() };
+    }
+
+    /** @brief Start the task and wait for its completion without taking the result */
+    [[nodiscard]] auto completion(void) noexcept_ndebug
+    {
+        coreAssert(_handle,
+            coreDebugThrow(std::logic_error("Core::Task::completion: Awaiting an empty task")));
+        return Completion { _handle };
+    }
+
+    /** @brief Take the result of a completed task, rethrows its exception if any */
+    [[nodiscard]] Type result(void) { return _handle.promise().result(); }
+
+private:
+    /** @brief Awaiter starting the task */
+    struct Completion
+    {
+        Handle handle {};
+
+        [[nodiscard]] bool await_ready(void) const noexcept { return handle.done(); }
+
+        [[nodiscard]] std::coroutine_handle<> await_suspend(const std::coroutine_handle<> awaiting) const noexcept
+        {
+            handle.promise().setContinuation(awaiting);
+            return handle;
+        }
+
+        void await_resume(void) const noexcept {}
+    };
+
+    Handle _handle {};
+};
+
+#include "Task.ipp"
@@ -0,0 +1,219 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Task
+ */
+
+inline Core::Task<void> Core::Internal::TaskPromise<void>::get_return_object(void) noexcept
+{
+    return Task<void>(std::coroutine_handle<TaskPromise>::from_promise(*this));
+}
+
+namespace Core::Internal
+{
+    /** @brief Signal raised by a SyncWait coroutine once its task completed */
+    struct SyncWaitSignal
+    {
+        std::mutex mutex {};
+        std::condition_variable condition {};
+        bool done { false };
+    };
+
+    /** @brief Eager coroutine awaiting a task then raising a signal */
+    class SyncWaitTask
+    {
+    public:
+        struct promise_type
+        {
+            SyncWaitSignal *signal {};
+
+            [[nodiscard]] SyncWaitTask get_return_object(void) noexcept
+                { return SyncWaitTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            [[nodiscard]] std::suspend_always initial_suspend(void) const noexcept { return {}; }
+            [[nodiscard]] auto final_suspend(void) const noexcept
+            {
+                struct Awaiter
+                {
+                    [[nodiscard]] bool await_ready(void) const noexcept { return false; }
+                    void await_suspend(const std::coroutine_handle<promise_type> handle) const noexcept
+                    {
+                        // The frame may be destroyed as soon as the signal is raised
+                        const auto signal = handle.promise().signal;
+                        std::lock_guard lock(signal->mutex);
+                        signal->done = true;
+                        signal->condition.notify_one();
+                    }
+                    void await_resume(void) const noexcept {}
+                };
+                return Awaiter {};
+            }
+            void return_void(void) const noexcept {}
+            void unhandled_exception(void) const noexcept {}
+        };
+
+        explicit SyncWaitTask(const std::coroutine_handle<promise_type> handle) noexcept : _handle(handle) {}
+        SyncWaitTask(const SyncWaitTask &other) = delete;
+        ~SyncWaitTask(void) noexcept { _handle.destroy(); }
+
+        /** @brief Start the coroutine and block until it raised the signal */
+        void run(void) noexcept
+        {
+            SyncWaitSignal signal;
+            _handle.promise().signal = &signal;
+            _handle.resume();
+            std::unique_lock lock(signal.mutex);
+            signal.condition.wait(lock, [&signal] { return signal.done; });
+        }
+
+    private:
+        std::coroutine_handle<promise_type> _handle {};
+    };
+
+    /** @brief Await the completion of a task (its result stays in the task) */
+    template<typename Type>
+    [[nodiscard]] SyncWaitTask MakeSyncWaitTask(Task<Type> &task)
+        { co_await task.completion(); }
+
+
+    /** @brief Counter of WhenAll, the last completing task resumes the awaiting coroutine */
+    class WhenAllLatch
+    {
+    public:
+        /** @brief Construct a latch of 'count' tasks, plus one reference held by the awaiting coroutine */
+        explicit WhenAllLatch(const std::size_t count) noexcept : _count(count + 1) {}
+
+        /** @brief Register the awaiting coroutine, returns false if every task already completed */
+        [[nodiscard]] bool tryAwait(const std::coroutine_handle<> continuation) noexcept
+        {
+            _continuation = continuation;
+            return _count.fetch_sub(1, std::memory_order_acq_rel) > 1;
+        }
+
+        /** @brief Notify that a task completed, returns the coroutine to resume */
+        [[nodiscard]] std::coroutine_handle<> notify(void) noexcept
+        {
+            if (_count.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                return _continuation;
+            return std::noop_coroutine();
+        }
+
+    private:
+        std::atomic<std::size_t> _count;
+        std::coroutine_handle<> _continuation {};
+    };
+
+    /** @brief Coroutine awaiting one task of WhenAll then notifying the latch */
+    class WhenAllTask
+    {
+    public:
+        struct promise_type
+        {
+            WhenAllLatch *latch {};
+
+            [[nodiscard]] static void *operator new(const std::size_t bytes) { return TaskFrameAllocator::Allocate(bytes); }
+            static void operator delete(void * const data, const std::size_t bytes) noexcept { TaskFrameAllocator::Deallocate(data, bytes); }
+
+            [[nodiscard]] WhenAllTask get_return_object(void) noexcept
+                { return WhenAllTask(std::coroutine_handle<promise_type>::from_promise(*this)); }
+            [[nodiscard]] std::suspend_always initial_suspend(void) const noexcept { return {}; }
+            [[nodiscard]] auto final_suspend(void) const noexcept
+            {
+                struct Awaiter
+                {
+                    [[nodiscard]] bool await_ready(void) const noexcept { return false; }
+                    [[nodiscard]] std::coroutine_handle<> await_suspend(const std::coroutine_handle<promise_type> handle) const noexcept
+                        { return handle.promise().latch->notify(); }
+                    void await_resume(void) const noexcept {}
+                };
+                return Awaiter {};
+            }
+            void return_void(void) const noexcept {}
+            void unhandled_exception(void) const noexcept {}
+        };
+
+        explicit WhenAllTask(const std::coroutine_handle<promise_type> handle) noexcept : _handle(handle) {}
+        WhenAllTask(WhenAllTask &&other) noexcept : _handle(std::exchange(other._handle, {})) {}
+        ~WhenAllTask(void) noexcept { if (_handle) _handle.destroy(); }
+        WhenAllTask &operator=(WhenAllTask &&other) noexcept { std::swap(_handle, other._handle); return *this; }
+
+        /** @brief Start the coroutine */
+        void start(WhenAllLatch &latch) noexcept
+        {
+            _handle.promise().latch = &latch;
+            _handle.resume();
+        }
+
+    private:
+        std::coroutine_handle<promise_type> _handle {};
+    };
+
+    /** @brief Await the completion of a task of WhenAll */
+    template<typename Type>
+    [[nodiscard]] WhenAllTask MakeWhenAllTask(Task<Type> &task)
+        { co_await task.completion(); }
+
+    /** @brief Awaiter starting every task of WhenAll and suspending until the last one completes */
+    template<typename Range>
+    struct WhenAllAwaiter
+    {
+        WhenAllLatch &latch;
+        Range &tasks;
+
+        [[nodiscard]] bool await_ready(void) const noexcept { return false; }
+
+        [[nodiscard]] bool await_suspend(const std::coroutine_handle<> awaiting) const noexcept
+        {
+            for (auto &task : tasks)
+                task.start(latch);
+            return latch.tryAwait(awaiting);
+        }
+
+        void await_resume(void) const noexcept {}
+    };
+
+    /** @brief Take the result of a completed task */
+    template<typename Type>
+    [[nodiscard]] WhenAllValue<Type> TakeResult(Task<Type> &task)
+    {
+        if constexpr (std::is_void_v<Type>) {
+            task.result();
+            return std::monostate {};
+        } else
+            return task.result();
+    }
+}
+
+template<typename Type>
+inline Type Core::SyncWait(Task<Type> &&task)
+{
+    Task<Type> owned(std::move(task));
+
+    Internal::MakeSyncWaitTask(owned).run();
+    return owned.result();
+}
+
+template<typename ...Types>
+inline Core::Task<std::tuple<Core::Internal::WhenAllValue<Types>...>> Core::WhenAll(Task<Types> ...tasks)
+{
+    Internal::WhenAllLatch latch(sizeof...(Types));
+    Internal::WhenAllTask waiters[] { Internal::MakeWhenAllTask(tasks)... };
+
+    co_await Internal::WhenAllAwaiter<decltype(waiters)> { latch, waiters };
+    co_return std::tuple<Internal::WhenAllValue<Types>...>(Internal::TakeResult(tasks)...);
+}
+
+template<typename Type> requires (!std::is_void_v<Type>)
+inline Core::Task<Core::Vector<Type>> Core::WhenAll(Vector<Task<Type>> tasks)
+{
+    Internal::WhenAllLatch latch(tasks.size());
+    Vector<Internal::WhenAllTask> waiters;
+
+    waiters.reserve(tasks.size());
+    for (auto &task : tasks)
+        waiters.push(Internal::MakeWhenAllTask(task));
+    co_await Internal::WhenAllAwaiter<decltype(waiters)> { latch, waiters };
+    Vector<Type> results;
+    results.reserve(tasks.size());
+    for (auto &task : tasks)
+        results.push(task.result());
+    co_return results;
+}
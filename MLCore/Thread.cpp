@@ -0,0 +1,327 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Thread
+ */
+
+#include <algorithm>
+#include <charconv>
+#include <fstream>
+
+#ifdef __linux__
+# include <pthread.h>
+# include <sched.h>
+#endif
+
+#include "Thread.hpp"
+
+using namespace Core;
+
+namespace
+{
+    /** @brief Maximum thread name length on Linux (without the null terminator) */
+    constexpr std::size_t MaxNameLength = 15;
+
+    /** @brief Read the first line of a file, empty if it can't be read */
+    std::string ReadLine(const std::string &path) noexcept
+    {
+        std::ifstream file(path);
+        std::string line;
+
+        if (file)
+            std::getline(file, line);
+        return line;
+    }
+
+    /** @brief Parse an unsigned number at the beginning of a string, returns false on failure */
+    template<typename Type>
+    bool ParseNumber(const std::string_view text, Type &value) noexcept
+    {
+        return std::from_chars(text.data(), text.data() + text.size(), value).ec == std::errc();
+    }
+
+    /** @brief Parse a cache size ('32K', '8M') */
+    std::size_t ParseCacheSize(const std::string_view text) noexcept
+    {
+        std::size_t size = 0;
+        const auto result = std::from_chars(text.data(), text.data() + text.size(), size);
+
+        if (result.ec != std::errc())
+            return 0;
+        if (result.ptr != text.data() + text.size()) {
+            if (*result.ptr == 'K')
+                size *= 1024;
+            else if (*result.ptr == 'M')
+                size *= 1024 * 1024;
+            else if (*result.ptr == 'G')
+                size *= 1024 * 1024 * 1024;
+        }
+        return size;
+    }
+}
+
+CpuSet CpuSet::Parse(const std::string_view list) noexcept
+{
+    CpuSet set;
+    std::size_t begin = 0;
+
+    while (begin < list.size()) {
+        auto end = list.find(',', begin);
+        if (end == std::string_view::npos)
+            end = list.size();
+        const auto part = list.substr(begin, end - begin);
+        const auto dash = part.find('-');
+        std::size_t first = 0;
+        std::size_t last = 0;
+        if (dash == std::string_view::npos) {
+            if (ParseNumber(part, first))
+                set.set(first);
+        } else if (ParseNumber(part.substr(0, dash), first) && ParseNumber(part.substr(dash + 1), last)) {
+            for (auto cpu = first; cpu <= last && cpu < MaxCpuCount; ++cpu)
+                set.set(cpu);
+        }
+        begin = end + 1;
+    }
+    return set;
+}
+
+std::size_t CpuSet::next(const std::size_t from) const noexcept
+{
+    for (auto cpu = from; cpu < MaxCpuCount; ++cpu) {
+        if (_bits.test(cpu))
+            return cpu;
+    }
+    return NotFound;
+}
+
+std::string CpuSet::toString(void) const noexcept
+{
+    std::string out;
+
+    for (auto first = next(); first != NotFound;) {
+        auto last = first;
+        while (last + 1 < MaxCpuCount && _bits.test(last + 1))
+            ++last;
+        if (!out.empty())
+            out.push_back(',');
+        out.append(std::to_string(first));
+        if (last != first) {
+            out.push_back('-');
+            out.append(std::to_string(last));
+        }
+        first = last + 1 < MaxCpuCount ? next(last + 1) : NotFound;
+    }
+    return out;
+}
+
+const CpuTopology &CpuTopology::Get(void) noexcept
+{
+    static const CpuTopology Topology = Load();
+
+    return Topology;
+}
+
+CpuTopology CpuTopology::Load(const std::string_view root) noexcept
+{
+    const std::string directory(root);
+    CpuTopology topology;
+
+    topology._online = CpuSet::Parse(ReadLine(directory + "/online"));
+    if (topology._online.empty()) {
+        // No sysfs, every CPU is its own core
+        const auto count = std::max(std::thread::hardware_concurrency(), 1u);
+        for (auto cpu = 0u; cpu < count; ++cpu)
+            topology._online.set(cpu);
+    }
+    for (auto id = topology._online.next(); id != CpuSet::NotFound; id = topology._online.next(id + 1)) {
+        const auto cpuDirectory = directory + "/cpu" + std::to_string(id);
+        Cpu cpu { static_cast<std::uint32_t>(id), static_cast<std::uint32_t>(id), 0 };
+        ParseNumber(ReadLine(cpuDirectory + "/topology/core_id"), cpu.core);
+        ParseNumber(ReadLine(cpuDirectory + "/topology/physical_package_id"), cpu.package);
+        topology._cpus.push(cpu);
+
+        for (auto index = 0u;; ++index) {
+            const auto cacheDirectory = cpuDirectory + "/cache/index" + std::to_string(index);
+            Cache cache;
+            if (!ParseNumber(ReadLine(cacheDirectory + "/level"), cache.level))
+                break;
+            if (ReadLine(cacheDirectory + "/type") == "Instruction")
+                continue;
+            cache.size = ParseCacheSize(ReadLine(cacheDirectory + "/size"));
+            cache.cpus = CpuSet::Parse(ReadLine(cacheDirectory + "/shared_cpu_list"));
+            if (cache.cpus.empty())
+                cache.cpus.set(id);
+            const auto exists = std::any_of(topology._caches.begin(), topology._caches.end(), [&cache](const Cache &other) {
+                return other.level == cache.level && other.cpus == cache.cpus;
+            });
+            if (!exists)
+                topology._caches.push(cache);
+        }
+    }
+    std::stable_sort(topology._caches.begin(), topology._caches.end(), [](const Cache &lhs, const Cache &rhs) {
+        return lhs.level < rhs.level;
+    });
+    return topology;
+}
+
+std::size_t CpuTopology::coreCount(void) const noexcept
+{
+    CpuSet counted;
+    std::size_t count = 0;
+
+    for (const auto &cpu : _cpus) {
+        if (!counted.test(cpu.id)) {
+            counted |= coreSiblings(cpu.id);
+            ++count;
+        }
+    }
+    return count;
+}
+
+CpuSet CpuTopology::coreSiblings(const std::size_t cpu) const noexcept
+{
+    const auto it = std::find_if(_cpus.begin(), _cpus.end(), [cpu](const Cpu &other) { return other.id == cpu; });
+    CpuSet siblings;
+
+    if (it == _cpus.end())
+        return siblings;
+    for (const auto &other : _cpus) {
+        if (other.core == it->core && other.package == it->package)
+            siblings.set(other.id);
+    }
+    return siblings;
+}
+
+CpuSet CpuTopology::sharingCache(const std::size_t cpu, const std::uint32_t level) const noexcept
+{
+    for (const auto &cache : _caches) {
+        if (cache.level == level && cache.cpus.test(cpu))
+            return cache.cpus;
+    }
+    return CpuSet::Single(cpu);
+}
+
+Vector<CpuSet> CpuTopology::cacheGroups(const std::uint32_t level) const noexcept
+{
+    Vector<CpuSet> groups;
+
+    for (const auto &cache : _caches) {
+        if (cache.level == level)
+            groups.push(cache.cpus & _online);
+    }
+    if (groups.empty())
+        groups.push(_online);
+    return groups;
+}
+
+Thread::Status Thread::ApplyCurrent(const Options &options) noexcept
+{
+    Status status;
+
+    if (!options.name.empty())
+        status.named = SetCurrentName(options.name);
+    if (!options.affinity.empty())
+        status.pinned = SetCurrentAffinity(options.affinity);
+    status.policy = options.policy != SchedulingPolicy::Default
+        ? SetCurrentScheduling(options.policy, options.priority) : CurrentScheduling();
+    return status;
+}
+
+bool Thread::SetCurrentName(const std::string_view name) noexcept
+{
+#ifdef __linux__
+    char buffer[MaxNameLength + 1] {};
+    name.copy(buffer, MaxNameLength);
+    return !::pthread_setname_np(::pthread_self(), buffer);
+#else
+    static_cast<void>(name);
+    return false;
+#endif
+}
+
+std::string Thread::CurrentName(void) noexcept
+{
+#ifdef __linux__
+    char buffer[MaxNameLength + 1] {};
+    if (::pthread_getname_np(::pthread_self(), buffer, sizeof(buffer)))
+        return std::string();
+    return std::string(buffer);
+#else
+    return std::string();
+#endif
+}
+
+bool Thread::SetCurrentAffinity(const CpuSet &cpus) noexcept
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto cpu = cpus.next(); cpu != CpuSet::NotFound && cpu < CPU_SETSIZE; cpu = cpus.next(cpu + 1))
+        CPU_SET(cpu, &set);
+    return !::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+#else
+    static_cast<void>(cpus);
+    return false;
+#endif
+}
+
+CpuSet Thread::CurrentAffinity(void) noexcept
+{
+    CpuSet cpus;
+
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (!::pthread_getaffinity_np(::pthread_self(), sizeof(set), &set)) {
+        for (auto cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set))
+                cpus.set(static_cast<std::size_t>(cpu));
+        }
+        return cpus;
+    }
+#endif
+    return CpuTopology::Get().online();
+}
+
+SchedulingPolicy Thread::SetCurrentScheduling(const SchedulingPolicy policy, const int priority) noexcept
+{
+#ifdef __linux__
+    const auto nativePolicy = policy == SchedulingPolicy::Fifo ? SCHED_FIFO : policy == SchedulingPolicy::RoundRobin ? SCHED_RR : SCHED_OTHER;
+    const auto minimum = ::sched_get_priority_min(nativePolicy);
+    const auto maximum = ::sched_get_priority_max(nativePolicy);
+    sched_param param {};
+
+    param.sched_priority = priority ? std::clamp(priority, minimum, maximum) : (minimum + maximum) / 2;
+    if (!::pthread_setschedparam(::pthread_self(), nativePolicy, &param))
+        return policy;
+    // Not allowed (no CAP_SYS_NICE nor RLIMIT_RTPRIO), the thread keeps its current policy
+    return CurrentScheduling();
+#else
+    static_cast<void>(policy);
+    static_cast<void>(priority);
+    return CurrentScheduling();
+#endif
+}
+
+SchedulingPolicy Thread::CurrentScheduling(void) noexcept
+{
+#ifdef __linux__
+    int policy = SCHED_OTHER;
+    sched_param param {};
+    if (!::pthread_getschedparam(::pthread_self(), &policy, &param)) {
+        if (policy == SCHED_FIFO)
+            return SchedulingPolicy::Fifo;
+        else if (policy == SCHED_RR)
+            return SchedulingPolicy::RoundRobin;
+    }
+#endif
+    return SchedulingPolicy::Default;
+}
+
+int Thread::CurrentCpu(void) noexcept
+{
+#ifdef __linux__
+    return ::sched_getcpu();
+#else
+    return -1;
+#endif
+}
@@ -0,0 +1,239 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Thread
+ */
+
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+
+#include "Vector.hpp"
+
+namespace Core
+{
+    class CpuSet;
+    class CpuTopology;
+    class Thread;
+
+    /** @brief Scheduling policies, real-time policies fall back to Default when the process is not allowed to use them */
+    enum class SchedulingPolicy : std::uint8_t
+    {
+        Default,
+        Fifo,
+        RoundRobin
+    };
+}
+
+/** @brief Fixed-size set of logical CPUs, an empty set means 'no restriction' when used as an affinity */
+class Core::CpuSet
+{
+public:
+    /** @brief Maximum number of CPUs (same as the kernel default CPU_SETSIZE) */
+    static constexpr std::size_t MaxCpuCount = 1024;
+
+    /** @brief Index returned by 'next' when there is no CPU left */
+    static constexpr std::size_t NotFound = MaxCpuCount;
+
+
+    /** @brief Default constructor, the set is empty */
+    CpuSet(void) noexcept = default;
+
+    /** @brief Construct a set containing a single CPU */
+    [[nodiscard]] static CpuSet Single(const std::size_t cpu) noexcept { CpuSet set; set.set(cpu); return set; }
+
+    /** @brief Parse a kernel CPU list ('0-3,8,10-11'), invalid parts are ignored */
+    [[nodiscard]] static CpuSet Parse(const std::string_view list) noexcept;
+
+
+    /** @brief Add / remove / test a CPU */
+    void set(const std::size_t cpu) noexcept { if (cpu < MaxCpuCount) _bits.set(cpu); }
+    void reset(const std::size_t cpu) noexcept { if (cpu < MaxCpuCount) _bits.reset(cpu); }
+    [[nodiscard]] bool test(const std::size_t cpu) const noexcept { return cpu < MaxCpuCount && _bits.test(cpu); }
+
+    /** @brief Get the number of CPUs of the set */
+    [[nodiscard]] std::size_t count(void) const noexcept { return _bits.count(); }
+
+    /** @brief Fast empty check */
+    [[nodiscard]] bool empty(void) const noexcept { return _bits.none(); }
+
+    /** @brief Get the first CPU at or after 'from', NotFound if there is none */
+    [[nodiscard]] std::size_t next(const std::size_t from = 0) const noexcept;
+
+    /** @brief Format the set as a kernel CPU list ('0-3,8,10-11') */
+    [[nodiscard]] std::string toString(void) const noexcept;
+
+
+    /** @brief Set operations */
+    [[nodiscard]] CpuSet operator|(const CpuSet &other) const noexcept { CpuSet set; set._bits = _bits | other._bits; return set; }
+    [[nodiscard]] CpuSet operator&(const CpuSet &other) const noexcept { CpuSet set; set._bits = _bits & other._bits; return set; }
+    CpuSet &operator|=(const CpuSet &other) noexcept { _bits |= other._bits; return *this; }
+    CpuSet &operator&=(const CpuSet &other) noexcept { _bits &= other._bits; return *this; }
+
+    /** @brief Comparison operators */
+    [[nodiscard]] bool operator==(const CpuSet &other) const noexcept { return _bits == other._bits; }
+    [[nodiscard]] bool operator!=(const CpuSet &other) const noexcept { return _bits != other._bits; }
+
+private:
+    std::bitset<MaxCpuCount> _bits {};
+};
+
+/** @brief Core and cache topology of the machine, read from sysfs ('/sys/devices/system/cpu')
+ *  When sysfs is not available every CPU reported by the standard library is its own core without known caches */
+class Core::CpuTopology
+{
+public:
+    /** @brief A logical CPU */
+    struct Cpu
+    {
+        std::uint32_t id {};
+        std::uint32_t core {};
+        std::uint32_t package {};
+    };
+
+    /** @brief A data or unified cache and the CPUs sharing it */
+    struct Cache
+    {
+        std::uint32_t level {};
+        std::size_t size {};
+        CpuSet cpus {};
+    };
+
+
+    /** @brief Get the topology of the machine, loaded once */
+    [[nodiscard]] static const CpuTopology &Get(void) noexcept;
+
+    /** @brief Load the topology from a sysfs CPU directory (a fake tree can be used for testing) */
+    [[nodiscard]] static CpuTopology Load(const std::string_view root = "/sys/devices/system/cpu") noexcept;
+
+
+    /** @brief Get the online CPUs, sorted by id */
+    [[nodiscard]] const Vector<Cpu> &cpus(void) const noexcept { return _cpus; }
+
+    /** @brief Get the set of online CPUs */
+    [[nodiscard]] const CpuSet &online(void) const noexcept { return _online; }
+
+    /** @brief Get every distinct data / unified cache, sorted by level */
+    [[nodiscard]] const Vector<Cache> &caches(void) const noexcept { return _caches; }
+
+    /** @brief Get the number of physical cores (SMT siblings count once) */
+    [[nodiscard]] std::size_t coreCount(void) const noexcept;
+
+
+    /** @brief Get the CPUs sharing the physical core of 'cpu' (SMT siblings, 'cpu' included) */
+    [[nodiscard]] CpuSet coreSiblings(const std::size_t cpu) const noexcept;
+
+    /** @brief Get the CPUs sharing the cache of a given level with 'cpu', only 'cpu' if the cache is unknown */
+    [[nodiscard]] CpuSet sharingCache(const std::size_t cpu, const std::uint32_t level) const noexcept;
+
+    /** @brief Get the groups of CPUs sharing a cache of a given level, a single group of every CPU if the level is unknown
+     *  Placing cooperating workers in the same group keeps their shared data in that cache */
+    [[nodiscard]] Vector<CpuSet> cacheGroups(const std::uint32_t level) const noexcept;
+
+private:
+    Vector<Cpu> _cpus {};
+    Vector<Cache> _caches {};
+    CpuSet _online {};
+};
+
+/** @brief Thread wrapper applying a name, a CPU affinity and a scheduling policy before running its function
+ *  Settings are applied by the new thread itself and the constructor returns once they are, so 'status' is valid right away
+ *  Every setting is best effort : an unprivileged process keeps running with the default policy
+ *  The destructor joins the thread */
+class Core::Thread
+{
+public:
+    /** @brief Thread settings */
+    struct Options
+    {
+        /** @brief Name shown by profilers and debuggers, truncated to 15 characters on Linux */
+        std::string_view name {};
+        /** @brief CPUs the thread may run on, empty means no restriction */
+        CpuSet affinity {};
+        /** @brief Requested scheduling policy */
+        SchedulingPolicy policy { SchedulingPolicy::Default };
+        /** @brief Real-time priority in [1, 99], 0 selects the middle of the allowed range */
+        int priority { 0 };
+    };
+
+    /** @brief Settings actually applied */
+    struct Status
+    {
+        bool named { false };
+        bool pinned { false };
+        SchedulingPolicy policy { SchedulingPolicy::Default };
+    };
+
+
+    /** @brief Default constructor, no thread is running */
+    Thread(void) noexcept = default;
+
+    /** @brief Start a thread running 'function' once 'options' are applied */
+    template<typename Function>
+    Thread(const Options &options, Function &&function) noexcept;
+
+    /** @brief Move constructor */
+    Thread(Thread &&other) noexcept = default;
+
+    /** @brief Move assignment, the assigned thread is joined first */
+    Thread &operator=(Thread &&other) noexcept
+        { join(); _thread = std::move(other._thread); _status = other._status; return *this; }
+
+    /** @brief Join the thread if needed */
+    ~Thread(void) noexcept { join(); }
+
+
+    /** @brief Check if the thread can be joined */
+    [[nodiscard]] bool joinable(void) const noexcept { return _thread.joinable(); }
+
+    /** @brief Wait for the thread to finish */
+    void join(void) noexcept { if (_thread.joinable()) _thread.join(); }
+
+    /** @brief Get the settings applied when the thread started */
+    [[nodiscard]] const Status &status(void) const noexcept { return _status; }
+
+    /** @brief Get the underlying thread */
+    [[nodiscard]] std::thread &thread(void) noexcept { return _thread; }
+
+
+    /** @brief Apply every option to the calling thread */
+    static Status ApplyCurrent(const Options &options) noexcept;
+
+    /** @brief Set / get the name of the calling thread */
+    static bool SetCurrentName(const std::string_view name) noexcept;
+    [[nodiscard]] static std::string CurrentName(void) noexcept;
+
+    /** @brief Set / get the CPU affinity of the calling thread */
+    static bool SetCurrentAffinity(const CpuSet &cpus) noexcept;
+    [[nodiscard]] static CpuSet CurrentAffinity(void) noexcept;
+
+    /** @brief Request a scheduling policy for the calling thread
+     *  @return The policy actually in use, Default when a real-time policy is not allowed */
+    static SchedulingPolicy SetCurrentScheduling(const SchedulingPolicy policy, const int priority = 0) noexcept;
+    [[nodiscard]] static SchedulingPolicy CurrentScheduling(void) noexcept;
+
+    /** @brief Get the CPU the calling thread is running on (-1 if unknown) */
+    [[nodiscard]] static int CurrentCpu(void) noexcept;
+
+private:
+    std::thread _thread {};
+    Status _status {};
+};
+
+template<typename Function>
+inline Core::Thread::Thread(const Options &options, Function &&function) noexcept
+{
+    std::promise<Status> applied;
+    auto status = applied.get_future();
+
+    _thread = std::thread([options, applied = std::move(applied), function = std::forward<Function>(function)]() mutable {
+        applied.set_value(ApplyCurrent(options));
+        function();
+    });
+    _status = status.get();
+}
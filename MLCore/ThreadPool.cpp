@@ -0,0 +1,102 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: ThreadPool
+ */
+
+#include "ThreadPool.hpp"
+#include "Thread.hpp"
+
+using namespace Core;
+
+namespace
+{
+    /** @brief Pool the calling thread is a worker of (if any) */
+    thread_local const ThreadPool *CurrentPool = nullptr;
+}
+
+ThreadPool::ThreadPool(const std::size_t threadCount) noexcept
+{
+    const auto workerCount = std::max<std::size_t>(threadCount, 1) - 1;
+
+    _workers.reserve(workerCount);
+    for (auto i = 0ul; i < workerCount; ++i)
+        _workers.push([this] { work(); });
+}
+
+ThreadPool::~ThreadPool(void) noexcept
+{
+    {
+        std::lock_guard lock(_mutex);
+        _stop = true;
+    }
+    _workCondition.notify_all();
+    for (auto &worker : _workers)
+        worker.join();
+}
+
+ThreadPool &ThreadPool::Default(void) noexcept
+{
+    static ThreadPool Pool;
+
+    return Pool;
+}
+
+void ThreadPool::dispatch(const std::size_t count, const TaskFunction task, void * const context) noexcept
+{
+    if (!count)
+        return;
+    // Sequential path when there is no worker, a single task or when dispatching from one of our own tasks
+    if (_workers.empty() || count == 1 || CurrentPool == this) {
+        for (auto i = 0ul; i < count; ++i)
+            task(context, i);
+        return;
+    }
+    std::lock_guard dispatchLock(_dispatchMutex);
+    const Job job { task, context, count };
+    {
+        std::lock_guard lock(_mutex);
+        _job = job;
+        _next.store(0, std::memory_order_relaxed);
+        ++_generation;
+    }
+    _workCondition.notify_all();
+    const auto previousPool = std::exchange(CurrentPool, this);
+    runJob(job);
+    CurrentPool = previousPool;
+    std::unique_lock lock(_mutex);
+    _doneCondition.wait(lock, [this] { return !_active; });
+    // Workers waking up late must neither see the finished job nor touch '_next'
+    _job = Job {};
+}
+
+void ThreadPool::work(void) noexcept
+{
+    std::size_t generation = 0;
+
+    // Named before taking the pool mutex so the syscall never runs under it
+    Thread::SetCurrentName("MLCore worker");
+    CurrentPool = this;
+    std::unique_lock lock(_mutex);
+    while (true) {
+        _workCondition.wait(lock, [this, generation] { return _stop || _generation != generation; });
+        if (_stop)
+            return;
+        generation = _generation;
+        const auto job = _job;
+        // The job was reset before we woke up : its indexes are all done and '_next' may already belong to the next dispatch
+        if (!job.count)
+            continue;
+        ++_active;
+        lock.unlock();
+        runJob(job);
+        lock.lock();
+        if (!--_active)
+            _doneCondition.notify_one();
+    }
+}
+
+void ThreadPool::runJob(const Job &job) noexcept
+{
+    for (auto index = _next.fetch_add(1, std::memory_order_relaxed); index < job.count; index = _next.fetch_add(1, std::memory_order_relaxed))
+        job.task(job.context, index);
+}
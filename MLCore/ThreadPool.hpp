@@ -0,0 +1,87 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: ThreadPool
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "Vector.hpp"
+
+namespace Core
+{
+    class ThreadPool;
+}
+
+/** @brief Fork-join thread pool, a dispatch runs a fixed number of indexed tasks and waits for their completion
+ *  The calling thread participates to the dispatch, so a pool of N threads spawns N - 1 workers
+ *  Dispatching from a task of the same pool runs the nested tasks sequentially on the calling worker */
+class alignas_cacheline Core::ThreadPool
+{
+public:
+    /** @brief Task function, called once per index */
+    using TaskFunction = void(*)(void *context, const std::size_t index) noexcept;
+
+
+    /** @brief Construct a pool of 'threadCount' threads (the calling thread included) */
+    explicit ThreadPool(const std::size_t threadCount = std::thread::hardware_concurrency()) noexcept;
+
+    /** @brief Stop and join all workers */
+    ~ThreadPool(void) noexcept;
+
+    /** @brief A pool is neither copyable nor movable */
+    ThreadPool(const ThreadPool &other) = delete;
+    ThreadPool &operator=(const ThreadPool &other) = delete;
+
+
+    /** @brief Get the global pool (hardware concurrency) */
+    [[nodiscard]] static ThreadPool &Default(void) noexcept;
+
+
+    /** @brief Get the number of threads of the pool, the calling thread included */
+    [[nodiscard]] std::size_t threadCount(void) const noexcept { return _workers.size() + 1; }
+
+
+    /** @brief Call 'function(index)' for each index in [0, count) and wait for completion */
+    template<typename Function>
+    void dispatch(const std::size_t count, Function &&function) noexcept
+    {
+        dispatch(count, [](void *context, const std::size_t index) noexcept {
+            (*reinterpret_cast<std::remove_reference_t<Function> *>(context))(index);
+        }, const_cast<void *>(reinterpret_cast<const void *>(&function)));
+    }
+
+    /** @brief Call 'task(context, index)' for each index in [0, count) and wait for completion */
+    void dispatch(const std::size_t count, const TaskFunction task, void * const context) noexcept;
+
+private:
+    /** @brief A dispatched job */
+    struct Job
+    {
+        TaskFunction task { nullptr };
+        void *context { nullptr };
+        std::size_t count { 0 };
+    };
+
+    alignas_cacheline std::atomic<std::size_t> _next { 0 };
+    alignas_cacheline std::mutex _mutex {};
+    std::condition_variable _workCondition {};
+    std::condition_variable _doneCondition {};
+    Job _job {};
+    std::size_t _generation { 0 };
+    std::size_t _active { 0 };
+    bool _stop { false };
+    std::mutex _dispatchMutex {};
+    Vector<std::thread> _workers {};
+
+    /** @brief Worker entry point */
+    void work(void) noexcept;
+
+    /** @brief Claim and run indexes of a job until there is none left */
+    void runJob(const Job &job) noexcept;
+};
@@ -17,7 +17,7 @@
 #define nothrow_move_assignable(Type) std::is_nothrow_move_assignable_v<Type>
 #define nothrow_forward_assignable(Type) (std::is_move_assignable_v<Type> ? nothrow_move_assignable(Type) : nothrow_copy_assignable(Type))
 #define nothrow_destructible(Type) std::is_nothrow_destructible_v<Type>
-#define nothrow_invokable(Function, ...) std::is_nothrow_invokable_v<Function __VA_OPT__(,) __VA_ARGS__>
+#define nothrow_invokable(Function, ...) std::is_nothrow_invocable_v<Function __VA_OPT__(,) __VA_ARGS__>
 #define nothrow_forward_iterator_constructible(Type) (Core::Utils::IsMoveIterator<Type>::Value ? nothrow_move_constructible(Type) : nothrow_copy_constructible(Type))
 #define nothrow_convertible(From, To) std::is_nothrow_convertible_v<From, To>
 #define nothrow_expr(Expression) noexcept(Expression)
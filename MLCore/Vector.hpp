@@ -5,27 +5,26 @@
 
 #pragma once
 
-#include <cstdlib>
-
+#include "Allocator.hpp"
 #include "VectorDetails.hpp"
 
 namespace Core
 {
     namespace Internal
     {
-        template<typename Type, typename Range>
+        template<typename Type, typename Range, typename Allocator>
         class VectorBase;
     }
 
-    template<typename Type, typename Range = std::size_t>
-    using Vector = Internal::VectorDetails<Internal::VectorBase<Type, Range>, Type, Range>;
+    template<typename Type, typename Range = std::size_t, typename Growth = GrowthPolicy::Default, typename Allocator = DefaultAllocator>
+    using Vector = Internal::VectorDetails<Internal::VectorBase<Type, Range, Allocator>, Type, Range, Growth>;
 
-    template<typename Type>
-    using TinyVector = Vector<Type, std::uint32_t>;
+    template<typename Type, typename Growth = GrowthPolicy::Default, typename Allocator = DefaultAllocator>
+    using TinyVector = Vector<Type, std::uint32_t, Growth, Allocator>;
 }
 
 /** @brief Base implementation of a vector with size and capacity cached */
-template<typename Type, typename Range>
+template<typename Type, typename Range, typename Allocator>
 class Core::Internal::VectorBase
 {
 public:
@@ -89,12 +88,19 @@ protected:
     [[nodiscard]] ConstIterator endUnsafe(void) const noexcept { return data() + sizeUnsafe(); }
 
 
+    /** @brief Number of bytes allocated alongside the elements of each buffer */
+    static constexpr std::size_t AllocationOverhead = 0;
+
     /** @brief Allocates a new buffer */
     [[nodiscard]] Type *allocate(const Range capacity) noexcept
-        { return reinterpret_cast<Type *>(std::malloc(sizeof(Type) * capacity)); }
+        { return reinterpret_cast<Type *>(Allocator::Allocate(sizeof(Type) * capacity)); }
+
+    /** @brief Get the real capacity of an allocated buffer */
+    [[nodiscard]] Range usableCapacity(Type * const data, const Range capacity) const noexcept
+        { return static_cast<Range>(Allocator::UsableSize(data, sizeof(Type) * capacity) / sizeof(Type)); }
 
-    /** @brief Deallocates a buffer */
-    void deallocate(Type *data) noexcept { std::free(data); }
+    /** @brief Deallocates a buffer of a given capacity */
+    void deallocate(Type *data, const Range capacity) noexcept { Allocator::Deallocate(data, sizeof(Type) * capacity); }
 
 private:
     Type *_data { nullptr };
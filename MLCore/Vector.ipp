@@ -3,8 +3,8 @@
  * @ Description: Vector
  */
 
-template<typename Type, typename Range>
-inline void Core::Internal::VectorBase<Type, Range>::swap(VectorBase &other) noexcept
+template<typename Type, typename Range, typename Allocator>
+inline void Core::Internal::VectorBase<Type, Range, Allocator>::swap(VectorBase &other) noexcept
 {
     std::swap(_data, other._data);
     std::swap(_size, other._size);
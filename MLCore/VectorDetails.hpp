@@ -5,18 +5,27 @@
 
 #pragma once
 
+#include <algorithm>
 #include <initializer_list>
 #include <memory>
+#include <span>
+#include <cstring>
+#include <stdexcept>
+#include <functional>
 
 #include "Utils.hpp"
+#include "Assert.hpp"
+#include "GrowthPolicy.hpp"
+#include "ContainerMetrics.hpp"
 
 namespace Core::Internal
 {
-    template<typename Base, typename Type, typename Range>
+    template<typename Base, typename Type, typename Range, typename Growth = GrowthPolicy::Default>
     class VectorDetails;
 }
 
-template<typename Base, typename Type, typename Range>
+/** @brief Common vector implementation over a storage Base, the Growth policy decides how the capacity evolves */
+template<typename Base, typename Type, typename Range, typename Growth>
 class Core::Internal::VectorDetails : public Base
 {
 public:
@@ -30,7 +39,6 @@ public:
     using Base::setData;
     using Base::size;
     using Base::sizeUnsafe;
-    using Base::setSize;
     using Base::capacity;
     using Base::capacityUnsafe;
     using Base::setCapacity;
@@ -39,7 +47,7 @@ public:
     using Base::end;
     using Base::endUnsafe;
     using Base::allocate;
-    using Base::deallocate;
+    using Base::usableCapacity;
     using Base::empty;
     using Base::swap;
 
@@ -121,10 +129,34 @@ public:
     Type &push(Args &&...args)
         noexcept(std::is_nothrow_constructible_v<Type, Args...> && nothrow_destructible(Type));
 
+    /** @brief Push an element into the vector without checking the capacity
+     *  The vector must have been reserved beforehand (asserted in debug) */
+    template<typename ...Args>
+    Type &pushUnsafe(Args &&...args) noexcept(nothrow_ndebug && std::is_nothrow_constructible_v<Type, Args...>);
+
     /** @brief Pop the last element of the vector */
     void pop(void) noexcept_destructible(Type);
 
 
+    /** @brief Append a range of elements at the end of the vector, growing at most once
+     *  Trivially copyable elements from contiguous memory are copied with memcpy
+     *  @return Iterator to the first appended element */
+    template<typename InputIterator>
+    std::enable_if_t<std::is_constructible_v<Type, decltype(*std::declval<InputIterator>())>, Iterator>
+        append(const InputIterator from, const InputIterator to)
+        noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type) && nothrow_forward_iterator_constructible(InputIterator));
+
+    /** @brief Append a contiguous range of elements at the end of the vector, growing at most once */
+    Iterator append(const std::span<const Type> values)
+        noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type) && nothrow_copy_constructible(Type))
+        { return append(values.data(), values.data() + values.size()); }
+
+    /** @brief Append an initializer list at the end of the vector */
+    Iterator append(std::initializer_list<Type> &&init)
+        noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+        { return append(init.begin(), init.end()); }
+
+
     /** @brief Insert an initializer list */
     Iterator insert(const Iterator pos, std::initializer_list<Type> &&init)
         noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
@@ -155,6 +187,26 @@ public:
         noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
         { erase(pos, pos + 1); }
 
+    /** @brief Remove a specific element in O(1) by moving the last element in its place, the order is not preserved */
+    void eraseUnordered(const Iterator pos) noexcept(nothrow_forward_assignable(Type) && nothrow_destructible(Type));
+
+    /** @brief Remove the elements at given indices, each survivor is moved at most once and their order is preserved
+     *  Indices must be unique, sorted in increasing order and in range (asserted in debug) */
+    void eraseIndices(const std::span<const Range> indices)
+        noexcept(nothrow_ndebug && nothrow_forward_assignable(Type) && nothrow_destructible(Type));
+
+    /** @brief Remove the elements at given indices */
+    void eraseIndices(std::initializer_list<Range> &&indices)
+        noexcept(nothrow_ndebug && nothrow_forward_assignable(Type) && nothrow_destructible(Type))
+        { eraseIndices(std::span<const Range>(indices.begin(), indices.size())); }
+
+    /** @brief Remove every element matching 'predicate' in a single compacting pass, the order of the survivors is preserved
+     *  Trivially copyable survivors are moved by runs with memmove
+     *  @return The number of removed elements */
+    template<typename Predicate>
+    Range removeIf(Predicate &&predicate)
+        noexcept(nothrow_invokable(Predicate, Type &) && nothrow_forward_assignable(Type) && nothrow_destructible(Type));
+
 
     /** @brief Resize the vector using default constructor to initialize each element */
     void resize(const std::size_t count)
@@ -164,6 +216,10 @@ public:
     void resize(const std::size_t count, const Type &type)
         noexcept(nothrow_copy_constructible(Type) && nothrow_destructible(Type));
 
+    /** @brief Resize the vector without initializing new elements, existing elements are preserved
+     *  Only available for trivial types, used when the buffer is about to be overwritten */
+    void resizeUninitialized(const std::size_t count) noexcept;
+
     /** @brief Resize the vector with input iterators */
     template<typename InputIterator>
     std::enable_if_t<std::is_constructible_v<Type, decltype(*std::declval<InputIterator>())>, void>
@@ -186,13 +242,42 @@ public:
     bool reserve(const Range capacity) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
 
 
-    /** @brief Grow internal buffer of a given minimum */
+    /** @brief Grow internal buffer of a given minimum using the growth policy */
     void grow(const Range minimum = Range()) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
 
+    /** @brief Move the elements into a buffer of exactly 'size' elements, an empty vector releases its buffer
+     *  The capacity may stay above the size when the growth policy rounds to the allocator's usable size
+     *  @return True if the buffer has been reallocated or released */
+    bool shrinkToFit(void) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
 private:
+    /** @brief Size setter, reports the size change when CORE_CONTAINER_ACCOUNTING is defined
+     *  Must only be called when the current size is readable, use Base::setSize when the buffer has just been replaced */
+    void setSize(const Range size) noexcept
+    {
+        coreContainerAccount(OnAccountResize<Base>(sizeof(Type) * sizeUnsafe(), sizeof(Type) * size));
+        Base::setSize(size);
+    }
+
+    /** @brief Deallocates a buffer of a given capacity */
+    void deallocate(Type * const data, const Range capacity) noexcept
+    {
+        coreContainerAccount(OnAccountDeallocation<Base>(sizeof(Type) * capacity));
+        Base::deallocate(data, capacity);
+    }
+
+    /** @brief Allocates a buffer of at least 'capacity' elements, the capacity is updated if the policy rounds it */
+    [[nodiscard]] Type *allocateCapacity(Range &capacity) noexcept;
+
+    /** @brief Ensure that 'count' elements can be inserted at the end of the vector, growing with the policy if needed */
+    void reserveAppend(const Range count) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+
+    /** @brief Move 'count' elements from 'from' to 'to' (to <= from), memmove is used for trivially copyable types */
+    static void MoveLeft(Type * const from, Type * const to, const std::size_t count) noexcept_forward_assignable(Type);
+
     /** @brief Reserve unsafe takes IsSafe as template parameter */
     template<bool IsSafe>
-    bool reserveUnsafe(const Range capacity) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
+    bool reserveUnsafe(Range capacity) noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type));
 };
 
 #include "VectorDetails.ipp"
\ No newline at end of file
@@ -3,15 +3,15 @@
  * @ Description: VectorDetails
  */
 
-template<typename Base, typename Type, typename Range>
+template<typename Base, typename Type, typename Range, typename Growth>
 template<typename ...Args>
-inline Type &Core::Internal::VectorDetails<Base, Type, Range>::push(Args &&...args)
+inline Type &Core::Internal::VectorDetails<Base, Type, Range, Growth>::push(Args &&...args)
     noexcept(std::is_nothrow_constructible_v<Type, Args...> && nothrow_destructible(Type))
 {
     if (!data())
-        reserve(2);
+        reserveUnsafe<false>(Growth::template NextCapacity<Type, Range, Base::AllocationOverhead>(Range(), 1));
     else if (sizeUnsafe() == capacityUnsafe())
-        grow();
+        grow(1);
     const auto currentSize = sizeUnsafe();
     Type * const elem = dataUnsafe() + currentSize;
     setSize(currentSize + 1);
@@ -19,8 +19,22 @@ inline Type &Core::Internal::VectorDetails<Base, Type, Range>::push(Args &&...ar
     return *elem;
 }
 
-template<typename Base, typename Type, typename Range>
-inline void Core::Internal::VectorDetails<Base, Type, Range>::pop(void) noexcept_destructible(Type)
+template<typename Base, typename Type, typename Range, typename Growth>
+template<typename ...Args>
+inline Type &Core::Internal::VectorDetails<Base, Type, Range, Growth>::pushUnsafe(Args &&...args)
+    noexcept(nothrow_ndebug && std::is_nothrow_constructible_v<Type, Args...>)
+{
+    coreAssert(data() && sizeUnsafe() < capacityUnsafe(),
+        coreDebugThrow(std::logic_error("Core::VectorDetails::pushUnsafe: Not enough capacity")));
+    const auto currentSize = sizeUnsafe();
+    Type * const elem = dataUnsafe() + currentSize;
+    setSize(currentSize + 1);
+    new (elem) Type(std::forward<Args>(args)...);
+    return *elem;
+}
+
+template<typename Base, typename Type, typename Range, typename Growth>
+inline void Core::Internal::VectorDetails<Base, Type, Range, Growth>::pop(void) noexcept_destructible(Type)
 {
     const auto desiredSize = sizeUnsafe() - 1;
 
@@ -28,10 +42,10 @@ inline void Core::Internal::VectorDetails<Base, Type, Range>::pop(void) noexcept
     setSize(desiredSize);
 }
 
-template<typename Base, typename Type, typename Range>
+template<typename Base, typename Type, typename Range, typename Growth>
 template<typename InputIterator>
-inline std::enable_if_t<std::is_constructible_v<Type, decltype(*std::declval<InputIterator>())>, typename Core::Internal::VectorDetails<Base, Type, Range>::Iterator>
-    Core::Internal::VectorDetails<Base, Type, Range>::insert(const Iterator pos, const InputIterator from, const InputIterator to)
+inline std::enable_if_t<std::is_constructible_v<Type, decltype(*std::declval<InputIterator>())>, typename Core::Internal::VectorDetails<Base, Type, Range, Growth>::Iterator>
+    Core::Internal::VectorDetails<Base, Type, Range, Growth>::insert(const Iterator pos, const InputIterator from, const InputIterator to)
     noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     const std::size_t count = std::distance(from, to);
@@ -40,22 +54,28 @@ inline std::enable_if_t<std::is_constructible_v<Type, decltype(*std::declval<Inp
     if (!count)
         return end();
     else if (pos == Iterator()) {
-        reserve(count);
+        // The default policy keeps the exact reservation of an insertion in an empty vector
+        if constexpr (std::is_same_v<Growth, GrowthPolicy::Default>)
+            reserve(count);
+        else
+            reserve(Growth::template NextCapacity<Type, Range, Base::AllocationOverhead>(Range(), count));
         position = 0;
     } else
         position = pos - beginUnsafe();
     const auto currentSize = sizeUnsafe();
     if (const auto currentCapacity = capacityUnsafe(), total = currentSize + count; total > currentCapacity) {
         const auto currentData = dataUnsafe();
-        const auto desiredCapacity = currentCapacity + std::max(currentCapacity, count);
-        const auto tmpData = allocate(desiredCapacity);
+        auto desiredCapacity = Growth::template NextCapacity<Type, Range, Base::AllocationOverhead>(currentCapacity, count);
+        const auto tmpData = allocateCapacity(desiredCapacity);
+        coreContainerMetric(OnGrowth());
         std::uninitialized_move_n(currentData, position, tmpData);
         std::uninitialized_move_n(currentData + position, count, tmpData + position + count);
         std::copy(from, to, tmpData + position);
         setData(tmpData);
-        setSize(total);
+        Base::setSize(total);
+        coreContainerAccount(OnAccountResize<Base>(sizeof(Type) * currentSize, sizeof(Type) * total));
         setCapacity(desiredCapacity);
-        deallocate(currentData);
+        deallocate(currentData, currentCapacity);
         return tmpData + position;
     }
     const auto currentBegin = beginUnsafe();
@@ -74,9 +94,48 @@ inline std::enable_if_t<std::is_constructible_v<Type, decltype(*std::declval<Inp
     return currentBegin + position;
 }
 
-template<typename Base, typename Type, typename Range>
-inline typename Core::Internal::VectorDetails<Base, Type, Range>::Iterator
-    Core::Internal::VectorDetails<Base, Type, Range>::insert(const Iterator pos, const std::size_t count, const Type &value)
+template<typename Base, typename Type, typename Range, typename Growth>
+template<typename InputIterator>
+inline std::enable_if_t<std::is_constructible_v<Type, decltype(*std::declval<InputIterator>())>, typename Core::Internal::VectorDetails<Base, Type, Range, Growth>::Iterator>
+    Core::Internal::VectorDetails<Base, Type, Range, Growth>::append(const InputIterator from, const InputIterator to)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type) && nothrow_forward_iterator_constructible(InputIterator))
+{
+    const std::size_t count = std::distance(from, to);
+
+    if (!count)
+        return end();
+    if constexpr (std::is_pointer_v<InputIterator> && std::is_same_v<std::remove_cv_t<std::remove_pointer_t<InputIterator>>, Type>) {
+        // The source range may be part of the vector itself, it must be relocated if the vector grows
+        const Type *source = from;
+        if (const auto currentData = data(); currentData && !std::less<const Type *>()(from, currentData)
+                && std::less<const Type *>()(from, currentData + sizeUnsafe())) {
+            // Offset computed on integers, GCC 12 wrongly flags the pointer difference as a use after free once inlined in a loop
+            const auto offset = (reinterpret_cast<std::uintptr_t>(from) - reinterpret_cast<std::uintptr_t>(currentData)) / sizeof(Type);
+            reserveAppend(count);
+            source = dataUnsafe() + offset;
+        } else
+            reserveAppend(count);
+        const auto currentSize = sizeUnsafe();
+        const auto currentEnd = dataUnsafe() + currentSize;
+        if constexpr (std::is_trivially_copyable_v<Type>)
+            std::memcpy(currentEnd, source, sizeof(Type) * count);
+        else
+            std::uninitialized_copy(source, source + count, currentEnd);
+        setSize(currentSize + count);
+        return currentEnd;
+    } else {
+        reserveAppend(count);
+        const auto currentSize = sizeUnsafe();
+        const auto currentEnd = dataUnsafe() + currentSize;
+        std::uninitialized_copy(from, to, currentEnd);
+        setSize(currentSize + count);
+        return currentEnd;
+    }
+}
+
+template<typename Base, typename Type, typename Range, typename Growth>
+inline typename Core::Internal::VectorDetails<Base, Type, Range, Growth>::Iterator
+    Core::Internal::VectorDetails<Base, Type, Range, Growth>::insert(const Iterator pos, const std::size_t count, const Type &value)
     noexcept(nothrow_copy_constructible(Type) && nothrow_destructible(Type))
 {
     if (!count)
@@ -90,15 +149,17 @@ inline typename Core::Internal::VectorDetails<Base, Type, Range>::Iterator
     const auto currentEnd = endUnsafe();
     const auto currentSize = sizeUnsafe();
     if (const auto currentCapacity = capacityUnsafe(), total = currentSize + count; total > currentCapacity) {
-        const auto desiredCapacity = currentCapacity + std::max(currentCapacity, count);
-        const auto tmpData = allocate(desiredCapacity);
+        auto desiredCapacity = Growth::template NextCapacity<Type, Range, Base::AllocationOverhead>(currentCapacity, count);
+        const auto tmpData = allocateCapacity(desiredCapacity);
+        coreContainerMetric(OnGrowth());
         std::uninitialized_move_n(currentBegin, position, tmpData);
         std::uninitialized_move(currentBegin + position, currentEnd, tmpData + position + count);
         std::fill_n(tmpData + position, count, value);
         setData(tmpData);
-        setSize(total);
+        Base::setSize(total);
+        coreContainerAccount(OnAccountResize<Base>(sizeof(Type) * currentSize, sizeof(Type) * total));
         setCapacity(desiredCapacity);
-        deallocate(currentBegin);
+        deallocate(currentBegin, currentCapacity);
         return tmpData + position;
     } else if (const auto after = sizeUnsafe() - position; after > count) {
         std::uninitialized_move(currentEnd - count, currentEnd, currentEnd);
@@ -113,23 +174,106 @@ inline typename Core::Internal::VectorDetails<Base, Type, Range>::Iterator
     return currentBegin + position;
 }
 
-template<typename Base, typename Type, typename Range>
-inline void Core::Internal::VectorDetails<Base, Type, Range>::erase(const Iterator from, const Iterator to)
+template<typename Base, typename Type, typename Range, typename Growth>
+inline void Core::Internal::VectorDetails<Base, Type, Range, Growth>::erase(const Iterator from, const Iterator to)
     noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if (from == to)
         return;
     const auto end = endUnsafe();
     setSize(sizeUnsafe() - std::distance(from, to));
-    if constexpr (std::is_move_assignable_v<Type> && !Utils::IsMoveIterator<Iterator>::Value)
-        std::copy(std::make_move_iterator(to), std::make_move_iterator(end), from);
+    MoveLeft(to, from, std::distance(to, end));
+    std::destroy(end - std::distance(from, to), end);
+}
+
+template<typename Base, typename Type, typename Range, typename Growth>
+inline void Core::Internal::VectorDetails<Base, Type, Range, Growth>::eraseUnordered(const Iterator pos)
+    noexcept(nothrow_forward_assignable(Type) && nothrow_destructible(Type))
+{
+    const auto last = endUnsafe() - 1;
+
+    if (pos != last)
+        MoveLeft(last, pos, 1);
+    pop();
+}
+
+template<typename Base, typename Type, typename Range, typename Growth>
+inline void Core::Internal::VectorDetails<Base, Type, Range, Growth>::eraseIndices(const std::span<const Range> indices)
+    noexcept(nothrow_ndebug && nothrow_forward_assignable(Type) && nothrow_destructible(Type))
+{
+    if (indices.empty())
+        return;
+    coreAssert(std::adjacent_find(indices.begin(), indices.end(), std::greater_equal<Range>()) == indices.end() && indices.back() < size(),
+        coreDebugThrow(std::logic_error("Core::VectorDetails::eraseIndices: Indices must be unique, sorted and in range")));
+    const auto currentSize = sizeUnsafe();
+    const auto currentBegin = beginUnsafe();
+    auto out = currentBegin + indices.front();
+
+    // Each run of survivors between two erased indices is moved once
+    for (auto i = 0ul; i < indices.size(); ++i) {
+        const std::size_t from = indices[i] + 1;
+        const std::size_t to = i + 1 < indices.size() ? indices[i + 1] : currentSize;
+        MoveLeft(currentBegin + from, out, to - from);
+        out += to - from;
+    }
+    std::destroy(out, currentBegin + currentSize);
+    setSize(static_cast<Range>(out - currentBegin));
+}
+
+template<typename Base, typename Type, typename Range, typename Growth>
+template<typename Predicate>
+inline Range Core::Internal::VectorDetails<Base, Type, Range, Growth>::removeIf(Predicate &&predicate)
+    noexcept(nothrow_invokable(Predicate, Type &) && nothrow_forward_assignable(Type) && nothrow_destructible(Type))
+{
+    if (empty())
+        return Range();
+    const auto currentSize = sizeUnsafe();
+    const auto currentBegin = beginUnsafe();
+    const auto currentEnd = currentBegin + currentSize;
+    auto out = std::find_if(currentBegin, currentEnd, predicate);
+
+    if (out == currentEnd)
+        return Range();
+    if constexpr (std::is_trivially_copyable_v<Type>) {
+        // Survivors are moved by runs, the element ending a run is known to be removed
+        for (auto it = out + 1; it != currentEnd;) {
+            if (predicate(*it)) {
+                ++it;
+                continue;
+            }
+            auto run = it + 1;
+            while (run != currentEnd && !predicate(*run))
+                ++run;
+            MoveLeft(it, out, run - it);
+            out += run - it;
+            it = run == currentEnd ? run : run + 1;
+        }
+    } else {
+        for (auto it = out + 1; it != currentEnd; ++it) {
+            if (!predicate(*it))
+                *out++ = std::move(*it);
+        }
+        std::destroy(out, currentEnd);
+    }
+    setSize(static_cast<Range>(out - currentBegin));
+    return static_cast<Range>(currentEnd - out);
+}
+
+template<typename Base, typename Type, typename Range, typename Growth>
+inline void Core::Internal::VectorDetails<Base, Type, Range, Growth>::MoveLeft(Type * const from, Type * const to, const std::size_t count)
+    noexcept_forward_assignable(Type)
+{
+    if constexpr (std::is_trivially_copyable_v<Type>) {
+        if (count)
+            std::memmove(to, from, sizeof(Type) * count);
+    } else if constexpr (std::is_move_assignable_v<Type>)
+        std::move(from, from + count, to);
     else
-        std::copy(to, end, from);
-    std::destroy(to, end);
+        std::copy(from, from + count, to);
 }
 
-template<typename Base, typename Type, typename Range>
-inline void Core::Internal::VectorDetails<Base, Type, Range>::resize(const std::size_t count)
+template<typename Base, typename Type, typename Range, typename Growth>
+inline void Core::Internal::VectorDetails<Base, Type, Range, Growth>::resize(const std::size_t count)
     noexcept(std::is_nothrow_constructible_v<Type> && nothrow_destructible(Type))
 {
     if (!count) {
@@ -145,8 +289,8 @@ inline void Core::Internal::VectorDetails<Base, Type, Range>::resize(const std::
     std::uninitialized_default_construct_n(data(), count);
 }
 
-template<typename Base, typename Type, typename Range>
-inline void Core::Internal::VectorDetails<Base, Type, Range>::resize(const std::size_t count, const Type &value)
+template<typename Base, typename Type, typename Range, typename Growth>
+inline void Core::Internal::VectorDetails<Base, Type, Range, Growth>::resize(const std::size_t count, const Type &value)
     noexcept(nothrow_copy_constructible(Type) && nothrow_destructible(Type))
 {
     if (!count) {
@@ -162,10 +306,26 @@ inline void Core::Internal::VectorDetails<Base, Type, Range>::resize(const std::
     std::uninitialized_fill_n(data(), count, value);
 }
 
-template<typename Base, typename Type, typename Range>
+template<typename Base, typename Type, typename Range, typename Growth>
+inline void Core::Internal::VectorDetails<Base, Type, Range, Growth>::resizeUninitialized(const std::size_t count) noexcept
+{
+    static_assert(std::is_trivially_default_constructible_v<Type> && std::is_trivially_destructible_v<Type>,
+        "Core::VectorDetails::resizeUninitialized: Type must be trivial");
+
+    if (!count) {
+        clear();
+        return;
+    } else if (!data())
+        reserveUnsafe<false>(count);
+    else if (capacityUnsafe() < count)
+        reserveUnsafe<true>(count);
+    setSize(count);
+}
+
+template<typename Base, typename Type, typename Range, typename Growth>
 template<typename InputIterator>
 inline std::enable_if_t<std::is_constructible_v<Type, decltype(*std::declval<InputIterator>())>, void>
-    Core::Internal::VectorDetails<Base, Type, Range>::resize(const InputIterator from, const InputIterator to)
+    Core::Internal::VectorDetails<Base, Type, Range, Growth>::resize(const InputIterator from, const InputIterator to)
     noexcept(nothrow_destructible(Type) && nothrow_forward_iterator_constructible(InputIterator))
 {
     const std::size_t count = std::distance(from, to);
@@ -183,40 +343,41 @@ inline std::enable_if_t<std::is_constructible_v<Type, decltype(*std::declval<Inp
     std::uninitialized_copy(from, to, beginUnsafe());
 }
 
-template<typename Base, typename Type, typename Range>
-inline void Core::Internal::VectorDetails<Base, Type, Range>::clear(void) noexcept_destructible(Type)
+template<typename Base, typename Type, typename Range, typename Growth>
+inline void Core::Internal::VectorDetails<Base, Type, Range, Growth>::clear(void) noexcept_destructible(Type)
 {
     if (data())
         clearUnsafe();
 }
 
-template<typename Base, typename Type, typename Range>
-inline void Core::Internal::VectorDetails<Base, Type, Range>::clearUnsafe(void) noexcept_destructible(Type)
+template<typename Base, typename Type, typename Range, typename Growth>
+inline void Core::Internal::VectorDetails<Base, Type, Range, Growth>::clearUnsafe(void) noexcept_destructible(Type)
 {
     std::destroy_n(dataUnsafe(), sizeUnsafe());
     setSize(0);
 }
 
-template<typename Base, typename Type, typename Range>
-inline void Core::Internal::VectorDetails<Base, Type, Range>::release(void) noexcept_destructible(Type)
+template<typename Base, typename Type, typename Range, typename Growth>
+inline void Core::Internal::VectorDetails<Base, Type, Range, Growth>::release(void) noexcept_destructible(Type)
 {
     if (data())
         releaseUnsafe();
 }
 
-template<typename Base, typename Type, typename Range>
-inline void Core::Internal::VectorDetails<Base, Type, Range>::releaseUnsafe(void) noexcept_destructible(Type)
+template<typename Base, typename Type, typename Range, typename Growth>
+inline void Core::Internal::VectorDetails<Base, Type, Range, Growth>::releaseUnsafe(void) noexcept_destructible(Type)
 {
     const auto currentData = dataUnsafe();
+    const auto currentCapacity = capacityUnsafe();
 
     clearUnsafe();
     setCapacity(0);
     setData(nullptr);
-    deallocate(currentData);
+    deallocate(currentData, currentCapacity);
 }
 
-template<typename Base, typename Type, typename Range>
-inline bool Core::Internal::VectorDetails<Base, Type, Range>::reserve(const Range capacity)
+template<typename Base, typename Type, typename Range, typename Growth>
+inline bool Core::Internal::VectorDetails<Base, Type, Range, Growth>::reserve(const Range capacity)
     noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if (data())
@@ -225,46 +386,103 @@ inline bool Core::Internal::VectorDetails<Base, Type, Range>::reserve(const Rang
         return reserveUnsafe<false>(capacity);
 }
 
-template<typename Base, typename Type, typename Range>
+template<typename Base, typename Type, typename Range, typename Growth>
+inline void Core::Internal::VectorDetails<Base, Type, Range, Growth>::reserveAppend(const Range count)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    if (!data())
+        reserveUnsafe<false>(Growth::template NextCapacity<Type, Range, Base::AllocationOverhead>(Range(), count));
+    else if (const auto total = sizeUnsafe() + count, currentCapacity = capacityUnsafe(); total > currentCapacity)
+        grow(total - currentCapacity);
+}
+
+template<typename Base, typename Type, typename Range, typename Growth>
 template<bool IsSafe>
-inline bool Core::Internal::VectorDetails<Base, Type, Range>::reserveUnsafe(const Range capacity)
+inline bool Core::Internal::VectorDetails<Base, Type, Range, Growth>::reserveUnsafe(Range capacity)
     noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     if constexpr (IsSafe) {
         if (capacityUnsafe() >= capacity)
             return false;
         const auto currentSize = sizeUnsafe();
+        const auto currentCapacity = capacityUnsafe();
         const auto currentData = dataUnsafe();
-        const auto tmpData = allocate(capacity);
+        const auto tmpData = allocateCapacity(capacity);
+        coreContainerMetric(OnGrowth());
         std::uninitialized_move_n(currentData, currentSize, tmpData);
         std::destroy_n(currentData, currentSize);
         setData(tmpData);
-        setSize(currentSize);
+        Base::setSize(currentSize);
         setCapacity(capacity);
-        deallocate(currentData);
+        deallocate(currentData, currentCapacity);
         return true;
     } else {
-        setData(allocate(capacity));
-        setSize(0);
+        setData(allocateCapacity(capacity));
+        Base::setSize(0);
         setCapacity(capacity);
         return true;
     }
 }
 
-template<typename Base, typename Type, typename Range>
-inline void Core::Internal::VectorDetails<Base, Type, Range>::grow(const Range minimum)
+template<typename Base, typename Type, typename Range, typename Growth>
+inline void Core::Internal::VectorDetails<Base, Type, Range, Growth>::grow(const Range minimum)
     noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
 {
     const auto currentData = dataUnsafe();
     const auto currentSize = sizeUnsafe();
     const auto currentCapacity = capacityUnsafe();
-    const auto desiredCapacity = currentCapacity + std::max(currentCapacity, minimum);
-    const auto tmpData = allocate(desiredCapacity);
+    auto desiredCapacity = Growth::template NextCapacity<Type, Range, Base::AllocationOverhead>(currentCapacity, minimum);
+    const auto tmpData = allocateCapacity(desiredCapacity);
 
+    coreContainerMetric(OnGrowth());
     std::uninitialized_move_n(currentData, currentSize, tmpData);
     std::destroy_n(currentData, currentSize);
     setData(tmpData);
-    setSize(currentSize);
+    Base::setSize(currentSize);
     setCapacity(desiredCapacity);
-    deallocate(currentData);
+    deallocate(currentData, currentCapacity);
+}
+
+template<typename Base, typename Type, typename Range, typename Growth>
+inline bool Core::Internal::VectorDetails<Base, Type, Range, Growth>::shrinkToFit(void)
+    noexcept(nothrow_forward_constructible(Type) && nothrow_destructible(Type))
+{
+    if (!data())
+        return false;
+    const auto currentSize = sizeUnsafe();
+    if (!currentSize) {
+        releaseUnsafe();
+        return true;
+    }
+    const auto currentCapacity = capacityUnsafe();
+    if (currentCapacity == currentSize)
+        return false;
+    const auto currentData = dataUnsafe();
+    auto desiredCapacity = currentSize;
+    const auto tmpData = allocateCapacity(desiredCapacity);
+
+    // The allocator may round the new block up to the current capacity, keep the current one in that case
+    if (desiredCapacity >= currentCapacity) {
+        deallocate(tmpData, desiredCapacity);
+        return false;
+    }
+    std::uninitialized_move_n(currentData, currentSize, tmpData);
+    std::destroy_n(currentData, currentSize);
+    setData(tmpData);
+    Base::setSize(currentSize);
+    setCapacity(desiredCapacity);
+    deallocate(currentData, currentCapacity);
+    return true;
+}
+
+template<typename Base, typename Type, typename Range, typename Growth>
+inline Type *Core::Internal::VectorDetails<Base, Type, Range, Growth>::allocateCapacity(Range &capacity) noexcept
+{
+    const auto data = allocate(capacity);
+
+    if constexpr (Growth::RoundToUsableSize)
+        capacity = usableCapacity(data, capacity);
+    coreContainerMetric(OnAllocation(sizeof(Type) * capacity));
+    coreContainerAccount(OnAccountAllocation<Base>(sizeof(Type) * capacity));
+    return data;
 }
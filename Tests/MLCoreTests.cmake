@@ -7,6 +7,31 @@ set(MLCoreTestsSources
     ${MLCoreTestsDir}/tests_FlatVector.cpp
     ${MLCoreTestsDir}/tests_FlatString.cpp
     ${MLCoreTestsDir}/tests_UniqueAlloc.cpp
+    ${MLCoreTestsDir}/tests_Metrics.cpp
+    ${MLCoreTestsDir}/tests_HugePageAllocator.cpp
+    ${MLCoreTestsDir}/tests_PoolAllocator.cpp
+    ${MLCoreTestsDir}/tests_CompressedVector.cpp
+    ${MLCoreTestsDir}/tests_StaticVector.cpp
+    ${MLCoreTestsDir}/tests_StaticString.cpp
+    ${MLCoreTestsDir}/tests_StringBuilder.cpp
+    ${MLCoreTestsDir}/tests_SharedFlatVector.cpp
+    ${MLCoreTestsDir}/tests_InplaceFunction.cpp
+    ${MLCoreTestsDir}/tests_Mutex.cpp
+    ${MLCoreTestsDir}/tests_Thread.cpp
+    ${MLCoreTestsDir}/tests_ThreadPool.cpp
+    ${MLCoreTestsDir}/tests_Parallel.cpp
+    ${MLCoreTestsDir}/tests_RadixSort.cpp
+    ${MLCoreTestsDir}/tests_BitVector.cpp
+    ${MLCoreTestsDir}/tests_SlotMap.cpp
+    ${MLCoreTestsDir}/tests_CircularBuffer.cpp
+    ${MLCoreTestsDir}/tests_SPSCQueue.cpp
+    ${MLCoreTestsDir}/tests_Streamer.cpp
+    ${MLCoreTestsDir}/tests_EventBuffer.cpp
+    ${MLCoreTestsDir}/tests_MPSCQueue.cpp
+    ${MLCoreTestsDir}/tests_NodePool.cpp
+    ${MLCoreTestsDir}/tests_Executor.cpp
+    ${MLCoreTestsDir}/tests_Task.cpp
+    ${MLCoreTestsDir}/tests_Snapshot.cpp
 )
 
 add_executable(${CMAKE_PROJECT_NAME} ${MLCoreTestsSources})
@@ -0,0 +1,107 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the bit vector
+ */
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/BitVector.hpp>
+
+TEST(BitVector, Basics)
+{
+    Core::BitVector bits(130);
+
+    ASSERT_EQ(bits.size(), 130);
+    ASSERT_EQ(bits.wordCount(), 3);
+    ASSERT_TRUE(bits.none());
+    bits.set(0);
+    bits.set(64);
+    bits.set(129);
+    bits.set(5, true);
+    bits.flip(6);
+    ASSERT_TRUE(bits.test(0) && bits[64] && bits[129] && bits[5] && bits[6]);
+    ASSERT_FALSE(bits[1]);
+    ASSERT_EQ(bits.count(), 5);
+    bits.reset(6);
+    bits.flip(5);
+    ASSERT_EQ(bits.count(), 3);
+    bits.setAll();
+    ASSERT_TRUE(bits.all());
+    ASSERT_EQ(bits.count(), 130);
+    ASSERT_EQ(bits.words()[2], 0b11);
+    bits.resetAll();
+    ASSERT_TRUE(bits.none());
+}
+
+TEST(BitVector, Resize)
+{
+    Core::BitVector bits(10, true);
+
+    ASSERT_EQ(bits.count(), 10);
+    bits.resize(100, true);
+    ASSERT_EQ(bits.count(), 100);
+    bits.resize(70);
+    ASSERT_EQ(bits.count(), 70);
+    bits.resize(200);
+    ASSERT_EQ(bits.count(), 70);
+    ASSERT_EQ(bits.findNext(70), Core::BitVector::NotFound);
+    bits.resize(3);
+    ASSERT_EQ(bits.words()[0], 0b111);
+    bits.clear();
+    ASSERT_TRUE(bits.empty());
+}
+
+TEST(BitVector, Find)
+{
+    Core::BitVector bits(1024);
+    std::vector<std::size_t> expected { 3, 63, 64, 200, 511, 1023 };
+    std::vector<std::size_t> found;
+
+    ASSERT_EQ(bits.findFirst(), Core::BitVector::NotFound);
+    for (const auto index : expected)
+        bits.set(index);
+    for (auto index = bits.findFirst(); index != Core::BitVector::NotFound; index = bits.findNext(index + 1))
+        found.push_back(index);
+    ASSERT_EQ(found, expected);
+    found.clear();
+    bits.forEach([&found](const std::size_t index) { found.push_back(index); });
+    ASSERT_EQ(found, expected);
+    ASSERT_EQ(bits.findNext(64), 64);
+    ASSERT_EQ(bits.findNext(65), 200);
+    ASSERT_EQ(bits.findNext(2000), Core::BitVector::NotFound);
+}
+
+TEST(BitVector, BulkOperations)
+{
+    std::mt19937 engine(42);
+
+    for (const auto size : { 1ul, 63ul, 256ul, 1000ul, 4099ul }) {
+        Core::BitVector lhs(size), rhs(size);
+        std::vector<bool> a(size), b(size);
+        for (auto i = 0ul; i < size; ++i) {
+            a[i] = engine() & 1;
+            b[i] = engine() & 1;
+            lhs.set(i, a[i]);
+            rhs.set(i, b[i]);
+        }
+        auto andBits = lhs, orBits = lhs, xorBits = lhs, andNotBits = lhs;
+        andBits &= rhs;
+        orBits |= rhs;
+        xorBits ^= rhs;
+        andNotBits.andNot(rhs);
+        for (auto i = 0ul; i < size; ++i) {
+            ASSERT_EQ(andBits[i], a[i] && b[i]);
+            ASSERT_EQ(orBits[i], a[i] || b[i]);
+            ASSERT_EQ(xorBits[i], a[i] != b[i]);
+            ASSERT_EQ(andNotBits[i], a[i] && !b[i]);
+        }
+        xorBits ^= xorBits;
+        ASSERT_TRUE(xorBits.none());
+        auto copy = lhs;
+        ASSERT_EQ(copy, lhs);
+        copy.flip(size - 1);
+        ASSERT_NE(copy, lhs);
+    }
+}
@@ -0,0 +1,120 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the circular buffer
+ */
+
+#include <gtest/gtest.h>
+
+#include <MLCore/CircularBuffer.hpp>
+
+using Buffer = Core::CircularBuffer<float>;
+
+TEST(CircularBuffer, Capacity)
+{
+    Buffer buffer(100);
+
+    ASSERT_EQ(buffer.capacity(), 128);
+    ASSERT_EQ(buffer.mask(), 127);
+    ASSERT_FALSE(buffer.isMirrored());
+    for (auto i = 0ul; i < buffer.capacity(); ++i)
+        ASSERT_EQ(buffer.data()[i], 0.0f);
+    Buffer moved(std::move(buffer));
+    ASSERT_EQ(moved.capacity(), 128);
+    ASSERT_EQ(buffer.capacity(), 0);
+    ASSERT_EQ(Buffer().capacity(), 0);
+}
+
+TEST(CircularBuffer, PushTap)
+{
+    Buffer buffer(8);
+
+    for (auto i = 0; i < 20; ++i)
+        buffer.push(static_cast<float>(i));
+    ASSERT_EQ(buffer.head(), 20 % 8);
+    ASSERT_EQ(buffer.tap(0), 19.0f);
+    ASSERT_EQ(buffer.tap(7), 12.0f);
+    ASSERT_EQ(buffer[buffer.head()], 12.0f);
+}
+
+static void TestWrapped(Buffer &buffer)
+{
+    std::vector<float> input(buffer.capacity() * 3 + 5);
+    for (auto i = 0ul; i < input.size(); ++i)
+        input[i] = static_cast<float>(i);
+
+    // Write blocks that are not aligned to the capacity so they wrap
+    std::size_t written = 0;
+    for (const auto block : { 7ul, 50ul, 13ul, buffer.capacity(), 3ul }) {
+        const auto count = std::min(block, input.size() - written);
+        buffer.write(std::span<const float>(input.data() + written, count));
+        written += count;
+        // Read back the last written block, oldest first
+        std::vector<float> output(count);
+        buffer.read(count, output);
+        for (auto i = 0ul; i < count; ++i)
+            ASSERT_EQ(output[i], input[written - count + i]);
+        const auto spans = buffer.readSpans(count, count);
+        ASSERT_EQ(spans.size(), count);
+        if (buffer.isMirrored()) {
+            ASSERT_TRUE(spans.second.empty());
+        }
+        for (auto i = 0ul; i < spans.first.size(); ++i)
+            ASSERT_EQ(spans.first[i], input[written - count + i]);
+        for (auto i = 0ul; i < spans.second.size(); ++i)
+            ASSERT_EQ(spans.second[i], input[written - count + spans.first.size() + i]);
+    }
+    // Fill through write spans
+    auto spans = buffer.writeSpans(buffer.capacity() - 1);
+    for (auto &value : spans.first)
+        value = -1.0f;
+    for (auto &value : spans.second)
+        value = -1.0f;
+    buffer.advance(buffer.capacity() - 1);
+    ASSERT_EQ(buffer.tap(0), -1.0f);
+    ASSERT_EQ(buffer.tap(buffer.capacity() - 2), -1.0f);
+    ASSERT_EQ(buffer.tap(buffer.capacity() - 1), input[written - 1]);
+}
+
+TEST(CircularBuffer, Wrapped)
+{
+    Buffer buffer(64);
+
+    TestWrapped(buffer);
+}
+
+TEST(CircularBuffer, Mirrored)
+{
+    Buffer buffer(64, Buffer::Mode::Mirrored);
+
+#ifdef __linux__
+    ASSERT_TRUE(buffer.isMirrored());
+#endif
+    if (!buffer.isMirrored())
+        GTEST_SKIP() << "Mirrored mapping not supported";
+    // Rounded to a page
+    ASSERT_EQ(buffer.capacity() * sizeof(float) % Core::Memory::PageSize(), 0);
+    TestWrapped(buffer);
+    // The second mapping aliases the first one
+    buffer.data()[0] = 42.0f;
+    ASSERT_EQ(buffer.data()[buffer.capacity()], 42.0f);
+    // Any window is contiguous
+    buffer.clear();
+    for (auto i = 0ul; i < buffer.capacity() + 10; ++i)
+        buffer.push(static_cast<float>(i));
+    const auto window = buffer.window(buffer.capacity());
+    for (auto i = 0ul; i < buffer.capacity(); ++i)
+        ASSERT_EQ(window[i], static_cast<float>(i + 10));
+}
+
+TEST(CircularBuffer, Fractional)
+{
+    Buffer buffer(16);
+
+    // Linear ramp: interpolations must be exact
+    for (auto i = 0; i < 16; ++i)
+        buffer.push(static_cast<float>(i));
+    ASSERT_FLOAT_EQ(buffer.readLinear(0.0f), 15.0f);
+    ASSERT_FLOAT_EQ(buffer.readLinear(2.25f), 12.75f);
+    ASSERT_FLOAT_EQ(buffer.readCubic(1.0f), 14.0f);
+    ASSERT_FLOAT_EQ(buffer.readCubic(3.5f), 11.5f);
+}
@@ -0,0 +1,163 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the block-compressed vector
+ */
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/CompressedVector.hpp>
+
+namespace
+{
+    /** @brief Generate a sine wave quantized to 16 bits */
+    Core::Vector<std::int16_t> SineWave(const std::size_t count) noexcept
+    {
+        Core::Vector<std::int16_t> samples;
+        samples.reserve(count);
+        for (auto i = 0ul; i < count; ++i)
+            samples.push(static_cast<std::int16_t>(std::sin(static_cast<double>(i) * 0.01) * 20000.0));
+        return samples;
+    }
+
+    template<typename Type>
+    std::span<const Type> ToSpan(const Core::Vector<Type> &vector) noexcept
+        { return std::span<const Type>(vector.begin(), vector.end()); }
+
+    template<typename Type, std::size_t BlockSize>
+    void ExpectEqual(const Core::CompressedVector<Type, BlockSize> &vector, const Core::Vector<Type> &expected)
+    {
+        Core::Vector<Type> decoded;
+        decoded.resizeUninitialized(expected.size());
+        vector.decode(0, std::span<Type>(decoded.begin(), decoded.end()));
+        ASSERT_EQ(vector.size(), expected.size());
+        for (auto i = 0ul; i < expected.size(); ++i)
+            ASSERT_EQ(decoded[i], expected[i]) << "at index " << i;
+    }
+}
+
+TEST(CompressedVector, Basics)
+{
+    Core::CompressedVector<std::int32_t, 128> vector;
+
+    ASSERT_TRUE(vector.empty());
+    ASSERT_EQ(vector.compressedBytes(), 0);
+    vector.push(42);
+    ASSERT_EQ(vector.size(), 1);
+    ASSERT_EQ(vector.blockCount(), 1);
+    ASSERT_EQ(vector.block(0).width, 0);
+    Core::Vector<std::int32_t> expected { 42 };
+    for (auto i = 0; i < 200; ++i) {
+        vector.push(i * 3 - 100);
+        expected.push(i * 3 - 100);
+    }
+    ASSERT_EQ(vector.blockCount(), 2);
+    ASSERT_EQ(vector.blockValueCount(1), 201 - 128);
+    ExpectEqual(vector, expected);
+    vector.clear();
+    ASSERT_TRUE(vector.empty());
+    ASSERT_EQ(vector.blockCount(), 0);
+}
+
+TEST(CompressedVector, Extremes)
+{
+    Core::Vector<std::int64_t> values {
+        std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max(), 0, -1,
+        std::numeric_limits<std::int64_t>::max(), std::numeric_limits<std::int64_t>::min()
+    };
+    Core::CompressedVector<std::int64_t, 128> vector(ToSpan(values));
+
+    ASSERT_EQ(vector.block(0).width, 64);
+    ExpectEqual(vector, values);
+
+    Core::Vector<std::uint8_t> bytes;
+    std::mt19937 random(7);
+    for (auto i = 0; i < 1000; ++i)
+        bytes.push(static_cast<std::uint8_t>(random()));
+    ExpectEqual(Core::CompressedVector<std::uint8_t, 128>(ToSpan(bytes)), bytes);
+}
+
+TEST(CompressedVector, EveryWidth)
+{
+    // Block i holds deltas of exactly i bits
+    Core::Vector<std::uint64_t> values;
+    std::uint64_t value = 0;
+    for (auto width = 0u; width <= 64; ++width) {
+        const auto delta = width ? (width == 64 ? ~0ull : 1ull << (width - 1)) : 0ull;
+        for (auto i = 0u; i < 128; ++i) {
+            values.push(value);
+            value += (i & 1) ? delta : -delta;
+        }
+    }
+    Core::CompressedVector<std::uint64_t, 128> vector(ToSpan(values));
+
+    ASSERT_EQ(vector.blockCount(), 65);
+    ExpectEqual(vector, values);
+}
+
+TEST(CompressedVector, Samples)
+{
+    const auto samples = SineWave(48000);
+    Core::CompressedVector<std::int16_t> vector(ToSpan(samples));
+
+    ExpectEqual(vector, samples);
+    // 16 bits samples of a smooth signal need about 8 bits per delta
+    ASSERT_LT(vector.compressedBytes() * 3 / 2, vector.uncompressedBytes());
+
+    // Floating points are lossless through their bit pattern
+    Core::Vector<float> floats;
+    for (const auto sample : samples)
+        floats.push(static_cast<float>(sample) / 32768.0f);
+    ExpectEqual(Core::CompressedVector<float>(ToSpan(floats)), floats);
+}
+
+TEST(CompressedVector, PartialAppends)
+{
+    const auto samples = SineWave(5000);
+    Core::CompressedVector<std::int16_t, 256> vector;
+
+    for (auto offset = 0ul; offset < samples.size();) {
+        const auto count = std::min<std::size_t>(samples.size() - offset, 1 + offset % 300);
+        vector.append(std::span<const std::int16_t>(samples.data() + offset, count));
+        offset += count;
+    }
+    ExpectEqual(vector, samples);
+
+    // Unaligned range decoding
+    std::int16_t window[700];
+    vector.decode(1000, window);
+    for (auto i = 0ul; i < 700; ++i)
+        ASSERT_EQ(window[i], samples[1000 + i]);
+}
+
+TEST(CompressedVector, Reader)
+{
+    const auto samples = SineWave(4096);
+    Core::CompressedVector<std::int16_t, 256> vector(ToSpan(samples));
+    Core::CompressedVector<std::int16_t, 256>::Reader reader(vector, 2);
+
+    for (auto i = 0ul; i < samples.size(); ++i)
+        ASSERT_EQ(reader[i], samples[i]);
+    ASSERT_EQ(reader.misses(), vector.blockCount());
+    ASSERT_EQ(reader.hits(), samples.size() - vector.blockCount());
+
+    // Ping-pong between two blocks stays in cache
+    const auto misses = reader.misses();
+    for (auto i = 0; i < 10; ++i) {
+        ASSERT_EQ(reader[10], samples[10]);
+        ASSERT_EQ(reader[300], samples[300]);
+    }
+    ASSERT_EQ(reader.misses(), misses + 2);
+
+    std::int16_t window[600];
+    reader.read(200, window);
+    for (auto i = 0ul; i < 600; ++i)
+        ASSERT_EQ(window[i], samples[200 + i]);
+
+    vector.append(ToSpan(samples));
+    reader.invalidate();
+    ASSERT_EQ(reader[4096 + 5], samples[5]);
+}
@@ -0,0 +1,177 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the event buffer and k-way merge
+ */
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/EventBuffer.hpp>
+
+namespace
+{
+    struct Event
+    {
+        std::uint32_t timestamp;
+        std::uint16_t producer;
+        std::uint16_t index;
+    };
+
+    /** @brief Generate sorted runs of random timestamps */
+    std::vector<std::vector<Event>> MakeRuns(const std::size_t runCount, const std::size_t maxSize, const std::uint32_t maxTimestamp)
+    {
+        std::mt19937 engine(static_cast<std::uint32_t>(runCount * 131 + maxSize));
+        std::vector<std::vector<Event>> runs(runCount);
+
+        for (auto producer = 0ul; producer < runCount; ++producer) {
+            const auto size = engine() % (maxSize + 1);
+            for (auto i = 0ul; i < size; ++i)
+                runs[producer].push_back(Event { static_cast<std::uint32_t>(engine() % maxTimestamp), static_cast<std::uint16_t>(producer), 0 });
+            std::sort(runs[producer].begin(), runs[producer].end(), [](const Event &lhs, const Event &rhs) { return lhs.timestamp < rhs.timestamp; });
+            for (auto i = 0ul; i < size; ++i)
+                runs[producer][i].index = static_cast<std::uint16_t>(i);
+        }
+        return runs;
+    }
+
+    /** @brief Check that events are sorted by timestamp then by producer then by index (stability) */
+    void CheckStableOrder(const Event *begin, const Event *end)
+    {
+        for (auto it = begin + 1; it < end; ++it) {
+            const auto &previous = *(it - 1);
+            ASSERT_LE(previous.timestamp, it->timestamp);
+            if (previous.timestamp == it->timestamp) {
+                ASSERT_LE(previous.producer, it->producer);
+                if (previous.producer == it->producer) {
+                    ASSERT_LT(previous.index, it->index);
+                }
+            }
+        }
+    }
+}
+
+TEST(EventBuffer, MergeRuns)
+{
+    for (const auto runCount : { 0ul, 1ul, 2ul, 3ul, 17ul, 64ul }) {
+        const auto runs = MakeRuns(runCount, 50, 100);
+        std::vector<std::span<const Event>> spans;
+        std::size_t total = 0;
+        for (const auto &run : runs) {
+            spans.emplace_back(run.data(), run.size());
+            total += run.size();
+        }
+        std::vector<Event> output(total);
+        const auto end = Core::MergeRuns(std::span<const std::span<const Event>>(spans), output.data());
+        ASSERT_EQ(end, output.data() + total);
+        CheckStableOrder(output.data(), end);
+    }
+}
+
+TEST(EventBuffer, MergeRunsMaxKeys)
+{
+    // Maximum keys in run 0 pack to the same high bits as exhausted runs, they must still merge in order
+    const std::vector<std::uint32_t> unsignedRuns[] { { UINT32_MAX, UINT32_MAX }, { 1 }, { 0, UINT32_MAX }, {}, { 5 } };
+    const std::vector<std::int32_t> signedRuns[] { { INT32_MAX }, { -3, 7 }, { INT32_MIN } };
+    const auto identity = [](const auto value) { return value; };
+
+    std::vector<std::span<const std::uint32_t>> unsignedSpans(std::begin(unsignedRuns), std::end(unsignedRuns));
+    std::vector<std::uint32_t> unsignedOutput(6);
+    Core::MergeRuns(std::span<const std::span<const std::uint32_t>>(unsignedSpans), unsignedOutput.data(), identity);
+    ASSERT_EQ(unsignedOutput, (std::vector<std::uint32_t> { 0, 1, 5, UINT32_MAX, UINT32_MAX, UINT32_MAX }));
+
+    std::vector<std::span<const std::int32_t>> signedSpans(std::begin(signedRuns), std::end(signedRuns));
+    std::vector<std::int32_t> signedOutput(4);
+    Core::MergeRuns(std::span<const std::span<const std::int32_t>>(signedSpans), signedOutput.data(), identity);
+    ASSERT_EQ(signedOutput, (std::vector<std::int32_t> { INT32_MIN, -3, 7, INT32_MAX }));
+}
+
+TEST(EventBuffer, MergeRunsWideKeys)
+{
+    struct WideEvent
+    {
+        std::uint64_t timestamp;
+        std::uint32_t run;
+        std::uint32_t index;
+    };
+
+    std::mt19937_64 engine(3);
+    std::vector<std::vector<WideEvent>> runs(9);
+    std::vector<std::span<const WideEvent>> spans;
+    std::size_t total = 0;
+
+    for (auto r = 0u; r < runs.size(); ++r) {
+        for (auto i = 0u; i < 40u * r; ++i)
+            runs[r].push_back(WideEvent { (engine() % 64) << 40, r, 0 });
+        std::sort(runs[r].begin(), runs[r].end(), [](const auto &lhs, const auto &rhs) { return lhs.timestamp < rhs.timestamp; });
+        for (auto i = 0u; i < runs[r].size(); ++i)
+            runs[r][i].index = i;
+        spans.emplace_back(runs[r].data(), runs[r].size());
+        total += runs[r].size();
+    }
+    std::vector<WideEvent> output(total);
+    ASSERT_EQ(Core::MergeRuns(std::span<const std::span<const WideEvent>>(spans), output.data()), output.data() + total);
+    for (auto i = 1ul; i < total; ++i) {
+        const auto &previous = output[i - 1];
+        ASSERT_LE(previous.timestamp, output[i].timestamp);
+        if (previous.timestamp == output[i].timestamp) {
+            ASSERT_TRUE(previous.run < output[i].run || (previous.run == output[i].run && previous.index < output[i].index));
+        }
+    }
+}
+
+TEST(EventBuffer, MergeRunsInfiniteKeys)
+{
+    // Infinite keys compare beyond the maximum key given to exhausted and padding leaves, they must not win against them
+    constexpr auto Infinity = std::numeric_limits<double>::infinity();
+    const std::vector<double> runs[] { { -Infinity, 1.0, Infinity }, { Infinity, Infinity }, { -Infinity, 0.5 } };
+    const auto identity = [](const auto value) { return value; };
+
+    std::vector<std::span<const double>> spans(std::begin(runs), std::end(runs));
+    std::vector<double> output(7);
+    ASSERT_EQ(Core::MergeRuns(std::span<const std::span<const double>>(spans), output.data(), identity), output.data() + output.size());
+    ASSERT_EQ(output, (std::vector<double> { -Infinity, -Infinity, 0.5, 1.0, Infinity, Infinity, Infinity }));
+}
+
+TEST(EventBuffer, AppendAndMerge)
+{
+    Core::EventBuffer<Event> buffer;
+
+    // More runs than a single merge pass can handle
+    for (const auto runCount : { 5ul, 64ul, 200ul }) {
+        buffer.clear();
+        const auto runs = MakeRuns(runCount, 20, 512);
+        std::size_t total = 0;
+        for (const auto &run : runs) {
+            buffer.appendRun(std::span<const Event>(run.data(), run.size()));
+            total += run.size();
+        }
+        ASSERT_EQ(buffer.size(), total);
+        buffer.merge();
+        ASSERT_TRUE(buffer.isSorted());
+        ASSERT_EQ(buffer.size(), total);
+        CheckStableOrder(buffer.begin(), buffer.end());
+        const auto block = buffer.range(128u, 256u);
+        ASSERT_EQ(block.size(), std::count_if(buffer.begin(), buffer.end(), [](const Event &event) {
+            return event.timestamp >= 128 && event.timestamp < 256;
+        }));
+        for (const auto &event : block)
+            ASSERT_TRUE(event.timestamp >= 128 && event.timestamp < 256);
+    }
+}
+
+TEST(EventBuffer, Push)
+{
+    Core::EventBuffer<Event> buffer;
+
+    ASSERT_TRUE(buffer.isSorted());
+    for (const auto timestamp : { 1u, 5u, 5u, 9u, 2u, 3u, 0u })
+        buffer.push(Event { timestamp, 0, 0 });
+    ASSERT_EQ(buffer.runCount(), 3);
+    buffer.merge();
+    ASSERT_EQ(buffer.runCount(), 1);
+    std::vector<std::uint32_t> timestamps;
+    for (const auto &event : buffer)
+        timestamps.push_back(event.timestamp);
+    ASSERT_EQ(timestamps, (std::vector<std::uint32_t> { 0, 1, 2, 3, 5, 5, 9 }));
+}
@@ -0,0 +1,53 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the coroutine executors
+ */
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/Task.hpp>
+
+using namespace Core;
+
+namespace
+{
+    Task<std::thread::id> ResumeOn(Executor &executor)
+    {
+        co_await executor.schedule();
+        co_return std::this_thread::get_id();
+    }
+}
+
+TEST(Executor, Inline)
+{
+    InlineExecutor executor;
+
+    ASSERT_EQ(SyncWait(ResumeOn(executor)), std::this_thread::get_id());
+}
+
+TEST(Executor, Pool)
+{
+    PoolExecutor executor(2);
+
+    ASSERT_EQ(executor.threadCount(), 2);
+    ASSERT_NE(SyncWait(ResumeOn(executor)), std::this_thread::get_id());
+}
+
+TEST(Executor, Manual)
+{
+    ManualExecutor executor;
+    std::atomic<bool> stop { false };
+    std::thread poller([&executor, &stop] {
+        while (!stop.load())
+            if (!executor.poll())
+                std::this_thread::yield();
+    });
+
+    ASSERT_EQ(SyncWait(ResumeOn(executor)), poller.get_id());
+    stop = true;
+    poller.join();
+    ASSERT_EQ(executor.poll(), 0);
+}
@@ -42,4 +42,43 @@ TEST(FlatString, Basics)
     str = std::string(value);
     assertStringValue(str);
     str = std::string_view(value);
-}
\ No newline at end of file
+}
+
+TEST(FlatString, Append)
+{
+    Core::FlatString str("Track ");
+
+    str += std::string_view("12");
+    str += ' ';
+    str.append(std::string("- Gain"));
+    str += Core::FlatString(" -6.0");
+    str += " dB";
+    ASSERT_EQ(str, "Track 12 - Gain -6.0 dB");
+    str += str;
+    ASSERT_EQ(str, "Track 12 - Gain -6.0 dBTrack 12 - Gain -6.0 dB");
+
+    Core::FlatString empty;
+    empty += nullptr;
+    ASSERT_TRUE(empty.empty());
+    empty += "x";
+    ASSERT_EQ(empty, "x");
+}
+
+TEST(FlatString, ShrinkToFit)
+{
+    Core::FlatString str("Sample");
+
+    str.reserve(4096);
+    str += " 42";
+    ASSERT_TRUE(str.shrinkToFit());
+    ASSERT_EQ(str.capacity(), 9);
+    ASSERT_EQ(str, "Sample 42");
+
+    Core::SharedFlatString shared("Shared");
+    shared.reserve(64);
+    const auto copy = shared;
+    ASSERT_TRUE(shared.shrinkToFit());
+    ASSERT_EQ(shared.capacity(), 6);
+    ASSERT_EQ(copy.capacity(), 64);
+    ASSERT_EQ(shared, copy);
+}
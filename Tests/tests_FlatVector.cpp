@@ -2,6 +2,8 @@
  * @ Author: Matthieu Moinvaziri
  * @ Description: Tests of the single consumer concurrent queue
  */
+#include <list>
+
 #include <gtest/gtest.h>
 
 #include <MLCore/FlatVector.hpp>
@@ -192,4 +194,103 @@ TEST(FlatVector, Erase)
         vector.erase(vector.begin());
         ASSERT_EQ(vector.size(), 0);
     }
-}
\ No newline at end of file
+}
+
+TEST(FlatVector, BatchErase)
+{
+    Core::FlatVector<int> vector { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+    ASSERT_EQ(vector.removeIf([](const int value) { return value % 2; }), 4);
+    ASSERT_EQ(vector.size(), 4);
+    vector.eraseUnordered(vector.begin());
+    ASSERT_EQ(vector.size(), 3);
+    ASSERT_EQ(vector[0], 6);
+    vector.eraseIndices({ 1 });
+    ASSERT_EQ(vector.size(), 2);
+    ASSERT_EQ(vector[0], 6);
+    ASSERT_EQ(vector[1], 4);
+}
+
+TEST(FlatVector, PushUnsafe)
+{
+    constexpr auto count = 42ul;
+    Core::FlatVector<std::size_t> vector;
+
+    vector.reserve(count);
+    const auto *data = vector.data();
+    for (auto i = 0ul; i < count; ++i)
+        ASSERT_EQ(vector.pushUnsafe(i), i);
+    ASSERT_EQ(vector.data(), data);
+    ASSERT_EQ(vector.size(), count);
+    for (auto i = 0ul; i < count; ++i)
+        ASSERT_EQ(vector[i], i);
+}
+
+TEST(FlatVector, Append)
+{
+    std::vector<int> tmp(10, 42);
+    Core::FlatVector<int> vector;
+
+    vector.append(tmp.data(), tmp.data() + tmp.size());
+    ASSERT_EQ(vector.size(), 10);
+    vector.append(std::span<const int>(tmp.data(), 5));
+    ASSERT_EQ(vector.size(), 15);
+    for (auto elem : vector)
+        ASSERT_EQ(elem, 42);
+    const auto it = vector.append({ 1, 2, 3 });
+    ASSERT_EQ(*it, 1);
+    ASSERT_EQ(vector.size(), 18);
+    ASSERT_EQ(vector.back(), 3);
+
+    std::list<std::string> strings { "a", "b", "c" };
+    Core::FlatVector<std::string> stringVector(1, "z");
+    stringVector.append(strings.begin(), strings.end());
+    ASSERT_EQ(stringVector.size(), 4);
+    ASSERT_EQ(stringVector.front(), "z");
+    ASSERT_EQ(stringVector.back(), "c");
+}
+
+TEST(FlatVector, ResizeUninitialized)
+{
+    Core::FlatVector<int> vector { 1, 2, 3 };
+
+    vector.resizeUninitialized(1000);
+    ASSERT_EQ(vector.size(), 1000);
+    ASSERT_EQ(vector[0], 1);
+    ASSERT_EQ(vector[2], 3);
+    vector.resizeUninitialized(2);
+    ASSERT_EQ(vector.size(), 2);
+    ASSERT_EQ(vector.capacity(), 1000);
+    ASSERT_EQ(vector.back(), 2);
+    vector.resizeUninitialized(0);
+    ASSERT_TRUE(vector.empty());
+}
+
+TEST(FlatVector, ReleaseReuse)
+{
+    Core::FlatVector<int> vector(10, 42);
+
+    vector.release();
+    ASSERT_EQ(vector.data(), nullptr);
+    ASSERT_EQ(vector.size(), 0);
+    vector.push(24);
+    ASSERT_EQ(vector.size(), 1);
+    ASSERT_EQ(vector.front(), 24);
+}
+
+TEST(FlatVector, ShrinkToFit)
+{
+    Core::FlatVector<int> vector(1000, 42);
+
+    vector.resize(3, 7);
+    ASSERT_EQ(vector.capacity(), 1000);
+    ASSERT_TRUE(vector.shrinkToFit());
+    ASSERT_EQ(vector.capacity(), 3);
+    ASSERT_EQ(vector.size(), 3);
+    ASSERT_EQ(vector[2], 7);
+    vector.push(8);
+    ASSERT_EQ(vector.back(), 8);
+    vector.clear();
+    ASSERT_TRUE(vector.shrinkToFit());
+    ASSERT_EQ(vector.data(), nullptr);
+}
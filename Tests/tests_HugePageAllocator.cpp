@@ -0,0 +1,72 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the huge page allocator
+ */
+
+#include <gtest/gtest.h>
+
+#include <MLCore/HugePageAllocator.hpp>
+#include <MLCore/Vector.hpp>
+#include <MLCore/FlatVector.hpp>
+
+using HugeAllocator = Core::HugePageAllocator<64 * 1024>;
+
+TEST(HugePageAllocator, SmallAndLargeBlocks)
+{
+    auto small = HugeAllocator::Allocate(128);
+    ASSERT_NE(small, nullptr);
+    ASSERT_LT(HugeAllocator::UsableSize(small, 128), 64 * 1024);
+    HugeAllocator::Deallocate(small, 128);
+
+    constexpr auto largeSize = 3 * 1024 * 1024;
+    auto large = HugeAllocator::Allocate(largeSize);
+    ASSERT_NE(large, nullptr);
+    ASSERT_EQ(HugeAllocator::UsableSize(large, largeSize), 2 * Core::Memory::HugePageSize);
+    Core::Memory::FirstTouch(large, largeSize);
+    HugeAllocator::Deallocate(large, largeSize);
+}
+
+TEST(HugePageAllocator, Vector)
+{
+    constexpr auto count = 1024ul * 1024ul;
+    Core::Vector<std::uint32_t, std::size_t, Core::GrowthPolicy::UsableSize<>, HugeAllocator> vector;
+
+    for (auto i = 0u; i < count; ++i)
+        vector.push(i);
+    ASSERT_EQ(vector.size(), count);
+    ASSERT_EQ((vector.capacity() * sizeof(std::uint32_t)) % Core::Memory::HugePageSize, 0);
+    for (auto i = 0u; i < count; ++i)
+        ASSERT_EQ(vector[i], i);
+    vector.release();
+    ASSERT_EQ(vector.capacity(), 0);
+}
+
+TEST(HugePageAllocator, FlatVector)
+{
+    constexpr auto count = 256ul * 1024ul;
+    Core::FlatVector<std::uint64_t, std::size_t, Core::GrowthPolicy::Default, HugeAllocator> vector(count, 42ul);
+
+    ASSERT_EQ(vector.size(), count);
+    for (const auto elem : vector)
+        ASSERT_EQ(elem, 42ul);
+    vector.push(24ul);
+    ASSERT_EQ(vector.back(), 24ul);
+}
+
+TEST(HugePageAllocator, Numa)
+{
+    const auto nodeCount = Core::Memory::NumaNodeCount();
+    ASSERT_GE(nodeCount, 1);
+    const auto node = Core::Memory::CurrentNumaNode();
+    ASSERT_GE(node, 0);
+    ASSERT_LT(node, nodeCount);
+    ASSERT_FALSE(Core::Memory::BindToNumaNode(nullptr, 0, nodeCount));
+
+    Core::Memory::SetThreadNumaNode(node);
+    ASSERT_EQ(Core::Memory::ThreadNumaNode(), node);
+    auto data = HugeAllocator::Allocate(Core::Memory::HugePageSize);
+    ASSERT_NE(data, nullptr);
+    Core::Memory::FirstTouch(data, Core::Memory::HugePageSize);
+    HugeAllocator::Deallocate(data, Core::Memory::HugePageSize);
+    Core::Memory::SetThreadNumaNode(-1);
+}
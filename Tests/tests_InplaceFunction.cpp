@@ -0,0 +1,123 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the allocation-free function wrappers
+ */
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/InplaceFunction.hpp>
+#include <MLCore/Vector.hpp>
+
+namespace
+{
+    int Add(const int lhs, const int rhs) noexcept { return lhs + rhs; }
+
+    /** @brief Count live instances to check that every callable is destroyed once */
+    struct Tracked
+    {
+        static inline int Alive = 0;
+
+        Tracked(void) noexcept { ++Alive; }
+        Tracked(const Tracked &) noexcept { ++Alive; }
+        Tracked(Tracked &&) noexcept { ++Alive; }
+        ~Tracked(void) noexcept { --Alive; }
+
+        int operator()(const int value) const noexcept { return value * 2; }
+    };
+
+    static_assert(sizeof(Core::InplaceFunction<void(void)>) == Core::CacheLineSize);
+    static_assert(sizeof(Core::TrivialFunction<void(void)>) == Core::CacheLineSize);
+    static_assert(std::is_trivially_copyable_v<Core::TrivialFunction<void(int)>>);
+    static_assert(!std::is_copy_constructible_v<Core::MoveOnlyFunction<void(void)>>);
+    static_assert(Core::InplaceFunction<void(void), 16>::IsStorable<std::array<char, 16>>);
+    static_assert(!Core::InplaceFunction<void(void), 16>::IsStorable<std::array<char, 17>>);
+    static_assert(!Core::TrivialFunction<void(void)>::IsStorable<std::string>);
+}
+
+TEST(InplaceFunction, Basics)
+{
+    Core::InplaceFunction<int(int, int)> function;
+
+    ASSERT_FALSE(function);
+#ifndef NDEBUG
+    ASSERT_ANY_THROW(function(1, 2));
+#endif
+    function = &Add;
+    ASSERT_TRUE(function);
+    ASSERT_TRUE(function.isTrivial());
+    ASSERT_EQ(function(1, 2), 3);
+    int (*null)(int, int) = nullptr;
+    function = null;
+    ASSERT_FALSE(function);
+    const int offset = 10;
+    function = [offset](const int lhs, const int rhs) { return lhs + rhs + offset; };
+    ASSERT_EQ(function(1, 2), 13);
+    auto copy = function;
+    ASSERT_EQ(copy(0, 0), 10);
+    function = nullptr;
+    ASSERT_FALSE(function);
+    ASSERT_EQ(copy(0, 0), 10);
+}
+
+TEST(InplaceFunction, NonTrivial)
+{
+    {
+        Core::InplaceFunction<int(int)> function = Tracked();
+        ASSERT_EQ(Tracked::Alive, 1);
+        ASSERT_FALSE(function.isTrivial());
+        ASSERT_EQ(function(21), 42);
+        auto copy = function;
+        ASSERT_EQ(Tracked::Alive, 2);
+        auto moved = std::move(function);
+        ASSERT_EQ(Tracked::Alive, 2);
+        ASSERT_FALSE(function);
+        ASSERT_EQ(moved(1), 2);
+        copy = std::move(moved);
+        ASSERT_EQ(Tracked::Alive, 1);
+        copy = [](const int value) { return value; };
+        ASSERT_EQ(Tracked::Alive, 0);
+        ASSERT_EQ(copy(3), 3);
+    }
+    ASSERT_EQ(Tracked::Alive, 0);
+
+    // Captured strings are copied, not shared
+    std::string text(64, 'a');
+    Core::InplaceFunction<std::size_t(void)> function = [text] { return text.size(); };
+    auto copy = function;
+    function = nullptr;
+    ASSERT_EQ(copy(), 64);
+}
+
+TEST(InplaceFunction, MoveOnly)
+{
+    auto value = std::make_unique<int>(42);
+    Core::MoveOnlyFunction<int(int)> function = [value = std::move(value)](const int offset) { return *value + offset; };
+
+    ASSERT_EQ(function(1), 43);
+    Core::Vector<Core::MoveOnlyFunction<int(int)>> functions;
+    functions.push(std::move(function));
+    for (auto i = 0; i < 100; ++i)
+        functions.push([i](const int offset) { return i + offset; });
+    ASSERT_EQ(functions[0](0), 42);
+    ASSERT_EQ(functions[100](1), 100);
+}
+
+TEST(InplaceFunction, Trivial)
+{
+    int counter = 0;
+    Core::TrivialFunction<void(int)> function = [&counter](const int value) { counter += value; };
+
+    function(2);
+    auto copy = function;
+    copy(3);
+    ASSERT_EQ(counter, 5);
+    Core::TrivialFunction<void(int)> raw;
+    std::memcpy(static_cast<void *>(&raw), &function, sizeof(function));
+    raw(5);
+    ASSERT_EQ(counter, 10);
+    raw.reset();
+    ASSERT_FALSE(raw);
+}
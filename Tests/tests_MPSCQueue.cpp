@@ -0,0 +1,88 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the intrusive multiple producers / single consumer queue
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/MPSCQueue.hpp>
+#include <MLCore/NodePool.hpp>
+#include <MLCore/Vector.hpp>
+
+namespace
+{
+    struct Command : Core::MPSCQueueNode
+    {
+        std::uint32_t producer {};
+        std::uint32_t sequence {};
+    };
+}
+
+TEST(MPSCQueue, Basics)
+{
+    Core::MPSCQueue<Command> queue;
+    Command commands[3];
+
+    ASSERT_TRUE(queue.empty());
+    ASSERT_EQ(queue.pop(), nullptr);
+    for (auto i = 0u; i < 3; ++i) {
+        commands[i].sequence = i;
+        queue.push(commands + i);
+    }
+    ASSERT_FALSE(queue.empty());
+    for (auto i = 0u; i < 3; ++i) {
+        const auto command = queue.pop();
+        ASSERT_EQ(command, commands + i);
+    }
+    ASSERT_EQ(queue.pop(), nullptr);
+    ASSERT_TRUE(queue.empty());
+    // Nodes can be pushed again once popped
+    queue.push(commands + 1);
+    queue.push(commands);
+    ASSERT_EQ(queue.pop(), commands + 1);
+    ASSERT_EQ(queue.pop(), commands);
+    ASSERT_EQ(queue.pop(), nullptr);
+}
+
+TEST(MPSCQueue, Producers)
+{
+    constexpr auto ProducerCount = 4u;
+    constexpr auto Count = 50000u;
+    Core::MPSCQueue<Command> queue;
+    Core::NodePool<Command> pool(256);
+    Core::Vector<std::thread> producers;
+
+    producers.reserve(ProducerCount);
+    for (auto p = 0u; p < ProducerCount; ++p) {
+        producers.push([&queue, &pool, p] {
+            for (auto i = 0u; i < Count; ++i) {
+                Command *command;
+                while (!(command = pool.acquire()))
+                    std::this_thread::yield();
+                command->producer = p;
+                command->sequence = i;
+                queue.push(command);
+            }
+        });
+    }
+    // Commands of each producer must come out in order
+    std::uint32_t expected[ProducerCount] {};
+    for (auto received = 0u; received < ProducerCount * Count;) {
+        const auto command = queue.pop();
+        if (!command) {
+            std::this_thread::yield();
+            continue;
+        }
+        ASSERT_EQ(command->sequence, expected[command->producer]);
+        ++expected[command->producer];
+        pool.release(command);
+        ++received;
+    }
+    for (auto &producer : producers)
+        producer.join();
+    ASSERT_EQ(queue.pop(), nullptr);
+    for (const auto count : expected)
+        ASSERT_EQ(count, Count);
+}
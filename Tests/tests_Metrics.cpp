@@ -0,0 +1,129 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the metrics
+ */
+
+#include <algorithm>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/Metrics.hpp>
+
+TEST(Metrics, ShardedCounter)
+{
+    constexpr auto threadCount = 8;
+    constexpr auto count = 10000;
+    Core::ShardedCounter counter;
+    std::thread threads[threadCount];
+
+    for (auto &thread : threads) {
+        thread = std::thread([&counter] {
+            for (auto i = 0; i < count; ++i)
+                counter.increment();
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    ASSERT_EQ(counter.load(), threadCount * count);
+    counter.add(-count);
+    ASSERT_EQ(counter.load(), (threadCount - 1) * count);
+    counter.reset();
+    ASSERT_EQ(counter.load(), 0);
+}
+
+TEST(Metrics, HistogramBuckets)
+{
+    for (auto value = 0ul; value < 100000ul; ++value) {
+        const auto index = Core::Histogram::BucketIndex(value);
+        ASSERT_LE(Core::Histogram::BucketLowerBound(index), value);
+        ASSERT_GE(Core::Histogram::BucketUpperBound(index), value);
+    }
+}
+
+TEST(Metrics, HistogramPercentiles)
+{
+    Core::Histogram histogram;
+
+    for (auto value = 1ul; value <= 1000ul; ++value)
+        histogram.record(value);
+    const auto snapshot = histogram.snapshot();
+    ASSERT_EQ(snapshot.count, 1000);
+    ASSERT_EQ(snapshot.max, 1000);
+    ASSERT_DOUBLE_EQ(snapshot.mean(), 500.5);
+    ASSERT_NEAR(snapshot.percentile(50.0), 500, 500 / Core::Histogram::SubBucketCount);
+    ASSERT_NEAR(snapshot.percentile(99.0), 990, 990 / Core::Histogram::SubBucketCount);
+    ASSERT_EQ(snapshot.percentile(100.0), 1000);
+    histogram.reset();
+    ASSERT_EQ(histogram.snapshot().count, 0);
+}
+
+TEST(Metrics, Registry)
+{
+    auto &registry = Core::MetricsRegistry::Get();
+    {
+        Core::ShardedCounter counter("tests.counter");
+        Core::Histogram histogram("tests.histogram");
+
+        counter.add(42);
+        histogram.record(24);
+        const auto text = registry.dumpText();
+        ASSERT_NE(text.find("tests.counter 42\n"), std::string::npos);
+        ASSERT_NE(text.find("tests.histogram.count 1\n"), std::string::npos);
+        ASSERT_NE(text.find("tests.histogram.max 24\n"), std::string::npos);
+        const auto json = registry.dumpJson();
+        ASSERT_NE(json.find("\"tests.counter\":42"), std::string::npos);
+        ASSERT_NE(json.find("\"tests.histogram\":{\"count\":1,\"sum\":24,\"max\":24"), std::string::npos);
+    }
+    const auto text = registry.dumpText();
+    ASSERT_EQ(text.find("tests.counter"), std::string::npos);
+    ASSERT_EQ(text.find("tests.histogram"), std::string::npos);
+    ASSERT_NE(text.find("core.containers.growths"), std::string::npos);
+}
+
+#ifdef CORE_CONTAINER_METRICS
+TEST(Metrics, ContainerGrowth)
+{
+    auto &registry = Core::MetricsRegistry::Get();
+    const auto growths = registry.containerGrowths().load();
+    const auto allocations = registry.containerAllocations().load();
+    Core::Vector<int> vector;
+
+    for (auto i = 0; i < 5; ++i)
+        vector.push(i);
+    ASSERT_EQ(registry.containerAllocations().load() - allocations, 3);
+    ASSERT_EQ(registry.containerGrowths().load() - growths, 2);
+}
+#endif
+
+#ifdef CORE_CONTAINER_ACCOUNTING
+TEST(Metrics, ContainerAccounting)
+{
+    struct Element { char data[24]; };
+    const auto &account = Core::ContainerMetrics::AccountOf<Core::Internal::VectorBase<Element, std::size_t, Core::MallocAllocator>>();
+
+    {
+        Core::Vector<Element> vector;
+        vector.reserve(100);
+        vector.resize(10);
+        ASSERT_EQ(account.buffers.load(), 1);
+        ASSERT_EQ(account.capacityBytes.load(), 2400);
+        ASSERT_EQ(account.sizeBytes.load(), 240);
+        const auto accounts = Core::MetricsRegistry::Get().containerAccounts();
+        const auto it = std::find_if(accounts.begin(), accounts.end(), [&account](const auto &sample) { return sample.name == account.name; });
+        ASSERT_NE(it, accounts.end());
+        ASSERT_EQ(it->slackBytes(), 2160);
+        ASSERT_NE(Core::MetricsRegistry::Get().dumpContainerAccounts().find("slack 2160"), std::string::npos);
+        vector.shrinkToFit();
+        ASSERT_EQ(account.capacityBytes.load(), 240);
+        // Both buffers are alive while the elements are moved
+        ASSERT_EQ(account.peakCapacityBytes.load(), 2640);
+        vector.insert(vector.begin(), 5, Element {});
+        ASSERT_EQ(account.sizeBytes.load(), 360);
+    }
+    ASSERT_EQ(account.buffers.load(), 0);
+    ASSERT_EQ(account.capacityBytes.load(), 0);
+    ASSERT_EQ(account.sizeBytes.load(), 0);
+    ASSERT_NE(account.name.find("Element"), std::string_view::npos);
+}
+#endif
@@ -0,0 +1,139 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the spin / adaptive mutexes and futex-backed wake-up primitives
+ */
+
+#include <mutex>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/Mutex.hpp>
+#include <MLCore/Vector.hpp>
+
+namespace
+{
+    template<typename Mutex>
+    void TestCounter(void)
+    {
+        constexpr auto ThreadCount = 4u;
+        constexpr auto Count = 20000u;
+        Mutex mutex;
+        std::size_t counter = 0;
+        Core::Vector<std::thread> threads;
+
+        threads.reserve(ThreadCount);
+        for (auto t = 0u; t < ThreadCount; ++t) {
+            threads.push([&mutex, &counter] {
+                for (auto i = 0u; i < Count; ++i) {
+                    std::lock_guard lock(mutex);
+                    ++counter;
+                }
+            });
+        }
+        for (auto &thread : threads)
+            thread.join();
+        ASSERT_EQ(counter, ThreadCount * Count);
+    }
+}
+
+TEST(Mutex, SpinMutex)
+{
+    Core::SpinMutex mutex;
+
+    ASSERT_TRUE(mutex.try_lock());
+    ASSERT_FALSE(mutex.try_lock());
+    mutex.unlock();
+    ASSERT_TRUE(mutex.try_lock());
+    mutex.unlock();
+    TestCounter<Core::SpinMutex>();
+}
+
+TEST(Mutex, AdaptiveMutex)
+{
+    Core::AdaptiveMutex mutex;
+
+    ASSERT_TRUE(mutex.try_lock());
+    ASSERT_FALSE(mutex.try_lock());
+    mutex.unlock();
+    ASSERT_TRUE(mutex.try_lock());
+    mutex.unlock();
+    TestCounter<Core::AdaptiveMutex>();
+
+    // A waiter parked on the futex must be woken by unlock
+    bool acquired = false;
+    mutex.lock();
+    std::thread waiter([&mutex, &acquired] {
+        std::lock_guard lock(mutex);
+        acquired = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    mutex.unlock();
+    waiter.join();
+    ASSERT_TRUE(acquired);
+}
+
+TEST(Mutex, Event)
+{
+    Core::Event event;
+
+    ASSERT_FALSE(event.isSet());
+    event.set();
+    ASSERT_TRUE(event.isSet());
+    event.wait();
+    event.reset();
+    ASSERT_FALSE(event.isSet());
+
+    // Every waiter is released by a single set
+    constexpr auto WaiterCount = 3u;
+    std::atomic<std::uint32_t> released { 0 };
+    Core::Vector<std::thread> waiters;
+    waiters.reserve(WaiterCount);
+    for (auto i = 0u; i < WaiterCount; ++i) {
+        waiters.push([&event, &released] {
+            event.wait();
+            released.fetch_add(1);
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    ASSERT_EQ(released.load(), 0u);
+    event.set();
+    for (auto &waiter : waiters)
+        waiter.join();
+    ASSERT_EQ(released.load(), WaiterCount);
+    ASSERT_TRUE(event.isSet());
+}
+
+TEST(Mutex, Semaphore)
+{
+    Core::Semaphore semaphore(2);
+
+    ASSERT_EQ(semaphore.count(), 2u);
+    ASSERT_TRUE(semaphore.tryAcquire());
+    semaphore.acquire();
+    ASSERT_FALSE(semaphore.tryAcquire());
+    semaphore.release(2);
+    ASSERT_EQ(semaphore.count(), 2u);
+    ASSERT_TRUE(semaphore.tryAcquire());
+    ASSERT_TRUE(semaphore.tryAcquire());
+
+    // Ping-pong between two threads, each token is consumed exactly once
+    constexpr auto Count = 10000u;
+    Core::Semaphore ping, pong;
+    std::size_t value = 0;
+    std::thread other([&] {
+        for (auto i = 0u; i < Count; ++i) {
+            ping.acquire();
+            ++value;
+            pong.release();
+        }
+    });
+    for (auto i = 0u; i < Count; ++i) {
+        ping.release();
+        pong.acquire();
+        ASSERT_EQ(value, i + 1);
+    }
+    other.join();
+    ASSERT_EQ(ping.count(), 0u);
+    ASSERT_EQ(pong.count(), 0u);
+}
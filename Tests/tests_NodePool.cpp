@@ -0,0 +1,75 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the lock-free node pool
+ */
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/NodePool.hpp>
+#include <MLCore/Vector.hpp>
+
+TEST(NodePool, Basics)
+{
+    Core::NodePool<int> pool(3);
+    int *nodes[3];
+
+    ASSERT_EQ(pool.capacity(), 3);
+    for (auto &node : nodes) {
+        node = pool.acquire();
+        ASSERT_NE(node, nullptr);
+        ASSERT_TRUE(pool.owns(node));
+    }
+    ASSERT_EQ(pool.acquire(), nullptr);
+    ASSERT_NE(nodes[0], nodes[1]);
+    ASSERT_NE(nodes[1], nodes[2]);
+    int outside = 0;
+    ASSERT_FALSE(pool.owns(&outside));
+    // Last released node is acquired first and keeps its state
+    *nodes[1] = 42;
+    pool.release(nodes[1]);
+    const auto node = pool.acquire();
+    ASSERT_EQ(node, nodes[1]);
+    ASSERT_EQ(*node, 42);
+    for (auto &node : nodes)
+        pool.release(node);
+    ASSERT_NE(pool.acquire(), nullptr);
+
+    Core::NodePool<int> empty(0);
+    ASSERT_EQ(empty.acquire(), nullptr);
+}
+
+TEST(NodePool, Threads)
+{
+    constexpr auto ThreadCount = 4u;
+    constexpr auto Count = 50000u;
+    Core::NodePool<std::uint32_t> pool(8);
+    Core::Vector<std::thread> threads;
+    std::atomic<bool> failed { false };
+
+    threads.reserve(ThreadCount);
+    for (auto t = 0u; t < ThreadCount; ++t) {
+        threads.push([&pool, &failed, t] {
+            for (auto i = 0u; i < Count; ++i) {
+                std::uint32_t *node;
+                while (!(node = pool.acquire()))
+                    std::this_thread::yield();
+                // No other thread may own the node meanwhile
+                *node = t;
+                std::this_thread::yield();
+                if (*node != t)
+                    failed = true;
+                pool.release(node);
+            }
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    ASSERT_FALSE(failed);
+    std::uint32_t *nodes[8];
+    for (auto &node : nodes)
+        ASSERT_NE(node = pool.acquire(), nullptr);
+    ASSERT_EQ(pool.acquire(), nullptr);
+}
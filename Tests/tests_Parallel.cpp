@@ -0,0 +1,78 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the parallel algorithms
+ */
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/Parallel.hpp>
+#include <MLCore/FlatVector.hpp>
+
+namespace
+{
+    constexpr std::size_t Threshold = 64;
+}
+
+TEST(Parallel, Partition)
+{
+    Core::Vector<float> vector(10007);
+
+    for (const auto chunkCount : { 1ul, 2ul, 3ul, 7ul, 64ul }) {
+        const Core::Parallel::Partition partition(vector.begin() + 1, vector.end(), chunkCount);
+        ASSERT_LE(partition.count(), chunkCount);
+        ASSERT_EQ(partition[0].begin, 0);
+        ASSERT_EQ(partition[partition.count() - 1].end, vector.size() - 1);
+        for (auto i = 1ul; i < partition.count(); ++i) {
+            ASSERT_EQ(partition[i].begin, partition[i - 1].end);
+            ASSERT_LT(partition[i].begin, partition[i].end);
+            ASSERT_EQ(reinterpret_cast<std::uintptr_t>(&vector[partition[i].begin + 1]) % Core::CacheLineSize, 0);
+        }
+    }
+}
+
+TEST(Parallel, ForTransformReduce)
+{
+    Core::ThreadPool pool(4);
+    Core::Vector<int> input(10000);
+    Core::FlatVector<int> output(input.size());
+
+    Core::Parallel::ForIndex(input.size(), [&input](const std::size_t index) { input[index] = static_cast<int>(index); }, pool, Threshold);
+    Core::Parallel::Transform(input.begin(), input.end(), output.begin(), [](const int value) { return value * 2; }, pool, Threshold);
+    for (auto i = 0ul; i < input.size(); ++i)
+        ASSERT_EQ(output[i], i * 2);
+    ASSERT_EQ(Core::Parallel::Reduce(output.begin(), output.end(), 0ll, std::plus<>(), pool, Threshold), 9999ll * 10000);
+    Core::Parallel::For(output.begin(), output.end(), [](int *first, int *last) { std::fill(first, last, 1); }, pool, Threshold);
+    ASSERT_EQ(Core::Parallel::Reduce(output.begin(), output.end(), 5, std::plus<>(), pool, Threshold), 10005);
+}
+
+TEST(Parallel, InclusiveScan)
+{
+    Core::ThreadPool pool(4);
+    Core::Vector<std::size_t> input(12345, 1);
+    Core::Vector<std::size_t> output(input.size());
+
+    Core::Parallel::InclusiveScan(input.begin(), input.end(), output.begin(), std::plus<>(), pool, Threshold);
+    for (auto i = 0ul; i < output.size(); ++i)
+        ASSERT_EQ(output[i], i + 1);
+    // In place
+    Core::Parallel::InclusiveScan(input.begin(), input.end(), input.begin(), std::plus<>(), pool, Threshold);
+    ASSERT_TRUE(std::equal(input.begin(), input.end(), output.begin(), output.end()));
+}
+
+TEST(Parallel, Sort)
+{
+    std::mt19937 engine(42);
+
+    for (const auto threadCount : { 1ul, 2ul, 3ul, 5ul }) {
+        Core::ThreadPool pool(threadCount);
+        Core::Vector<std::uint32_t> values(50001);
+        for (auto &value : values)
+            value = engine();
+        Core::Vector<std::uint32_t> expected(values.begin(), values.end());
+        std::sort(expected.begin(), expected.end(), std::greater<>());
+        Core::Parallel::Sort(values.begin(), values.end(), std::greater<>(), pool, Threshold);
+        ASSERT_TRUE(std::equal(values.begin(), values.end(), expected.begin(), expected.end()));
+    }
+}
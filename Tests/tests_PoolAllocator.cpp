@@ -0,0 +1,148 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the thread-caching pool allocator
+ */
+
+#include <cstring>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/PoolAllocator.hpp>
+#include <MLCore/SPSCQueue.hpp>
+#include <MLCore/UniqueAlloc.hpp>
+#include <MLCore/FlatString.hpp>
+
+using Pool = Core::PoolAllocator;
+
+TEST(PoolAllocator, SizeClasses)
+{
+    ASSERT_EQ(Pool::ClassIndex(0), 0);
+    ASSERT_EQ(Pool::ClassIndex(1), 0);
+    ASSERT_EQ(Pool::ClassIndex(16), 0);
+    ASSERT_EQ(Pool::ClassIndex(17), 1);
+    ASSERT_EQ(Pool::ClassIndex(128), 7);
+    ASSERT_EQ(Pool::ClassSize(Pool::ClassIndex(129)), 160);
+    ASSERT_EQ(Pool::ClassSize(Pool::ClassIndex(256)), 256);
+    ASSERT_EQ(Pool::ClassSize(Pool::ClassIndex(257)), 320);
+    for (auto bytes = 1ul; bytes <= Pool::MaxPooledSize; ++bytes) {
+        const auto size = Pool::ClassSize(Pool::ClassIndex(bytes));
+        ASSERT_GE(size, bytes);
+        // At most 25% of internal fragmentation past the first classes
+        if (bytes > 128) {
+            ASSERT_LE(size, bytes + bytes / 4);
+        }
+        ASSERT_EQ(size % 16, 0);
+    }
+}
+
+TEST(PoolAllocator, Basics)
+{
+    const auto block = Pool::Allocate(100);
+
+    ASSERT_NE(block, nullptr);
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(block) % alignof(std::max_align_t), 0);
+    ASSERT_EQ(Pool::UsableSize(block, 100), 112);
+    std::memset(block, 0xAB, 112);
+    Pool::Deallocate(block, 100);
+    // The last freed block of a class is reused first
+    const auto other = Pool::Allocate(97);
+    ASSERT_EQ(block, other);
+    Pool::Deallocate(other, 97);
+
+    const auto large = Pool::Allocate(Pool::MaxPooledSize + 1);
+    ASSERT_NE(large, nullptr);
+    ASSERT_GE(Pool::UsableSize(large, Pool::MaxPooledSize + 1), Pool::MaxPooledSize + 1);
+    Pool::Deallocate(large, Pool::MaxPooledSize + 1);
+
+    // Many spans of the same class
+    Core::Vector<void *> blocks;
+    for (auto i = 0; i < 10000; ++i) {
+        blocks.push(Pool::Allocate(1024));
+        std::memset(blocks.back(), i, 1024);
+    }
+    for (const auto data : blocks)
+        Pool::Deallocate(data, 1024);
+}
+
+TEST(PoolAllocator, Containers)
+{
+    Core::Vector<int, std::size_t, Core::GrowthPolicy::UsableSize<>, Pool> vector;
+    Core::FlatVector<int, std::size_t, Core::GrowthPolicy::Default, Pool> flatVector;
+    Core::FlatStringBase<char, Core::FlatVector<char, std::size_t, Core::GrowthPolicy::Default, Pool>> string("Pooled");
+    Core::UniqueAlloc<std::string, Core::PoolResource> unique("Unique");
+
+    for (auto i = 0; i < 5000; ++i) {
+        vector.push(i);
+        flatVector.push(i);
+    }
+    for (auto i = 0; i < 5000; ++i) {
+        ASSERT_EQ(vector[i], i);
+        ASSERT_EQ(flatVector[i], i);
+    }
+    string += " string";
+    ASSERT_EQ(string, "Pooled string");
+    ASSERT_EQ(*unique, "Unique");
+}
+
+TEST(PoolAllocator, RemoteFrees)
+{
+    constexpr auto Count = 100000;
+    Core::SPSCQueue<void *> queue(256);
+
+    // Blocks allocated by the producer are freed by the consumer
+    std::thread producer([&queue] {
+        for (auto i = 0; i < Count; ++i) {
+            const auto size = 16ul + static_cast<std::size_t>(i % 64) * 16ul;
+            const auto block = Pool::Allocate(size);
+            std::memset(block, i, size);
+            *reinterpret_cast<std::size_t *>(block) = size;
+            while (!queue.push(block))
+                std::this_thread::yield();
+        }
+    });
+    for (auto i = 0; i < Count; ++i) {
+        void *block;
+        while (!queue.pop(block))
+            std::this_thread::yield();
+        Pool::Deallocate(block, *reinterpret_cast<std::size_t *>(block));
+    }
+    producer.join();
+
+    // The heap of the exited producer is adopted by the next thread, which gets the blocks freed remotely
+    std::thread adopter([] {
+        for (auto i = 0; i < Count; ++i)
+            Pool::Deallocate(Pool::Allocate(64), 64);
+    });
+    adopter.join();
+}
+
+TEST(PoolAllocator, Threads)
+{
+    constexpr auto ThreadCount = 4;
+    constexpr auto Count = 20000;
+    Core::Vector<std::thread> threads;
+
+    for (auto t = 0; t < ThreadCount; ++t) {
+        threads.push([t] {
+            Core::Vector<std::pair<void *, std::size_t>> live;
+            for (auto i = 0; i < Count; ++i) {
+                const auto size = 8ul + static_cast<std::size_t>((i * 7 + t) % 512) * 8ul;
+                const auto block = Pool::Allocate(size);
+                std::memset(block, t, size);
+                live.push(block, size);
+                if (live.size() == 64) {
+                    for (const auto &[data, bytes] : live) {
+                        ASSERT_EQ(*reinterpret_cast<std::uint8_t *>(data), t);
+                        Pool::Deallocate(data, bytes);
+                    }
+                    live.clear();
+                }
+            }
+            for (const auto &[data, bytes] : live)
+                Pool::Deallocate(data, bytes);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+}
@@ -0,0 +1,104 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the radix sort
+ */
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/RadixSort.hpp>
+#include <MLCore/FlatVector.hpp>
+
+template<typename Type, typename Distribution>
+static void TestRadixSort(Distribution distribution, Core::ThreadPool *pool = nullptr)
+{
+    std::mt19937_64 engine(42);
+
+    for (const auto count : { 0ul, 1ul, 63ul, 1000ul, 100000ul }) {
+        Core::Vector<Type> values;
+        for (auto i = 0ul; i < count; ++i)
+            values.push(static_cast<Type>(distribution(engine)));
+        Core::Vector<Type> expected(values.begin(), values.end());
+        std::sort(expected.begin(), expected.end());
+        Core::RadixSort(values.begin(), values.end(), Core::RadixIdentity(), pool);
+        ASSERT_TRUE(std::equal(values.begin(), values.end(), expected.begin(), expected.end()));
+    }
+}
+
+TEST(RadixSort, Integers)
+{
+    TestRadixSort<std::uint8_t>(std::uniform_int_distribution<int>(0, 255));
+    TestRadixSort<std::int16_t>(std::uniform_int_distribution<int>(-30000, 30000));
+    TestRadixSort<std::uint32_t>(std::uniform_int_distribution<std::uint32_t>());
+    TestRadixSort<std::int64_t>(std::uniform_int_distribution<std::int64_t>(std::numeric_limits<std::int64_t>::min()));
+    // Keys with constant high bytes skip passes
+    TestRadixSort<std::uint64_t>(std::uniform_int_distribution<std::uint64_t>(0, 1000));
+}
+
+TEST(RadixSort, Floats)
+{
+    TestRadixSort<float>(std::uniform_real_distribution<float>(-1e6f, 1e6f));
+    TestRadixSort<double>(std::normal_distribution<double>(0.0, 1e3));
+
+    Core::FlatVector<float> values { 3.0f, -0.5f, 0.0f, -std::numeric_limits<float>::infinity(), 1e-30f, -2.0f, std::numeric_limits<float>::infinity() };
+    Core::Vector<float> large;
+    for (auto i = 0; i < 100; ++i)
+        large.append(values.begin(), values.end());
+    Core::RadixSort(large.begin(), large.end());
+    ASSERT_TRUE(std::is_sorted(large.begin(), large.end()));
+    ASSERT_EQ(large.front(), -std::numeric_limits<float>::infinity());
+    ASSERT_EQ(large.back(), std::numeric_limits<float>::infinity());
+}
+
+TEST(RadixSort, StableKeyExtractor)
+{
+    struct Event
+    {
+        std::uint32_t timestamp;
+        std::uint32_t order;
+    };
+
+    Core::ThreadPool pool(4);
+    std::mt19937 engine(7);
+    Core::Vector<Event> events;
+
+    for (auto i = 0u; i < 50000u; ++i)
+        events.push(Event { static_cast<std::uint32_t>(engine() % 512), i });
+    Core::RadixSort(events.begin(), events.end(), [](const Event &event) { return event.timestamp; }, &pool);
+    for (auto i = 1ul; i < events.size(); ++i) {
+        ASSERT_LE(events[i - 1].timestamp, events[i].timestamp);
+        if (events[i - 1].timestamp == events[i].timestamp) {
+            ASSERT_LT(events[i - 1].order, events[i].order);
+        }
+    }
+}
+
+TEST(RadixSort, DefaultMemberInitializers)
+{
+    struct Event
+    {
+        std::uint32_t timestamp {};
+        std::int32_t value {};
+    };
+
+    std::mt19937 engine(3);
+    Core::Vector<Event> events;
+
+    for (auto i = 0; i < 1000; ++i)
+        events.push(Event { static_cast<std::uint32_t>(engine() % 100000), i });
+    Core::RadixSort(events.begin(), events.end(), [](const Event &event) { return event.timestamp; });
+    for (auto i = 1ul; i < events.size(); ++i) {
+        ASSERT_LE(events[i - 1].timestamp, events[i].timestamp);
+        if (events[i - 1].timestamp == events[i].timestamp) {
+            ASSERT_LT(events[i - 1].value, events[i].value);
+        }
+    }
+}
+
+TEST(RadixSort, ParallelHistogram)
+{
+    Core::ThreadPool pool(3);
+
+    TestRadixSort<std::int32_t>(std::uniform_int_distribution<std::int32_t>(std::numeric_limits<std::int32_t>::min()), &pool);
+}
@@ -0,0 +1,49 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the single producer / single consumer queue
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/SPSCQueue.hpp>
+
+TEST(SPSCQueue, Basics)
+{
+    Core::SPSCQueue<int> queue(3);
+    int value = 0;
+
+    ASSERT_EQ(queue.capacity(), 4);
+    ASSERT_TRUE(queue.empty());
+    ASSERT_FALSE(queue.pop(value));
+    for (auto i = 0; i < 4; ++i)
+        ASSERT_TRUE(queue.push(i));
+    ASSERT_FALSE(queue.push(4));
+    ASSERT_EQ(queue.size(), 4);
+    for (auto i = 0; i < 4; ++i) {
+        ASSERT_TRUE(queue.pop(value));
+        ASSERT_EQ(value, i);
+    }
+    ASSERT_FALSE(queue.pop(value));
+}
+
+TEST(SPSCQueue, Threads)
+{
+    constexpr auto Count = 200000;
+    Core::SPSCQueue<int> queue(64);
+    std::thread producer([&queue] {
+        for (auto i = 0; i < Count; ++i) {
+            while (!queue.push(i))
+                std::this_thread::yield();
+        }
+    });
+
+    for (auto i = 0; i < Count; ++i) {
+        int value;
+        while (!queue.pop(value))
+            std::this_thread::yield();
+        ASSERT_EQ(value, i);
+    }
+    producer.join();
+}
@@ -0,0 +1,199 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the copy-on-write flat vector
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/SharedFlatVector.hpp>
+#include <MLCore/FlatString.hpp>
+
+namespace
+{
+    /** @brief Allocator counting its allocations */
+    struct CountingAllocator : public Core::MallocAllocator
+    {
+        static inline std::size_t Allocations = 0;
+
+        [[nodiscard]] static void *Allocate(const std::size_t bytes) noexcept { ++Allocations; return Core::MallocAllocator::Allocate(bytes); }
+    };
+}
+
+TEST(SharedFlatVector, Basics)
+{
+    constexpr auto count = 42ul;
+    Core::SharedFlatVector<std::size_t> vector;
+
+    ASSERT_FALSE(vector);
+    ASSERT_EQ(vector.useCount(), 0);
+    for (auto i = 0ul; i < count; ++i)
+        vector.push(i);
+    ASSERT_EQ(vector.size(), count);
+    ASSERT_EQ(vector.useCount(), 1);
+    ASSERT_FALSE(vector.isShared());
+    vector.release();
+    ASSERT_FALSE(vector);
+    vector.push(1ul);
+    ASSERT_EQ(vector.size(), 1);
+}
+
+TEST(SharedFlatVector, CopyOnWrite)
+{
+    constexpr auto count = 42ul;
+    Core::SharedFlatVector<std::string> vector(count, "value");
+    const auto *data = std::as_const(vector).data();
+
+    auto copy = vector;
+    ASSERT_TRUE(vector.isShared());
+    ASSERT_EQ(vector.useCount(), 2);
+    ASSERT_EQ(std::as_const(copy).data(), data);
+    {
+        Core::SharedFlatVector<std::string> other;
+        other = copy;
+        ASSERT_EQ(vector.useCount(), 3);
+    }
+    ASSERT_EQ(vector.useCount(), 2);
+
+    copy[0] = "modified";
+    ASSERT_FALSE(vector.isShared());
+    ASSERT_FALSE(copy.isShared());
+    ASSERT_EQ(std::as_const(vector).data(), data);
+    ASSERT_NE(std::as_const(copy).data(), data);
+    ASSERT_EQ(vector[0], "value");
+    ASSERT_EQ(copy[0], "modified");
+    ASSERT_EQ(copy.size(), count);
+    for (auto i = 1ul; i < count; ++i)
+        ASSERT_EQ(copy[i], "value");
+
+    auto copy2 = vector;
+    copy2.push("pushed");
+    ASSERT_EQ(vector.size(), count);
+    ASSERT_EQ(copy2.size(), count + 1);
+    ASSERT_EQ(copy2.back(), "pushed");
+
+    auto copy3 = vector;
+    copy3.clear();
+    ASSERT_TRUE(copy3.empty());
+    ASSERT_EQ(vector.size(), count);
+    ASSERT_EQ(vector.useCount(), 1);
+}
+
+TEST(SharedFlatVector, OverwriteShared)
+{
+    using Vector = Core::SharedFlatVector<int, std::size_t, Core::GrowthPolicy::Default, CountingAllocator>;
+    const Vector vector(100, 42);
+    const auto *data = vector.data();
+    const int values[] { 1, 2, 3 };
+
+    // Overwriting a shared copy allocates its new buffer without cloning the shared one
+    auto copy = vector;
+    CountingAllocator::Allocations = 0;
+    copy.resize(std::begin(values), std::end(values));
+    ASSERT_EQ(CountingAllocator::Allocations, 1);
+    ASSERT_EQ(copy.capacity(), 3);
+    ASSERT_EQ(copy.size(), 3);
+    ASSERT_EQ(copy[2], 3);
+    copy = vector;
+    copy.resize(10, 7);
+    ASSERT_EQ(CountingAllocator::Allocations, 2);
+    ASSERT_EQ(copy.capacity(), 10);
+    ASSERT_EQ(copy.back(), 7);
+    copy = vector;
+    copy.resize(5);
+    ASSERT_EQ(CountingAllocator::Allocations, 3);
+    ASSERT_EQ(copy.capacity(), 5);
+    ASSERT_EQ(copy.size(), 5);
+    // Reserving on a shared copy clones straight into the new capacity
+    copy = vector;
+    ASSERT_FALSE(copy.reserve(50));
+    ASSERT_TRUE(copy.isShared());
+    ASSERT_TRUE(copy.reserve(200));
+    ASSERT_EQ(CountingAllocator::Allocations, 4);
+    ASSERT_EQ(copy.capacity(), 200);
+    ASSERT_EQ(copy.size(), 100);
+    ASSERT_EQ(copy[99], 42);
+    // The other instance keeps its buffer untouched
+    ASSERT_EQ(vector.useCount(), 1);
+    ASSERT_EQ(vector.data(), data);
+    ASSERT_EQ(vector.size(), 100);
+    for (const auto elem : vector)
+        ASSERT_EQ(elem, 42);
+}
+
+TEST(SharedFlatVector, ShrinkShared)
+{
+    using Vector = Core::SharedFlatVector<int, std::size_t, Core::GrowthPolicy::Default, CountingAllocator>;
+    Vector vector;
+
+    vector.reserve(64);
+    for (auto i = 0; i < 10; ++i)
+        vector.push(i);
+    const auto *data = std::as_const(vector).data();
+    auto copy = vector;
+    // Shrinking a shared copy clones straight into the exact size
+    CountingAllocator::Allocations = 0;
+    ASSERT_TRUE(copy.shrinkToFit());
+    ASSERT_EQ(CountingAllocator::Allocations, 1);
+    ASSERT_EQ(copy.capacity(), 10);
+    ASSERT_EQ(std::as_const(copy)[9], 9);
+    ASSERT_EQ(vector.useCount(), 1);
+    ASSERT_EQ(vector.capacity(), 64);
+    ASSERT_EQ(std::as_const(vector).data(), data);
+    // An empty shared copy only drops the buffer
+    Vector empty;
+    empty.reserve(8);
+    auto emptyCopy = empty;
+    CountingAllocator::Allocations = 0;
+    ASSERT_TRUE(emptyCopy.shrinkToFit());
+    ASSERT_FALSE(emptyCopy);
+    ASSERT_EQ(CountingAllocator::Allocations, 0);
+    ASSERT_EQ(empty.useCount(), 1);
+    ASSERT_EQ(empty.capacity(), 8);
+}
+
+TEST(SharedFlatVector, Threads)
+{
+    constexpr auto threadCount = 4;
+    Core::SharedFlatVector<int> vector(1000, 42);
+    std::thread threads[threadCount];
+
+    for (auto &thread : threads) {
+        thread = std::thread([copy = vector]() mutable {
+            for (auto i = 0; i < 100; ++i) {
+                auto local = copy;
+                local[0] = i;
+                ASSERT_EQ(local[0], i);
+            }
+            copy.push(0);
+        });
+    }
+    for (auto &thread : threads)
+        thread.join();
+    ASSERT_EQ(vector.useCount(), 1);
+    ASSERT_EQ(vector.size(), 1000);
+    for (const auto elem : std::as_const(vector))
+        ASSERT_EQ(elem, 42);
+}
+
+TEST(SharedFlatVector, String)
+{
+    static_assert(sizeof(Core::SharedFlatString) == sizeof(void *), "SharedFlatString must be pointer-sized");
+    Core::SharedFlatString str("hello world");
+    const auto copy = str;
+
+    ASSERT_EQ(str.useCount(), 2);
+    ASSERT_EQ(copy, "hello world");
+    str += " !";
+    ASSERT_EQ(str, "hello world !");
+    ASSERT_EQ(copy, "hello world");
+    ASSERT_EQ(copy.useCount(), 1);
+
+    // Assigning a new value drops the shared buffer
+    auto snapshot = copy;
+    snapshot = "preset";
+    ASSERT_EQ(snapshot, "preset");
+    ASSERT_EQ(copy, "hello world");
+    ASSERT_EQ(copy.useCount(), 1);
+}
@@ -0,0 +1,81 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the slot map
+ */
+
+#include <random>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/SlotMap.hpp>
+#include <MLCore/FlatString.hpp>
+
+TEST(SlotMap, Basics)
+{
+    Core::SlotMap<Core::FlatString> map;
+    const Core::SlotMap<Core::FlatString>::Handle null;
+
+    ASSERT_TRUE(null.isNull());
+    ASSERT_FALSE(map.contains(null));
+    const auto a = map.insert("a");
+    const auto b = map.insert("b");
+    const auto c = map.insert("c");
+    ASSERT_FALSE(a.isNull());
+    ASSERT_EQ(map.size(), 3);
+    ASSERT_EQ(map[a], "a");
+    ASSERT_EQ(*map.get(b), "b");
+    ASSERT_TRUE(map.erase(a));
+    ASSERT_FALSE(map.erase(a));
+    ASSERT_FALSE(map.contains(a));
+    ASSERT_EQ(map.get(a), nullptr);
+    // 'c' was moved in place of 'a'
+    ASSERT_EQ(map.size(), 2);
+    ASSERT_EQ(map.data()[0], "c");
+    ASSERT_EQ(map.handleAt(0), c);
+    ASSERT_EQ(map[c], "c");
+    ASSERT_EQ(map[b], "b");
+    // The slot of 'a' is reused with another generation
+    const auto d = map.insert("d");
+    ASSERT_EQ(d.index, a.index);
+    ASSERT_NE(d, a);
+    ASSERT_FALSE(map.contains(a));
+    ASSERT_EQ(map[d], "d");
+    ASSERT_EQ(decltype(d)::FromValue(d.value()), d);
+    map.clear();
+    ASSERT_TRUE(map.empty());
+    ASSERT_FALSE(map.contains(b) || map.contains(c) || map.contains(d));
+}
+
+TEST(SlotMap, Random)
+{
+    Core::SlotMap<int> map;
+    std::vector<std::pair<Core::SlotMap<int>::Handle, int>> alive;
+    std::vector<Core::SlotMap<int>::Handle> dead;
+    std::mt19937 engine(42);
+
+    for (auto i = 0; i < 20000; ++i) {
+        if (alive.empty() || engine() % 3) {
+            alive.emplace_back(map.insert(i), i);
+        } else {
+            const auto index = engine() % alive.size();
+            ASSERT_TRUE(map.erase(alive[index].first));
+            dead.push_back(alive[index].first);
+            alive[index] = alive.back();
+            alive.pop_back();
+        }
+    }
+    ASSERT_EQ(map.size(), alive.size());
+    for (const auto &[handle, value] : alive)
+        ASSERT_EQ(map[handle], value);
+    for (const auto handle : dead)
+        ASSERT_FALSE(map.contains(handle));
+    for (auto i = 0ul; i < map.size(); ++i)
+        ASSERT_EQ(map[map.handleAt(i)], map.data()[i]);
+    long sum = 0;
+    for (const auto value : map)
+        sum += value;
+    long expected = 0;
+    for (const auto &pair : alive)
+        expected += pair.second;
+    ASSERT_EQ(sum, expected);
+}
@@ -0,0 +1,128 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the RCU-style snapshot pointer
+ */
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/Snapshot.hpp>
+
+namespace
+{
+    std::atomic<std::size_t> Destroyed { 0 };
+
+    struct Routing
+    {
+        Routing(const std::size_t value_) noexcept : value(value_), twice(value_ * 2) {}
+        ~Routing(void) noexcept { Destroyed.fetch_add(1, std::memory_order_relaxed); }
+
+        std::size_t value;
+        std::size_t twice;
+    };
+}
+
+TEST(Snapshot, Basics)
+{
+    Destroyed = 0;
+    {
+        Core::Snapshot<Routing, 2> snapshot(std::make_unique<Routing>(1));
+        auto reader = snapshot.registerReader();
+
+        ASSERT_TRUE(reader.valid());
+        ASSERT_EQ(reader->value, 1);
+        const auto *previous = reader.get();
+        snapshot.emplace(2);
+        // The reader has not been quiescent since the publication, the previous version is still alive
+        ASSERT_EQ(snapshot.retiredCount(), 1);
+        ASSERT_EQ(previous->value, 1);
+        ASSERT_EQ(reader->value, 2);
+        ASSERT_EQ(snapshot.reclaim(), 0);
+        reader.quiescent();
+        ASSERT_EQ(snapshot.reclaim(), 1);
+        ASSERT_EQ(Destroyed.load(), 1);
+        ASSERT_EQ(snapshot.retiredCount(), 0);
+
+        // Offline readers don't block reclamation
+        reader.offline();
+        snapshot.emplace(3);
+        ASSERT_EQ(snapshot.retiredCount(), 0);
+        ASSERT_EQ(Destroyed.load(), 2);
+        reader.online();
+        ASSERT_EQ(reader->value, 3);
+        ASSERT_EQ(snapshot.current()->value, 3);
+    }
+    ASSERT_EQ(Destroyed.load(), 3);
+}
+
+TEST(Snapshot, Readers)
+{
+    Core::Snapshot<Routing, 2> snapshot;
+    auto first = snapshot.registerReader();
+    auto second = snapshot.registerReader();
+
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    ASSERT_EQ(first.get(), nullptr);
+    ASSERT_FALSE(snapshot.registerReader());
+    {
+        auto moved = std::move(second);
+        ASSERT_FALSE(second);
+        ASSERT_TRUE(moved);
+    }
+    auto third = snapshot.registerReader();
+    ASSERT_TRUE(third);
+
+    // Every online reader must be quiescent before a version is reclaimed
+    snapshot.emplace(1);
+    snapshot.emplace(2);
+    ASSERT_EQ(snapshot.retiredCount(), 1);
+    first.quiescent();
+    ASSERT_EQ(snapshot.reclaim(), 0);
+    third.quiescent();
+    ASSERT_EQ(snapshot.reclaim(), 1);
+}
+
+TEST(Snapshot, Threads)
+{
+    constexpr auto ReaderCount = 2u;
+    constexpr auto VersionCount = 2000u;
+
+    Destroyed = 0;
+    {
+        Core::Snapshot<Routing> snapshot(std::make_unique<Routing>(0));
+        std::atomic<bool> stop { false };
+        std::atomic<std::size_t> failures { 0 };
+        Core::Vector<std::thread> readers;
+
+        readers.reserve(ReaderCount);
+        for (auto i = 0u; i < ReaderCount; ++i) {
+            readers.push([&snapshot, &stop, &failures] {
+                auto reader = snapshot.registerReader();
+                std::size_t last = 0;
+                while (!stop.load(std::memory_order_relaxed)) {
+                    // Versions are never observed torn nor going backward
+                    const auto &routing = *reader;
+                    if (routing.twice != routing.value * 2 || routing.value < last)
+                        failures.fetch_add(1, std::memory_order_relaxed);
+                    last = routing.value;
+                    reader.quiescent();
+                }
+            });
+        }
+        for (auto i = 1u; i <= VersionCount; ++i) {
+            snapshot.emplace(i);
+            if (i % 64 == 0)
+                std::this_thread::yield();
+        }
+        stop = true;
+        for (auto &reader : readers)
+            reader.join();
+        ASSERT_EQ(failures.load(), 0);
+        snapshot.reclaim();
+        ASSERT_EQ(snapshot.retiredCount(), 0);
+        ASSERT_EQ(Destroyed.load(), VersionCount);
+    }
+    ASSERT_EQ(Destroyed.load(), VersionCount + 1);
+}
@@ -0,0 +1,48 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the constexpr fixed-capacity string
+ */
+
+#include <gtest/gtest.h>
+
+#include <MLCore/StaticString.hpp>
+
+namespace
+{
+    constexpr Core::StaticStringBase Saw("Saw");
+    constexpr Core::StaticVector<Core::StaticString<8>, 4> WaveformNames { "Sine", "Saw", "Square", "Triangle" };
+
+    static_assert(Saw.capacity() == 3);
+    static_assert(Saw == "Saw");
+    static_assert(WaveformNames[1] == Saw);
+    static_assert(WaveformNames[3].toStdView() == "Triangle");
+
+    constexpr auto BuildName(void)
+    {
+        Core::StaticString<16> name("Osc");
+        name += ' ';
+        name += std::string_view("2");
+        name.append(Core::StaticStringBase(" (fine)"));
+        return name;
+    }
+
+    static_assert(BuildName() == "Osc 2 (fine)");
+}
+
+TEST(StaticString, Basics)
+{
+    Core::StaticString<16> string;
+
+    ASSERT_TRUE(string.empty());
+    string = "hello";
+    ASSERT_EQ(string.size(), 5);
+    ASSERT_TRUE(string == "hello");
+    string += " world";
+    ASSERT_EQ(string.toStdView(), "hello world");
+    ASSERT_EQ(string.toStdString(), std::string("hello world"));
+    string = static_cast<const char *>(nullptr);
+    ASSERT_TRUE(string.empty());
+#ifndef NDEBUG
+    ASSERT_ANY_THROW(string = "a string longer than sixteen characters");
+#endif
+}
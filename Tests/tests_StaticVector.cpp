@@ -0,0 +1,113 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the constexpr fixed-capacity vector
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/StaticVector.hpp>
+
+namespace
+{
+    /** @brief MIDI note to frequency table built at compile time (12-TET, A4 = 440 Hz) */
+    constexpr auto MidiFrequencies = [] {
+        constexpr double Semitone = 1.0594630943592953;
+        Core::StaticVector<float, 128> table;
+        double frequency = 440.0;
+
+        for (auto i = 0; i < 69; ++i)
+            frequency /= Semitone;
+        for (auto i = 0; i < 128; ++i) {
+            table.push(static_cast<float>(frequency));
+            frequency *= Semitone;
+        }
+        return table;
+    }();
+
+    static_assert(MidiFrequencies.full());
+    static_assert(MidiFrequencies[69] > 439.99f && MidiFrequencies[69] < 440.01f);
+    static_assert(MidiFrequencies[81] > 879.99f && MidiFrequencies[81] < 880.01f);
+    static_assert(sizeof(Core::StaticVector<std::uint8_t, 255>::Range) == 1);
+    static_assert(sizeof(Core::StaticVector<std::uint8_t, 256>::Range) == 2);
+
+    /** @brief Compile-time check of the mutating interface */
+    constexpr bool ConstexprModifiers(void)
+    {
+        Core::StaticVector<int, 16> vector { 1, 2, 3 };
+
+        vector.insert(vector.begin() + 1, { 10, 11 });
+        vector.insert(vector.end(), 2, 7);
+        vector.append({ 8, 9 });
+        vector.erase(vector.begin());
+        vector.eraseUnordered(vector.begin());
+        vector.removeIf([](const int value) { return value == 7; });
+        vector.pop();
+        const Core::StaticVector<int, 8> expected { 9, 11, 2, 3 };
+        return vector == expected && vector.size() == 4 && vector.data()[4] == 0;
+    }
+
+    static_assert(ConstexprModifiers());
+}
+
+TEST(StaticVector, Basics)
+{
+    Core::StaticVector<int, 4> vector;
+
+    ASSERT_TRUE(vector.empty());
+    ASSERT_FALSE(vector);
+    ASSERT_EQ(vector.capacity(), 4);
+    for (auto i = 0; i < 4; ++i)
+        ASSERT_EQ(vector.push(i), i);
+    ASSERT_TRUE(vector.full());
+    ASSERT_EQ(vector.front(), 0);
+    ASSERT_EQ(vector.back(), 3);
+    ASSERT_EQ(vector.toSpan().size(), 4);
+#ifndef NDEBUG
+    ASSERT_ANY_THROW(vector.push(4));
+    ASSERT_ANY_THROW(vector.resize(5));
+    ASSERT_ANY_THROW(vector.append({ 1 }));
+#endif
+    vector.pop();
+    ASSERT_EQ(vector.size(), 3);
+    vector.clear();
+    ASSERT_TRUE(vector.empty());
+}
+
+TEST(StaticVector, Resize)
+{
+    Core::StaticVector<int, 8> vector(3, 42);
+
+    ASSERT_EQ(vector.size(), 3);
+    ASSERT_EQ(vector[2], 42);
+    vector.resize(5);
+    ASSERT_EQ(vector.size(), 5);
+    for (const auto value : vector)
+        ASSERT_EQ(value, 0);
+    const int values[] { 4, 5, 6 };
+    vector.resize(std::begin(values), std::end(values));
+    ASSERT_EQ(vector.size(), 3);
+    ASSERT_EQ(vector[0], 4);
+    ASSERT_EQ(vector.data()[3], 0);
+}
+
+TEST(StaticVector, NonTrivial)
+{
+    Core::StaticVector<std::string, 8> vector { "a", "b", "c" };
+
+    vector.insert(vector.begin(), { "z" });
+    ASSERT_EQ(vector.size(), 4);
+    ASSERT_EQ(vector[0], "z");
+    ASSERT_EQ(vector[3], "c");
+    vector.erase(vector.begin() + 1, 2);
+    ASSERT_EQ(vector.size(), 2);
+    ASSERT_EQ(vector[1], "c");
+    // Erased slots are reset and release their resources
+    ASSERT_TRUE(vector.data()[2].empty());
+    ASSERT_TRUE(vector.data()[3].empty());
+    ASSERT_EQ(vector.removeIf([](const std::string &value) { return value == "z"; }), 1);
+    ASSERT_EQ(vector.front(), "c");
+    auto copy = vector;
+    ASSERT_TRUE(copy == vector);
+}
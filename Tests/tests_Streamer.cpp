@@ -0,0 +1,126 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the asynchronous file streamer
+ */
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/Streamer.hpp>
+
+namespace
+{
+    /** @brief Temporary file filled with a known pattern */
+    struct TemporaryFile
+    {
+        std::filesystem::path path;
+
+        explicit TemporaryFile(const std::size_t size)
+            : path(std::filesystem::temp_directory_path() / ("MLCoreStreamer" + std::to_string(::getpid()) + ".bin"))
+        {
+            std::ofstream file(path, std::ios::binary);
+            for (auto i = 0ul; i < size; ++i)
+                file.put(Pattern(i));
+        }
+
+        ~TemporaryFile(void) { std::filesystem::remove(path); }
+
+        static char Pattern(const std::uint64_t offset) { return static_cast<char>((offset * 31) ^ (offset >> 9)); }
+    };
+
+    /** @brief Consume the stream until its end, checking the content, returns the number of bytes */
+    std::uint64_t Consume(Core::Streamer &streamer, std::uint64_t expectedOffset)
+    {
+        const auto begin = expectedOffset;
+
+        while (!streamer.endOfStream()) {
+            const auto block = streamer.acquire();
+            if (!block) {
+                std::this_thread::yield();
+                continue;
+            }
+            EXPECT_EQ(block->offset, expectedOffset);
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(block->data) % Core::Streamer::BlockAlignment, 0);
+            for (auto i = 0ul; i < block->size; ++i) {
+                if (static_cast<char>(block->data[i]) != TemporaryFile::Pattern(block->offset + i)) {
+                    ADD_FAILURE() << "Invalid byte at " << block->offset + i;
+                    break;
+                }
+            }
+            expectedOffset += block->size;
+            streamer.release(block);
+        }
+        return expectedOffset - begin;
+    }
+}
+
+TEST(Streamer, Sequential)
+{
+    constexpr std::size_t Size = 1000000;
+    TemporaryFile file(Size);
+    Core::Streamer streamer(Core::Streamer::Config { 10000, 3 });
+
+    ASSERT_EQ(streamer.config().blockSize, 12288);
+    ASSERT_FALSE(streamer.open("/nonexistent/MLCoreStreamer"));
+    ASSERT_TRUE(streamer.open(file.path.c_str()));
+    ASSERT_EQ(streamer.fileSize(), Size);
+    ASSERT_EQ(Consume(streamer, 0), Size);
+    ASSERT_FALSE(streamer.failed());
+    // Reopen from an offset
+    ASSERT_TRUE(streamer.open(file.path.c_str(), 5000));
+    ASSERT_EQ(Consume(streamer, 4096), Size - 4096);
+    streamer.close();
+    ASSERT_FALSE(streamer.isOpen());
+}
+
+TEST(Streamer, Seek)
+{
+    constexpr std::size_t Size = 300000;
+    TemporaryFile file(Size);
+    Core::Streamer streamer(Core::Streamer::Config { 4096, 4 });
+
+    ASSERT_TRUE(streamer.open(file.path.c_str()));
+    // Consume a few blocks then jump
+    for (auto consumed = 0; consumed < 3;) {
+        if (const auto block = streamer.acquire(); block) {
+            streamer.release(block);
+            ++consumed;
+        }
+    }
+    streamer.seek(200000);
+    ASSERT_EQ(Consume(streamer, 200000 & ~4095ul), Size - (200000 & ~4095ul));
+    streamer.seek(0);
+    ASSERT_EQ(Consume(streamer, 0), Size);
+}
+
+TEST(Streamer, SeekPastEnd)
+{
+    constexpr std::size_t Size = 50000;
+    TemporaryFile file(Size);
+    Core::Streamer streamer(Core::Streamer::Config { 4096, 3 });
+
+    ASSERT_TRUE(streamer.open(file.path.c_str()));
+    // Keep releasing blocks while the I/O thread repeatedly hits the end of the file
+    for (auto i = 0; i < 200; ++i) {
+        streamer.seek(i % 2 ? Size + 8192 : Size - 4096);
+        for (auto j = 0; j < 4; ++j) {
+            if (const auto block = streamer.acquire(); block)
+                streamer.release(block);
+            std::this_thread::yield();
+        }
+    }
+    streamer.seek(Size * 2);
+    while (!streamer.endOfStream()) {
+        if (const auto block = streamer.acquire(); block)
+            streamer.release(block);
+        std::this_thread::yield();
+    }
+    // Every block must still be in the pool, none lost nor duplicated
+    streamer.seek(0);
+    ASSERT_EQ(Consume(streamer, 0), Size);
+    ASSERT_FALSE(streamer.failed());
+}
@@ -0,0 +1,72 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the string builder
+ */
+
+#include <gtest/gtest.h>
+
+#include <MLCore/StringBuilder.hpp>
+
+namespace
+{
+    template<typename Value>
+    concept AppendableNumber = requires(Core::StringBuilder &builder, const Value value) { builder.appendNumber(value); };
+
+    static_assert(AppendableNumber<int> && AppendableNumber<char> && AppendableNumber<double>);
+    static_assert(!AppendableNumber<bool>, "bool must not be appended as a number");
+}
+
+TEST(StringBuilder, Basics)
+{
+    Core::StringBuilder builder;
+
+    builder.append("Track ").appendNumber(12).append(" - Gain ").appendNumber(-6.0f, 1).append(" dB");
+    ASSERT_EQ(builder.view(), "Track 12 - Gain -6.0 dB");
+    const auto str = builder.finish();
+    ASSERT_EQ(str, "Track 12 - Gain -6.0 dB");
+    ASSERT_EQ(str.capacity(), str.size());
+    builder.clear();
+    ASSERT_TRUE(builder.empty());
+    builder += Core::FlatString("a");
+    builder += 'b';
+    builder += std::string_view("c");
+    builder.appendNumber(0.25);
+    builder.appendNumber(std::numeric_limits<std::int64_t>::min());
+    builder.appendNumber(std::numeric_limits<std::uint64_t>::max());
+    ASSERT_EQ(builder.view(), "abc0.25-922337203685477580818446744073709551615");
+}
+
+TEST(StringBuilder, Spill)
+{
+    Core::StringBuilderBase<8> builder;
+    std::string expected;
+
+    for (auto i = 0; i < 1000; ++i) {
+        builder.appendNumber(i).append(',');
+        expected += std::to_string(i) + ',';
+    }
+    ASSERT_EQ(builder.view(), expected);
+    ASSERT_EQ(builder.finish(), expected);
+    builder.clear();
+    builder.appendNumber(1e300, 2);
+    ASSERT_EQ(builder.size(), 304);
+}
+
+TEST(StringBuilder, SelfAppend)
+{
+    Core::StringBuilderBase<8> builder;
+    std::string expected("abcdefabcdef");
+
+    builder.append("abcdef");
+    // Spills to the heap while appending its own content
+    builder.append(builder.view());
+    ASSERT_EQ(builder.view(), expected);
+    // Grows on the heap while appending a part of its own content
+    for (auto i = 0; i < 4; ++i) {
+        builder.append(builder.view().substr(6));
+        expected += expected.substr(6);
+    }
+    ASSERT_EQ(builder.view(), expected);
+    builder.append(std::string_view());
+    ASSERT_EQ(builder.size(), expected.size());
+}
@@ -0,0 +1,136 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of coroutine tasks
+ */
+
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/Task.hpp>
+
+using namespace Core;
+
+namespace
+{
+    Task<int> Value(const int value)
+    {
+        co_return value;
+    }
+
+    Task<int> Sum(const int count)
+    {
+        int sum = 0;
+        for (auto i = 0; i < count; ++i)
+            sum += co_await Value(i);
+        co_return sum;
+    }
+
+    Task<int> Depth(const int depth)
+    {
+        if (!depth)
+            co_return 0;
+        co_return co_await Depth(depth - 1) + 1;
+    }
+
+    Task<void> Throw(void)
+    {
+        throw std::runtime_error("Task failure");
+        co_return;
+    }
+
+    Task<int> Work(Executor &executor, const int value)
+    {
+        co_await executor.schedule();
+        co_return value * 2;
+    }
+
+    Task<void> Increment(Executor &executor, std::atomic<int> &counter)
+    {
+        co_await executor.schedule();
+        ++counter;
+    }
+}
+
+TEST(Task, Basics)
+{
+    auto task = Value(42);
+
+    ASSERT_TRUE(task.valid());
+    ASSERT_FALSE(task.done());
+    ASSERT_EQ(SyncWait(std::move(task)), 42);
+    ASSERT_FALSE(task.valid());
+    ASSERT_EQ(SyncWait(Sum(10000)), 9999 * 10000 / 2);
+    // Nested tasks start and complete with symmetric transfer
+    ASSERT_EQ(SyncWait(Depth(10000)), 10000);
+}
+
+TEST(Task, Exception)
+{
+    ASSERT_THROW(SyncWait(Throw()), std::runtime_error);
+    ASSERT_THROW(SyncWait(WhenAll(Value(1), Throw())), std::runtime_error);
+}
+
+TEST(Task, Move)
+{
+    auto task = Value(1);
+    Task<int> other;
+
+    other = std::move(task);
+    ASSERT_FALSE(task.valid());
+    ASSERT_EQ(SyncWait(std::move(other)), 1);
+    // Destroying a task that never started releases its frame
+    auto unused = Value(2);
+    static_cast<void>(unused);
+}
+
+TEST(Task, WhenAll)
+{
+    PoolExecutor executor(4);
+    std::atomic<int> counter { 0 };
+    auto [a, b, c] = SyncWait(WhenAll(Work(executor, 1), Value(5), Increment(executor, counter)));
+
+    ASSERT_EQ(a, 2);
+    ASSERT_EQ(b, 5);
+    ASSERT_EQ(c, std::monostate {});
+    ASSERT_EQ(counter, 1);
+    ASSERT_EQ(std::get<0>(SyncWait(WhenAll(Value(3)))), 3);
+}
+
+TEST(Task, WhenAllVector)
+{
+    constexpr auto Count = 1000;
+    PoolExecutor executor(4);
+    Vector<Task<int>> tasks;
+    Vector<Task<void>> voidTasks;
+    std::atomic<int> counter { 0 };
+
+    for (auto i = 0; i < Count; ++i) {
+        tasks.push(Work(executor, i));
+        voidTasks.push(Increment(executor, counter));
+    }
+    const auto results = SyncWait(WhenAll(std::move(tasks)));
+    ASSERT_EQ(results.size(), Count);
+    for (auto i = 0; i < Count; ++i)
+        ASSERT_EQ(results[i], i * 2);
+    SyncWait(WhenAll(std::move(voidTasks)));
+    ASSERT_EQ(counter, Count);
+    ASSERT_TRUE(SyncWait(WhenAll(Vector<Task<int>>())).empty());
+}
+
+TEST(Task, FrameAllocator)
+{
+    using Allocator = Internal::TaskFrameAllocator;
+
+    // Released frames are reused by frames of the same size class
+    const auto frame = Allocator::Allocate(100);
+    Allocator::Deallocate(frame, 100);
+    const auto other = Allocator::Allocate(90);
+    ASSERT_EQ(frame, other);
+    Allocator::Deallocate(other, 90);
+    const auto large = Allocator::Allocate(Allocator::ClassSize * Allocator::ClassCount + 1);
+    ASSERT_NE(large, nullptr);
+    Allocator::Deallocate(large, Allocator::ClassSize * Allocator::ClassCount + 1);
+}
@@ -0,0 +1,157 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the thread wrapper, CPU sets and sysfs topology
+ */
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include <MLCore/Memory.hpp>
+#include <MLCore/Thread.hpp>
+
+using namespace Core;
+
+namespace
+{
+    void WriteFile(const std::filesystem::path &path, const std::string_view content)
+    {
+        std::filesystem::create_directories(path.parent_path());
+        std::ofstream(path) << content << '\n';
+    }
+
+    void WriteCache(const std::filesystem::path &cpu, const int index, const std::string_view level,
+            const std::string_view type, const std::string_view size, const std::string_view shared)
+    {
+        const auto directory = cpu / "cache" / ("index" + std::to_string(index));
+        WriteFile(directory / "level", level);
+        WriteFile(directory / "type", type);
+        WriteFile(directory / "size", size);
+        WriteFile(directory / "shared_cpu_list", shared);
+    }
+}
+
+TEST(Thread, CpuSetParse)
+{
+    const auto set = CpuSet::Parse("0-3,8,10-11");
+
+    ASSERT_EQ(set.count(), 7);
+    ASSERT_TRUE(set.test(0));
+    ASSERT_TRUE(set.test(3));
+    ASSERT_FALSE(set.test(4));
+    ASSERT_TRUE(set.test(8));
+    ASSERT_TRUE(set.test(11));
+    ASSERT_EQ(set.next(4), 8);
+    ASSERT_EQ(set.next(12), CpuSet::NotFound);
+    ASSERT_EQ(set.toString(), "0-3,8,10-11");
+    ASSERT_EQ((set & CpuSet::Parse("2-9")).toString(), "2-3,8");
+    ASSERT_EQ((CpuSet::Single(5) | CpuSet::Single(6)).toString(), "5-6");
+    ASSERT_TRUE(CpuSet::Parse("").empty());
+    ASSERT_TRUE(CpuSet::Parse("x,y-z").empty());
+}
+
+TEST(Thread, TopologyLoad)
+{
+    // Fake machine : 2 cores with 2 SMT siblings each, one L2 per core and a shared L3
+    const auto root = std::filesystem::temp_directory_path() / ("MLCoreTopology" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()));
+    std::filesystem::remove_all(root);
+    WriteFile(root / "online", "0-3");
+    for (auto id = 0; id < 4; ++id) {
+        const auto cpu = root / ("cpu" + std::to_string(id));
+        const auto siblings = id < 2 ? "0-1" : "2-3";
+        WriteFile(cpu / "topology" / "core_id", std::to_string(id / 2));
+        WriteFile(cpu / "topology" / "physical_package_id", "0");
+        WriteCache(cpu, 0, "1", "Data", "32K", siblings);
+        WriteCache(cpu, 1, "1", "Instruction", "32K", siblings);
+        WriteCache(cpu, 2, "2", "Unified", "1024K", siblings);
+        WriteCache(cpu, 3, "3", "Unified", "8M", "0-3");
+    }
+
+    const auto topology = CpuTopology::Load(root.string());
+    std::filesystem::remove_all(root);
+
+    ASSERT_EQ(topology.cpus().size(), 4);
+    ASSERT_EQ(topology.online().toString(), "0-3");
+    ASSERT_EQ(topology.coreCount(), 2);
+    ASSERT_EQ(topology.coreSiblings(1).toString(), "0-1");
+    ASSERT_EQ(topology.coreSiblings(2).toString(), "2-3");
+    ASSERT_EQ(topology.caches().size(), 5);
+    ASSERT_EQ(topology.caches().front().level, 1);
+    ASSERT_EQ(topology.caches().back().level, 3);
+    ASSERT_EQ(topology.caches().back().size, 8 * 1024 * 1024);
+    ASSERT_EQ(topology.sharingCache(3, 2).toString(), "2-3");
+    ASSERT_EQ(topology.sharingCache(3, 3).toString(), "0-3");
+    ASSERT_EQ(topology.sharingCache(3, 4).toString(), "3");
+    const auto groups = topology.cacheGroups(2);
+    ASSERT_EQ(groups.size(), 2);
+    ASSERT_EQ(groups[0].toString(), "0-1");
+    ASSERT_EQ(groups[1].toString(), "2-3");
+    ASSERT_EQ(topology.cacheGroups(4).size(), 1);
+}
+
+TEST(Thread, TopologyFallback)
+{
+    const auto topology = CpuTopology::Load("/nonexistent");
+
+    ASSERT_FALSE(topology.online().empty());
+    ASSERT_EQ(topology.coreCount(), topology.cpus().size());
+    ASSERT_TRUE(topology.caches().empty());
+    ASSERT_EQ(topology.cacheGroups(3).front(), topology.online());
+
+    const auto &machine = CpuTopology::Get();
+    ASSERT_FALSE(machine.online().empty());
+    ASSERT_GE(machine.coreCount(), 1);
+    ASSERT_LE(machine.coreCount(), machine.cpus().size());
+}
+
+TEST(Thread, NameAndAffinity)
+{
+    const auto cpu = Thread::CurrentAffinity().next();
+    std::string name;
+    int runningOn = -1;
+
+    {
+        Thread thread(Thread::Options {
+            .name = "MLCore test thread with a long name",
+            .affinity = CpuSet::Single(cpu)
+        }, [&] {
+            name = Thread::CurrentName();
+            runningOn = Thread::CurrentCpu();
+        });
+        ASSERT_TRUE(thread.joinable());
+        ASSERT_TRUE(thread.status().named);
+        ASSERT_TRUE(thread.status().pinned);
+    }
+    ASSERT_EQ(name, "MLCore test thr");
+    ASSERT_EQ(runningOn, static_cast<int>(cpu));
+}
+
+TEST(Thread, RealtimeFallback)
+{
+    std::atomic<SchedulingPolicy> inside { SchedulingPolicy::RoundRobin };
+    std::atomic<bool> ran { false };
+    Thread thread(Thread::Options { .policy = SchedulingPolicy::Fifo, .priority = 1 }, [&] {
+        inside = Thread::CurrentScheduling();
+        ran = true;
+    });
+    const auto policy = thread.status().policy;
+
+    // Unprivileged processes keep the default policy, the function runs either way
+    ASSERT_TRUE(policy == SchedulingPolicy::Fifo || policy == SchedulingPolicy::Default);
+    thread.join();
+    ASSERT_TRUE(ran);
+    ASSERT_EQ(inside, policy);
+    ASSERT_FALSE(thread.joinable());
+}
+
+TEST(Thread, MemoryLock)
+{
+    Vector<std::uint8_t> buffer(4096, 0u);
+
+    // Locking may be denied by RLIMIT_MEMLOCK, unlocking must succeed once locked
+    if (Memory::Lock(buffer.data(), buffer.size())) {
+        ASSERT_TRUE(Memory::Unlock(buffer.data(), buffer.size()));
+    }
+}
@@ -0,0 +1,54 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Tests of the thread pool
+ */
+
+#include <gtest/gtest.h>
+
+#include <MLCore/ThreadPool.hpp>
+
+TEST(ThreadPool, Dispatch)
+{
+    Core::ThreadPool pool(4);
+    std::atomic<int> hits[1000] {};
+
+    ASSERT_EQ(pool.threadCount(), 4);
+    for (auto round = 0; round < 100; ++round)
+        pool.dispatch(std::size(hits), [&hits](const std::size_t index) { hits[index].fetch_add(1); });
+    for (const auto &hit : hits)
+        ASSERT_EQ(hit.load(), 100);
+}
+
+TEST(ThreadPool, BackToBackDispatch)
+{
+    // Short dispatches in a row let workers wake up after their job is finished, they must not steal indexes of the next one
+    Core::ThreadPool pool(4);
+    std::atomic<int> hits[3] {};
+
+    for (auto round = 0; round < 20000; ++round) {
+        pool.dispatch(std::size(hits), [&hits](const std::size_t index) { hits[index].fetch_add(1); });
+        for (auto &hit : hits)
+            ASSERT_EQ(hit.exchange(0), 1);
+    }
+}
+
+TEST(ThreadPool, Nested)
+{
+    Core::ThreadPool pool(3);
+    std::atomic<int> count { 0 };
+
+    pool.dispatch(8, [&pool, &count](const std::size_t) {
+        pool.dispatch(8, [&count](const std::size_t) { ++count; });
+    });
+    ASSERT_EQ(count.load(), 64);
+}
+
+TEST(ThreadPool, SingleThread)
+{
+    Core::ThreadPool pool(1);
+    int sum = 0;
+
+    ASSERT_EQ(pool.threadCount(), 1);
+    pool.dispatch(10, [&sum](const std::size_t index) { sum += static_cast<int>(index); });
+    ASSERT_EQ(sum, 45);
+}
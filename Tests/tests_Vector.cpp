@@ -2,9 +2,12 @@
  * @ Author: Matthieu Moinvaziri
  * @ Description: Tests of the single consumer concurrent queue
  */
+#include <list>
+
 #include <gtest/gtest.h>
 
 #include <MLCore/Vector.hpp>
+#include <MLCore/FlatVector.hpp>
 
 TEST(Vector, Basics)
 {
@@ -192,4 +195,248 @@ TEST(Vector, Erase)
         vector.erase(vector.begin());
         ASSERT_EQ(vector.size(), 0);
     }
-}
\ No newline at end of file
+}
+
+TEST(Vector, EraseNonTrivial)
+{
+    Core::Vector<std::string> vector { "a", "b", "c", "d" };
+
+    vector.erase(vector.begin() + 1);
+    ASSERT_EQ(vector.size(), 3);
+    ASSERT_EQ(vector[0], "a");
+    ASSERT_EQ(vector[1], "c");
+    ASSERT_EQ(vector[2], "d");
+}
+
+TEST(Vector, EraseUnordered)
+{
+    Core::Vector<std::string> vector { "a", "b", "c", "d" };
+
+    vector.eraseUnordered(vector.begin());
+    ASSERT_EQ(vector.size(), 3);
+    ASSERT_EQ(vector[0], "d");
+    ASSERT_EQ(vector[1], "b");
+    ASSERT_EQ(vector[2], "c");
+    vector.eraseUnordered(vector.end() - 1);
+    ASSERT_EQ(vector.size(), 2);
+    ASSERT_EQ(vector.back(), "b");
+    vector.eraseUnordered(vector.begin());
+    vector.eraseUnordered(vector.begin());
+    ASSERT_TRUE(vector.empty());
+}
+
+TEST(Vector, EraseIndices)
+{
+    constexpr auto count = 10;
+    Core::Vector<int> vector;
+
+    for (auto i = 0; i < count; ++i)
+        vector.push(i);
+    vector.eraseIndices({});
+    ASSERT_EQ(vector.size(), count);
+    vector.eraseIndices({ 0, 3, 4, 9 });
+    ASSERT_EQ(vector.size(), count - 4);
+    const int expected[] { 1, 2, 5, 6, 7, 8 };
+    for (auto i = 0u; i < vector.size(); ++i)
+        ASSERT_EQ(vector[i], expected[i]);
+
+    Core::Vector<std::string> strings { "a", "b", "c", "d", "e" };
+    const Core::Vector<std::size_t> indices { 1, 2, 4 };
+    strings.eraseIndices(indices);
+    ASSERT_EQ(strings.size(), 2);
+    ASSERT_EQ(strings[0], "a");
+    ASSERT_EQ(strings[1], "d");
+    strings.eraseIndices({ 0, 1 });
+    ASSERT_TRUE(strings.empty());
+#ifndef NDEBUG
+    Core::Vector<int> unsorted { 1, 2, 3 };
+    ASSERT_ANY_THROW(unsorted.eraseIndices({ 1, 0 }));
+    ASSERT_ANY_THROW(unsorted.eraseIndices({ 1, 1 }));
+    ASSERT_ANY_THROW(unsorted.eraseIndices({ 3 }));
+#endif
+}
+
+TEST(Vector, RemoveIf)
+{
+    constexpr auto count = 100;
+    Core::Vector<int> vector;
+
+    ASSERT_EQ(vector.removeIf([](int) { return true; }), 0);
+    for (auto i = 0; i < count; ++i)
+        vector.push(i);
+    ASSERT_EQ(vector.removeIf([](const int value) { return value >= count; }), 0);
+    ASSERT_EQ(vector.size(), count);
+    // Removed elements form runs of various lengths, including at both ends
+    ASSERT_EQ(vector.removeIf([](const int value) { return value % 3 == 0 || (value > 40 && value < 50) || value == 98; }), 41);
+    ASSERT_EQ(vector.size(), count - 41);
+    auto expected = 0;
+    for (const auto value : vector) {
+        while (expected % 3 == 0 || (expected > 40 && expected < 50) || expected == 98)
+            ++expected;
+        ASSERT_EQ(value, expected++);
+    }
+    ASSERT_EQ(vector.removeIf([](int) { return true; }), count - 41);
+    ASSERT_TRUE(vector.empty());
+
+    Core::Vector<std::string> strings { "a", "bb", "c", "dd", "ee", "f" };
+    ASSERT_EQ(strings.removeIf([](const std::string &value) { return value.size() == 2; }), 3);
+    ASSERT_EQ(strings.size(), 3);
+    ASSERT_EQ(strings[0], "a");
+    ASSERT_EQ(strings[1], "c");
+    ASSERT_EQ(strings[2], "f");
+}
+
+TEST(Vector, GrowthPolicies)
+{
+    constexpr auto count = 1000ul;
+
+    const auto pushAll = [](auto &vector, Core::Vector<std::size_t> &capacities) {
+        for (auto i = 0ul; i < count; ++i) {
+            vector.push(i);
+            if (capacities.empty() || capacities.back() != vector.capacity())
+                capacities.push(vector.capacity());
+        }
+        for (auto i = 0ul; i < count; ++i)
+            ASSERT_EQ(vector[i], i);
+    };
+
+    {
+        Core::Vector<std::size_t> vector;
+        Core::Vector<std::size_t> capacities;
+        pushAll(vector, capacities);
+        ASSERT_EQ(capacities.front(), 2);
+        for (auto i = 1ul; i < capacities.size(); ++i)
+            ASSERT_EQ(capacities[i], capacities[i - 1] * 2);
+    }
+    {
+        Core::Vector<std::size_t, std::size_t, Core::GrowthPolicy::OneAndHalf<8>> vector;
+        Core::Vector<std::size_t> capacities;
+        pushAll(vector, capacities);
+        ASSERT_EQ(capacities.front(), 8);
+        for (auto i = 1ul; i < capacities.size(); ++i)
+            ASSERT_EQ(capacities[i], capacities[i - 1] + capacities[i - 1] / 2);
+    }
+    {
+        Core::Vector<std::size_t, std::size_t, Core::GrowthPolicy::FixedStep<100>> vector;
+        Core::Vector<std::size_t> capacities;
+        pushAll(vector, capacities);
+        ASSERT_EQ(capacities.size(), count / 100);
+        for (auto i = 0ul; i < capacities.size(); ++i)
+            ASSERT_EQ(capacities[i], (i + 1) * 100);
+    }
+    {
+        Core::Vector<std::size_t, std::size_t, Core::GrowthPolicy::PageGranular<4096>> vector;
+        Core::Vector<std::size_t> capacities;
+        pushAll(vector, capacities);
+        for (const auto capacity : capacities)
+            ASSERT_EQ((capacity * sizeof(std::size_t)) % 4096, 0);
+    }
+    {
+        // The header of flat vectors is part of the page rounded block
+        using FlatVector = Core::FlatVector<std::size_t, std::size_t, Core::GrowthPolicy::PageGranular<4096>>;
+        FlatVector vector;
+        Core::Vector<std::size_t> capacities;
+        pushAll(vector, capacities);
+        for (const auto capacity : capacities)
+            ASSERT_EQ((sizeof(FlatVector::Header) + capacity * sizeof(std::size_t)) % 4096, 0);
+    }
+    {
+        Core::Vector<std::size_t, std::size_t, Core::GrowthPolicy::UsableSize<>> vector;
+        Core::Vector<std::size_t> capacities;
+        pushAll(vector, capacities);
+        ASSERT_GE(capacities.front(), 2);
+    }
+}
+
+TEST(Vector, GrowthPolicyInsert)
+{
+    Core::Vector<int> exact;
+    exact.insert(exact.begin(), { 1 });
+    ASSERT_EQ(exact.capacity(), 1);
+
+    Core::Vector<int, std::size_t, Core::GrowthPolicy::FixedStep<16>> vector;
+
+    vector.insert(vector.begin(), { 1, 2, 3 });
+    ASSERT_EQ(vector.capacity(), 16);
+    vector.insert(vector.begin() + 1, 20, 42);
+    ASSERT_EQ(vector.size(), 23);
+    ASSERT_EQ(vector.capacity(), 36);
+    ASSERT_EQ(vector.front(), 1);
+    ASSERT_EQ(vector[1], 42);
+    ASSERT_EQ(vector[21], 2);
+    ASSERT_EQ(vector.back(), 3);
+}
+
+TEST(Vector, PushUnsafe)
+{
+    constexpr auto count = 42ul;
+    Core::Vector<std::size_t> vector;
+
+    vector.reserve(count);
+    const auto *data = vector.data();
+    for (auto i = 0ul; i < count; ++i)
+        ASSERT_EQ(vector.pushUnsafe(i), i);
+    ASSERT_EQ(vector.data(), data);
+    ASSERT_EQ(vector.size(), count);
+    for (auto i = 0ul; i < count; ++i)
+        ASSERT_EQ(vector[i], i);
+}
+
+TEST(Vector, Append)
+{
+    std::vector<int> tmp(10, 42);
+    Core::Vector<int> vector;
+
+    vector.append(tmp.data(), tmp.data() + tmp.size());
+    ASSERT_EQ(vector.size(), 10);
+    vector.append(std::span<const int>(tmp.data(), 5));
+    ASSERT_EQ(vector.size(), 15);
+    for (auto elem : vector)
+        ASSERT_EQ(elem, 42);
+    const auto it = vector.append({ 1, 2, 3 });
+    ASSERT_EQ(*it, 1);
+    ASSERT_EQ(vector.size(), 18);
+    ASSERT_EQ(vector.back(), 3);
+
+    std::list<std::string> strings { "a", "b", "c" };
+    Core::Vector<std::string> stringVector(1, "z");
+    stringVector.append(strings.begin(), strings.end());
+    ASSERT_EQ(stringVector.size(), 4);
+    ASSERT_EQ(stringVector.front(), "z");
+    ASSERT_EQ(stringVector.back(), "c");
+}
+
+TEST(Vector, ResizeUninitialized)
+{
+    Core::Vector<int> vector { 1, 2, 3 };
+
+    vector.resizeUninitialized(1000);
+    ASSERT_EQ(vector.size(), 1000);
+    ASSERT_EQ(vector[0], 1);
+    ASSERT_EQ(vector[2], 3);
+    vector.resizeUninitialized(2);
+    ASSERT_EQ(vector.size(), 2);
+    ASSERT_EQ(vector.capacity(), 1000);
+    ASSERT_EQ(vector.back(), 2);
+    vector.resizeUninitialized(0);
+    ASSERT_TRUE(vector.empty());
+}
+
+TEST(Vector, ShrinkToFit)
+{
+    Core::Vector<std::string> vector;
+
+    ASSERT_FALSE(vector.shrinkToFit());
+    vector.reserve(100);
+    vector.push("a");
+    vector.push("b");
+    ASSERT_TRUE(vector.shrinkToFit());
+    ASSERT_EQ(vector.capacity(), 2);
+    ASSERT_EQ(vector.front(), "a");
+    ASSERT_EQ(vector.back(), "b");
+    ASSERT_FALSE(vector.shrinkToFit());
+    vector.clear();
+    ASSERT_TRUE(vector.shrinkToFit());
+    ASSERT_EQ(vector.data(), nullptr);
+    ASSERT_EQ(vector.capacity(), 0);
+}